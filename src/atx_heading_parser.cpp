@@ -6,11 +6,9 @@
 // md4qt include.
 #include "atx_heading_parser.h"
 #include "constants.h"
-#include "emphasis_parser.h"
-#include "inline_context.h"
+#include "inline_engine.h"
 #include "paragraph_parser.h"
 #include "parser.h"
-#include "reverse_solidus.h"
 #include "utils.h"
 
 namespace MD
@@ -230,8 +228,6 @@ BlockState ATXHeadingParser::process(Line &currentLine,
     paragraph->setEndColumn(line.length() - 1);
     paragraph->setEndLine(line.lineNumber());
 
-    InlineContext inlineContext;
-
     auto label = findHeaderLabel(s);
 
     if (!label.first.isEmpty()) {
@@ -248,48 +244,14 @@ BlockState ATXHeadingParser::process(Line &currentLine,
 
     line.saveState();
 
-    parser()->pushStateOfInliners();
-
-    ParagraphStream::HashedLines lines;
-    lines.insert(line.lineNumber(), line);
-
-    ParagraphStream pStream(lines, line.lineNumber(), line.lineNumber());
-    const auto pst = pStream.currentState();
-
-    line = pStream.readLine();
-
-    ReverseSolidusHandler rs;
-
-    while (line.position() < line.length()) {
-        auto processed = false;
+    InlineEngine::Buffers buffers(parser()->inlineEngine());
+    buffers.lines().append(line);
 
-        rs.process(line.currentChar());
+    ParagraphStream pStream(buffers.lines(), line.lineNumber());
 
-        if (!(line.position() >= label.second.startColumn() && line.position() <= label.second.endColumn())) {
-            const auto parsers = parser()->inlineParsersFor(line.currentChar());
+    parser()->inlineEngine().parse(pStream, buffers.context(), doc, path, fileName, linksToParse, label.second);
 
-            for (const auto &p : parsers) {
-                if (p->check(line, pStream, inlineContext, doc, path, fileName, linksToParse, *parser(), rs)) {
-                    processed = true;
-                    break;
-                }
-            }
-        }
-
-        if (!processed) {
-            rs.next();
-            line.nextChar();
-        } else {
-            rs.clear();
-        }
-    }
-
-    pStream.restoreState(&pst);
-
-    parser()->popStateOfInliners();
-
-    EmphasisParser::processEmphasises(inlineContext);
-    ParagraphParser::makeTextObjects(inlineContext, pStream, paragraph, label.second);
+    ParagraphParser::makeTextObjects(buffers.context(), pStream, paragraph, label.second);
 
     heading->setText(paragraph);
 
@@ -321,4 +283,14 @@ bool ATXHeadingParser::mayBreakParagraph(Line &,
     return true;
 }
 
+QString ATXHeadingParser::startSymbols() const
+{
+    return QStringLiteral("#");
+}
+
+bool ATXHeadingParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 } /* namespace MD */
@@ -115,6 +115,16 @@ bool BlockParser::isNotFinishedDiscardable() const
     return false;
 }
 
+QString BlockParser::startSymbols() const
+{
+    return {};
+}
+
+bool BlockParser::checkDependsOnIndentsOnly() const
+{
+    return false;
+}
+
 bool BlockParser::isLazyContinuationLine(Line &line,
                                          TextStream &stream,
                                          QSharedPointer<Document> doc,
@@ -227,6 +227,24 @@ public:
      */
     virtual bool isNotFinishedDiscardable() const;
 
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     * Parser doesn't check this block parser on lines that start with other symbols.
+     *
+     * Empty string means that this kind of block may start with any symbol, or that its start is
+     * defined by indentation. Default implementation returns empty string.
+     */
+    virtual QString startSymbols() const;
+
+    /*!
+     * Returns whether result of check() without processing depends only on the line and on indents
+     * of the context, and such check doesn't change state of this block parser. Parser caches
+     * results of checks of the current line when all probed block parsers return true here.
+     *
+     * Default implementation returns false.
+     */
+    virtual bool checkDependsOnIndentsOnly() const;
+
     /*!
      * Returns whether the given line is a paragraph continuation.
      *
@@ -171,4 +171,14 @@ bool BlockquoteParser::mayBreakParagraph(Line &,
     return true;
 }
 
+QString BlockquoteParser::startSymbols() const
+{
+    return QStringLiteral(">");
+}
+
+bool BlockquoteParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 } /* namespace MD */
@@ -9,13 +9,63 @@
 namespace MD
 {
 
-Context::Context(Context *prnt)
-    : m_parent(prnt)
+//
+// Context::Children
+//
+
+Context::Children::~Children()
+{
+    clear();
+}
+
+void Context::Children::dequeue()
+{
+    auto ctx = m_items.takeFirst();
+    ctx->m_pool->release(ctx);
+}
+
+void Context::Children::pop_back()
+{
+    auto ctx = m_items.takeLast();
+    ctx->m_pool->release(ctx);
+}
+
+void Context::Children::clear()
+{
+    for (const auto ctx : std::as_const(m_items)) {
+        ctx->m_pool->release(ctx);
+    }
+
+    m_items.clear();
+}
+
+//
+// Context
+//
+
+Context::Context(Context *prnt,
+                 ContextPool *pool)
+    : m_pool(pool ? pool : (prnt ? prnt->m_pool : nullptr))
+    , m_parent(prnt)
 {
 }
 
 Context::~Context() = default;
 
+Context &Context::appendChild()
+{
+    if (!m_pool) {
+        m_ownPool = QSharedPointer<ContextPool>::create();
+        m_pool = m_ownPool.get();
+    }
+
+    auto &child = m_pool->acquire(this);
+    child.applyParentContext(*this);
+    m_children.enqueue(&child);
+
+    return child;
+}
+
 void Context::applyParentContext(Context &ctx)
 {
     setIndentColumn(ctx.lastChildIndent());
@@ -24,10 +74,123 @@ void Context::applyParentContext(Context &ctx)
 
 void Context::updateParentContextForAllChildren()
 {
-    for (auto it = m_children.begin(), last = m_children.end(); it != last; ++it) {
-        it->applyParentContext(*this);
-        it->updateParentContextForAllChildren();
+    for (qsizetype i = 0, count = m_children.size(); i < count; ++i) {
+        m_children[i].applyParentContext(*this);
+        m_children[i].updateParentContextForAllChildren();
+    }
+}
+
+void Context::appendLazyInfo(qsizetype lineNumber)
+{
+    if (m_lazy.isEmpty()) {
+        m_firstLazyLine = lineNumber;
+    } else if (lineNumber < m_firstLazyLine) {
+        const auto shift = m_firstLazyLine - lineNumber;
+        QBitArray lazy(m_lazy.size() + shift);
+
+        for (qsizetype i = 0, count = m_lazy.size(); i < count; ++i) {
+            if (m_lazy.testBit(i)) {
+                lazy.setBit(i + shift);
+            }
+        }
+
+        m_lazy.swap(lazy);
+        m_firstLazyLine = lineNumber;
+    }
+
+    const auto index = lineNumber - m_firstLazyLine;
+
+    if (index >= m_lazy.size()) {
+        m_lazy.resize(index + 1);
     }
+
+    m_lazy.setBit(index);
+}
+
+void Context::mergeLineInfo(const LineInfo &other)
+{
+    for (qsizetype i = 0, count = other.m_states.size(); i < count; ++i) {
+        if (other.m_states.at(i).m_pos != -1) {
+            appendLineInfo(other.m_firstLine + i, other.m_states.at(i));
+        }
+    }
+}
+
+void Context::appendLineInfo(qsizetype lineNumber,
+                             const Line::State &state)
+{
+    auto &states = m_lines.m_states;
+
+    if (states.isEmpty()) {
+        m_lines.m_firstLine = lineNumber;
+    } else if (lineNumber < m_lines.m_firstLine) {
+        states.insert(0, m_lines.m_firstLine - lineNumber, Line::State(-1, -1));
+        m_lines.m_firstLine = lineNumber;
+    }
+
+    const auto index = lineNumber - m_lines.m_firstLine;
+
+    if (index >= states.size()) {
+        states.resize(index + 1, Line::State(-1, -1));
+    }
+
+    states[index] = state;
+}
+
+void Context::reset()
+{
+    m_parent = nullptr;
+    m_block = nullptr;
+    m_item = nullptr;
+    m_children.clear();
+    m_lists.clear();
+    m_indent = 0;
+    m_childIndents.clear();
+    m_firstLineNumber = -1;
+    m_lastLineNumber = -1;
+    m_lines.m_firstLine = -1;
+    m_lines.m_states.clear();
+    m_lazy.clear();
+    m_firstLazyLine = -1;
+    m_listDelimiter = QChar();
+    m_isNotFinished = false;
+    m_isDiscardForced = false;
+    m_dontConsiderIndents = false;
+}
+
+//
+// ContextPool
+//
+
+ContextPool::ContextPool() = default;
+
+ContextPool::~ContextPool()
+{
+    // Contexts in use are destroyed together with the pool, their children are not returned.
+    for (const auto &ctx : std::as_const(m_contexts)) {
+        ctx->m_children.m_items.clear();
+    }
+}
+
+Context &ContextPool::acquire(Context *parent)
+{
+    if (m_free.isEmpty()) {
+        m_contexts.append(QSharedPointer<Context>::create(parent, this));
+
+        return *m_contexts.back();
+    }
+
+    auto ctx = m_free.takeLast();
+    ctx->m_parent = parent;
+
+    return *ctx;
+}
+
+void ContextPool::release(Context *ctx)
+{
+    ctx->reset();
+
+    m_free.append(ctx);
 }
 
 } /* namespace MD */
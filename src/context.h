@@ -12,9 +12,9 @@
 #include "utils.h"
 
 // Qt include.
-#include <QHash>
-#include <QQueue>
-#include <QSet>
+#include <QBitArray>
+#include <QSharedPointer>
+#include <QVector>
 
 // C++ include.
 #include <algorithm>
@@ -23,6 +23,7 @@ namespace MD
 {
 
 class BlockParser;
+class ContextPool;
 
 /*!
  * \class MD::Context
@@ -31,12 +32,22 @@ class BlockParser;
  *
  * \brief Parsing context.
  *
- * Auxiliary class for parsing process.
+ * Auxiliary class for parsing process. Contexts form a tree, child contexts are taken from
+ * the pool, so they never change their addresses while they are in the tree.
  */
 class Context final
 {
 public:
-    explicit Context(Context *prnt = nullptr);
+    /*!
+     * Constructor.
+     *
+     * \a prnt Parent context.
+     *
+     * \a pool Pool of child contexts, if not set the pool of the parent is used, or own pool
+     *          is created on demand.
+     */
+    explicit Context(Context *prnt = nullptr,
+                     ContextPool *pool = nullptr);
     ~Context();
 
     /*!
@@ -48,13 +59,102 @@ public:
     }
 
     /*!
-     * \typealias MD::Context::Children
+     * \class MD::Context::Children
      * \inmodule md4qt
      * \inheaderfile md4qt/context.h
      *
-     * \brief Type of queue of children.
+     * \brief Queue of children.
+     *
+     * Holds pointers to child contexts, removed contexts are returned to the pool.
      */
-    using Children = QQueue<Context>;
+    class Children final
+    {
+    public:
+        Children() = default;
+        ~Children();
+
+        /*!
+         * Returns whether the queue is empty.
+         */
+        inline bool isEmpty() const
+        {
+            return m_items.isEmpty();
+        }
+
+        /*!
+         * Returns count of children.
+         */
+        inline qsizetype size() const
+        {
+            return m_items.size();
+        }
+
+        /*!
+         * Returns first child.
+         */
+        inline Context &head() const
+        {
+            return *m_items.front();
+        }
+
+        /*!
+         * Returns first child.
+         */
+        inline Context &front() const
+        {
+            return *m_items.front();
+        }
+
+        /*!
+         * Returns last child.
+         */
+        inline Context &back() const
+        {
+            return *m_items.back();
+        }
+
+        /*!
+         * Returns child at the given index.
+         *
+         * \a i Index.
+         */
+        inline Context &operator[](qsizetype i) const
+        {
+            return *m_items.at(i);
+        }
+
+        /*!
+         * Appends child.
+         *
+         * \a ctx Child context taken from the pool.
+         */
+        inline void enqueue(Context *ctx)
+        {
+            m_items.append(ctx);
+        }
+
+        /*!
+         * Removes first child.
+         */
+        void dequeue();
+
+        /*!
+         * Removes last child.
+         */
+        void pop_back();
+
+        /*!
+         * Removes all children.
+         */
+        void clear();
+
+    private:
+        friend class ContextPool;
+
+        QVector<Context *> m_items;
+
+        Q_DISABLE_COPY(Children)
+    }; // class Children
 
     /*!
      * \typealias MD::Context::ChildIndents
@@ -75,13 +175,25 @@ public:
     using ChildLists = QVector<QSharedPointer<List>>;
 
     /*!
-     * \typealias MD::Context::LineInfo
+     * \class MD::Context::LineInfo
      * \inmodule md4qt
      * \inheaderfile md4qt/context.h
      *
-     * \brief Type hash of line informations.
+     * \brief Information about lines.
+     *
+     * Lines of a block go one after another, so start positions of lines are stored in a vector
+     * indexed from the first line with information. Lines without information have position -1.
      */
-    using LineInfo = QHash<qsizetype, Line::State>;
+    struct LineInfo {
+        /*!
+         * Number of the first line in the vector.
+         */
+        qsizetype m_firstLine = -1;
+        /*!
+         * States of lines.
+         */
+        QVector<Line::State> m_states;
+    }; // struct LineInfo
 
     /*!
      * Returns block parser of this context.
@@ -117,6 +229,11 @@ public:
         return m_children;
     }
 
+    /*!
+     * Appends a new child context, that is taken from the pool, and returns it.
+     */
+    Context &appendChild();
+
     /*!
      * Returns current indent column. Has a sense in lists, for example.
      */
@@ -261,7 +378,10 @@ public:
      */
     inline bool isLazyLine(qsizetype lineNumber) const
     {
-        return (m_lazy.contains(lineNumber) ? true : (m_parent ? m_parent->isLazyLine(lineNumber) : false));
+        const auto index = lineNumber - m_firstLazyLine;
+
+        return ((index >= 0 && index < m_lazy.size() && m_lazy.testBit(index))
+                || (m_parent ? m_parent->isLazyLine(lineNumber) : false));
     }
 
     /*!
@@ -269,10 +389,7 @@ public:
      *
      * \a lineNumber Line number.
      */
-    inline void appendLazyInfo(qsizetype lineNumber)
-    {
-        m_lazy.insert(lineNumber);
-    }
+    void appendLazyInfo(qsizetype lineNumber);
 
     /*!
      * Apply settings for child context.
@@ -299,10 +416,7 @@ public:
      *
      * \a other Line info.
      */
-    inline void mergeLineInfo(const LineInfo &other)
-    {
-        m_lines.insert(other);
-    }
+    void mergeLineInfo(const LineInfo &other);
 
     /*!
      * Add information about line of this block.
@@ -311,11 +425,8 @@ public:
      *
      * \a state State.
      */
-    inline void appendLineInfo(qsizetype lineNumber,
-                               const Line::State &state)
-    {
-        m_lines.insert(lineNumber, state);
-    }
+    void appendLineInfo(qsizetype lineNumber,
+                        const Line::State &state);
 
     /*!
      * Returns start position of this block on line.
@@ -324,7 +435,9 @@ public:
      */
     inline Line::State startPos(qsizetype lineNumber) const
     {
-        return m_lines.value(lineNumber, Line::State(-1, -1));
+        const auto index = lineNumber - m_lines.m_firstLine;
+
+        return (index >= 0 && index < m_lines.m_states.size() ? m_lines.m_states.at(index) : Line::State(-1, -1));
     }
 
     /*!
@@ -337,8 +450,10 @@ public:
     inline void updateStartPos(qsizetype lineNumber,
                                qsizetype pos)
     {
-        if (m_lines.contains(lineNumber)) {
-            m_lines[lineNumber].m_pos = pos;
+        const auto index = lineNumber - m_lines.m_firstLine;
+
+        if (index >= 0 && index < m_lines.m_states.size() && m_lines.m_states.at(index).m_pos != -1) {
+            m_lines.m_states[index].m_pos = pos;
         }
     }
 
@@ -396,13 +511,7 @@ public:
     inline Context &mostNestedChild()
     {
         if (!m_children.isEmpty() && m_children.back().block()) {
-            auto it = std::find_if(m_children.rbegin(), m_children.rend(), [](const auto &c) {
-                return (c.block() != nullptr);
-            });
-
-            if (it != m_children.rend()) {
-                return it->mostNestedChild();
-            }
+            return m_children.back().mostNestedChild();
         }
 
         return *this;
@@ -526,6 +635,15 @@ public:
     }
 
 private:
+    friend class ContextPool;
+
+    // Resets the context to the initial state keeping the pool, children are returned to the pool.
+    void reset();
+
+private:
+    // Own pool is declared before children, so children are returned to it before it's destroyed.
+    QSharedPointer<ContextPool> m_ownPool;
+    ContextPool *m_pool = nullptr;
     Context *m_parent = nullptr;
     BlockParser *m_block = nullptr;
     Item *m_item = nullptr;
@@ -536,13 +654,57 @@ private:
     qsizetype m_firstLineNumber = -1;
     qsizetype m_lastLineNumber = -1;
     LineInfo m_lines;
-    QSet<qsizetype> m_lazy;
+    // Lazy lines starting from the first lazy line.
+    QBitArray m_lazy;
+    qsizetype m_firstLazyLine = -1;
     QChar m_listDelimiter;
     bool m_isNotFinished = false;
     bool m_isDiscardForced = false;
     bool m_dontConsiderIndents = false;
+
+    Q_DISABLE_COPY(Context)
 }; // class Context
 
+//
+// ContextPool
+//
+
+/*!
+ * \class MD::ContextPool
+ * \inmodule md4qt
+ * \inheaderfile md4qt/context.h
+ *
+ * \brief Pool of parsing contexts.
+ *
+ * Contexts are allocated once and reused from one parse to another, addresses of contexts are stable.
+ */
+class ContextPool final
+{
+public:
+    ContextPool();
+    ~ContextPool();
+
+    /*!
+     * Returns empty context with the given parent.
+     *
+     * \a parent Parent context.
+     */
+    Context &acquire(Context *parent);
+
+    /*!
+     * Returns the context with all its children to the pool.
+     *
+     * \a ctx Context.
+     */
+    void release(Context *ctx);
+
+private:
+    QVector<QSharedPointer<Context>> m_contexts;
+    QVector<Context *> m_free;
+
+    Q_DISABLE_COPY(ContextPool)
+}; // class ContextPool
+
 } /* namespace MD */
 
 #endif // MD4QT_MD_CONTEXT_H_INCLUDED
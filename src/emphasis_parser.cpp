@@ -10,6 +10,10 @@
 #include "text_stream.h"
 #include "utils.h"
 
+// Qt include.
+#include <QHash>
+#include <QVarLengthArray>
+
 // C++ include.
 #include <algorithm>
 
@@ -31,7 +35,7 @@ bool EmphasisParser::check(Line &currentLine,
                            const ReverseSolidusHandler &rs)
 {
     if (currentLine.currentChar() == symbol() && !rs.isPrevReverseSolidus()) {
-        auto pos = currentLine.position();
+        const auto pos = currentLine.position();
         Line::State st;
         const auto prevSymbol = currentLine.prevChar();
         int count = 0;
@@ -49,11 +53,7 @@ bool EmphasisParser::check(Line &currentLine,
             const auto rightFlanking = isRightFlanking(prevSymbol, nextSymbol);
 
             if (leftFlanking || rightFlanking) {
-                for (int i = 0; i < count; ++i) {
-                    ctx.delims().enqueue({pos, currentLine.lineNumber(), leftFlanking, rightFlanking, this});
-
-                    ++pos;
-                }
+                ctx.delims().enqueue({pos, currentLine.lineNumber(), leftFlanking, rightFlanking, this, count});
 
                 return true;
             } else {
@@ -95,118 +95,171 @@ bool EmphasisParser::isRightFlanking(const QChar &before,
     return (!uWhitespaceBefore && (!punctBefore || (punctBefore && (uWhitespaceAfter || punctAfter))));
 }
 
-int lengthForward(const InlineContext::DelimiterQueue &emph,
-                  qsizetype idx)
+inline bool isMult3(long long int i1,
+                    long long int i2)
 {
-    const auto *parser = emph[idx].m_parser;
-    int len = 1;
-    const auto pos = emph[idx].m_pos;
-
-    for (qsizetype i = idx + 1; i < emph.size(); ++i) {
-        if (emph[i].m_line == emph[idx].m_line && emph[i].m_parser == parser && emph[i].m_pos == pos + len) {
-            ++len;
-        } else {
-            break;
-        }
-    }
+    return ((((i1 + i2) % 3) == 0) && !((i1 % 3 == 0) && (i2 % 3 == 0)));
+}
 
-    return len;
+inline EmphasisParser *staticCast(InlineParser *parser)
+{
+    return static_cast<EmphasisParser *>(parser);
 }
 
-int lengthBackward(const InlineContext::DelimiterQueue &emph,
-                   qsizetype idx)
+//
+// OpenersBottom
+//
+
+// Lowest indexes in the stack of openers worth to look for an opener for the closer of the given kind.
+struct OpenersBottom {
+    InlineParser *m_parser = nullptr;
+    qsizetype m_bottom[18] = {};
+    // When lengths of opening and closing delimiters should be equal, opener is looked for
+    // by the exact length, so bottoms are kept for every tried length.
+    QHash<qsizetype, qsizetype> m_exactBottom;
+
+    // Kind of the closer is defined by flanking, by length of the whole run, and by length of
+    // the run's rest when lengths of opening and closing delimiters should be equal.
+    static inline qsizetype index(const InlineContext::Delimiter &closer,
+                                  qsizetype length)
+    {
+        return (closer.m_leftFlanking ? 9 : 0) + (closer.m_length % 3) * 3
+            + (staticCast(closer.m_parser)->isLengthCorrespond() ? length % 3 : 0);
+    }
+}; // struct OpenersBottom
+
+inline qsizetype &openersBottom(QVarLengthArray<OpenersBottom, 4> &bottoms,
+                                const InlineContext::Delimiter &closer,
+                                qsizetype length)
 {
-    const auto *parser = emph[idx].m_parser;
-    int len = 1;
-    const auto pos = emph[idx].m_pos;
+    auto it = std::find_if(bottoms.begin(), bottoms.end(), [&closer](const auto &b) {
+        return b.m_parser == closer.m_parser;
+    });
 
-    for (qsizetype i = idx - 1; i >= 0; --i) {
-        if (emph[i].m_line == emph[idx].m_line && emph[i].m_parser == parser && emph[i].m_pos == pos - len) {
-            ++len;
-        } else {
-            break;
-        }
+    if (it == bottoms.end()) {
+        OpenersBottom bottom;
+        bottom.m_parser = closer.m_parser;
+
+        bottoms.append(bottom);
+        it = std::prev(bottoms.end());
     }
 
-    return len;
-}
+    const auto i = OpenersBottom::index(closer, length);
 
-inline bool isMult3(long long int i1,
-                    long long int i2)
-{
-    return ((((i1 + i2) % 3) == 0) && !((i1 % 3 == 0) && (i2 % 3 == 0)));
+    return (staticCast(closer.m_parser)->isLengthCorrespond() ? it->m_exactBottom[length * 18 + i]
+                                                                : it->m_bottom[i]);
 }
 
-inline EmphasisParser *staticCast(InlineParser *parser)
+// Returns index of the opener for the closer, where closer's length is the given length,
+// or -1 if there is no such opener above the bottom.
+inline qsizetype findOpener(const InlineContext::DelimiterStack &openers,
+                            const InlineContext::Delimiter &closer,
+                            qsizetype length,
+                            qsizetype bottom)
 {
-    return static_cast<EmphasisParser *>(parser);
+    for (qsizetype j = openers.size() - 1; j >= bottom; --j) {
+        const auto &opener = openers[j];
+
+        if (opener.m_parser == closer.m_parser) {
+            const bool canMatch = !(((closer.m_leftFlanking && closer.m_rightFlanking)
+                                     || (opener.m_leftFlanking && opener.m_rightFlanking))
+                                    && isMult3(opener.m_length, closer.m_length));
+
+            if (canMatch
+                && (staticCast(closer.m_parser)->isLengthCorrespond() ? opener.m_length == length : true)) {
+                return j;
+            }
+        }
+    }
+
+    return -1;
 }
 
 void EmphasisParser::processEmphasises(InlineContext &ctx)
 {
     if (!ctx.delims().isEmpty()) {
-        for (qsizetype i = 0; i < ctx.delims().size(); ++i) {
-            if (ctx.delims()[i].m_rightFlanking) {
-                const auto lengthRight = lengthForward(ctx.delims(), i);
-                const auto tmpLengthLeft = lengthBackward(ctx.delims(), i) - 1;
-
-                bool processed = false;
-
-                for (qsizetype j = i - tmpLengthLeft - 1; j >= 0; --j) {
-                    if (ctx.delims()[j].m_parser == ctx.delims()[i].m_parser && ctx.delims()[j].m_leftFlanking) {
-                        const auto lengthLeft = lengthBackward(ctx.delims(), j);
-
-                        bool canMatch = !(((ctx.delims()[i].m_leftFlanking && ctx.delims()[i].m_rightFlanking)
-                                           || (ctx.delims()[j].m_leftFlanking && ctx.delims()[j].m_rightFlanking))
-                                          && (isMult3(lengthLeft, lengthRight + tmpLengthLeft)));
-                        canMatch = canMatch
-                            && (staticCast(ctx.delims()[i].m_parser)->isLengthCorrespond() ? lengthLeft == lengthRight
-                                                                                           : true);
-
-                        if (canMatch) {
-                            processed = true;
-
-                            ctx.delims().remove(j + 1, i - j - 1);
-                            i -= i - j - 1;
-
-                            if (lengthLeft <= lengthRight) {
-                                ctx.openStyles().append(staticCast(ctx.delims()[i - 1].m_parser)
-                                                            ->openStyles(ctx.delims()[i - lengthLeft].m_pos,
-                                                                         ctx.delims()[i - 1].m_line,
-                                                                         lengthLeft));
-                                ctx.closeStyles().append(
-                                    staticCast(ctx.delims()[i].m_parser)
-                                        ->closeStyles(ctx.delims()[i].m_pos, ctx.delims()[i].m_line, lengthLeft));
-                                ctx.delims().remove(i, lengthLeft);
-                                ctx.delims().remove(i - lengthLeft, lengthLeft);
-                                i -= lengthLeft + 1;
-                            } else {
-                                ctx.openStyles().append(staticCast(ctx.delims()[i - 1].m_parser)
-                                                            ->openStyles(ctx.delims()[i - lengthRight].m_pos,
-                                                                         ctx.delims()[i - 1].m_line,
-                                                                         lengthRight));
-                                ctx.closeStyles().append(
-                                    staticCast(ctx.delims()[i].m_parser)
-                                        ->closeStyles(ctx.delims()[i].m_pos, ctx.delims()[i].m_line, lengthRight));
-                                ctx.delims().remove(i, lengthRight);
-                                ctx.delims().remove(i - lengthRight, lengthRight);
-                                i -= lengthRight + 1;
-                            }
-
-                            break;
-                        } else {
-                            j -= lengthLeft - 1;
-                        }
+        // Left flanking runs of delimiters that still may open an emphasis, in order of appearance.
+        auto &openers = ctx.openers();
+        openers.clear();
+        QVarLengthArray<OpenersBottom, 4> bottoms;
+
+        for (auto closer : std::as_const(ctx.delims())) {
+            while (closer.m_rightFlanking && closer.m_length > 0) {
+                qsizetype j = -1;
+                qsizetype skipped = 0;
+
+                // When lengths should correspond, rest of the closer is tried too,
+                // skipped delimiters are not a part of emphasis then.
+                for (; skipped < closer.m_length; ++skipped) {
+                    const auto length = closer.m_length - skipped;
+                    auto &bottom = openersBottom(bottoms, closer, length);
+
+                    j = findOpener(openers, closer, length, bottom);
+
+                    if (j != -1) {
+                        break;
                     }
+
+                    bottom = openers.size();
+
+                    if (!closer.m_leftFlanking || !staticCast(closer.m_parser)->isLengthCorrespond()) {
+                        break;
+                    }
+                }
+
+                if (j == -1) {
+                    if (closer.m_leftFlanking) {
+                        break;
+                    }
+
+                    ++closer.m_pos;
+                    --closer.m_length;
+
+                    continue;
                 }
 
-                if (!processed && !ctx.delims()[i].m_leftFlanking) {
-                    ctx.delims().remove(i--);
+                closer.m_pos += skipped;
+                closer.m_length -= skipped;
+
+                openers.resize(j + 1);
+
+                auto &opener = openers.back();
+                const auto length = qMin(opener.m_length, closer.m_length);
+
+                ctx.openStyles().append(staticCast(opener.m_parser)
+                                            ->openStyles(opener.m_pos + opener.m_length - length,
+                                                         opener.m_line,
+                                                         length));
+                ctx.closeStyles().append(
+                    staticCast(closer.m_parser)->closeStyles(closer.m_pos, closer.m_line, length));
+
+                opener.m_length -= length;
+                closer.m_pos += length;
+                closer.m_length -= length;
+
+                if (!opener.m_length) {
+                    openers.removeLast();
                 }
+
+                // Openers above the matched one are dropped, and the matched one is changed.
+                for (auto &b : bottoms) {
+                    for (auto &i : b.m_bottom) {
+                        i = qMin(i, j);
+                    }
+
+                    for (auto &i : b.m_exactBottom) {
+                        i = qMin(i, j);
+                    }
+                }
+            }
+
+            if (closer.m_leftFlanking && closer.m_length > 0) {
+                openers.append(closer);
             }
         }
 
         ctx.delims().clear();
+        openers.clear();
 
         std::sort(ctx.openStyles().begin(), ctx.openStyles().end());
         std::sort(ctx.closeStyles().begin(), ctx.closeStyles().end());
@@ -10,2237 +10,2486 @@
 namespace MD
 {
 
-const QHash<QString, QString> s_entityMap = {
-    {QStringLiteral("&AElig"), QString::fromUtf16(u"\x00C6")},
-    {QStringLiteral("&AElig;"), QString::fromUtf16(u"\x00C6")},
-    {QStringLiteral("&AMP"), QString::fromUtf16(u"\x0026")},
-    {QStringLiteral("&AMP;"), QString::fromUtf16(u"\x0026")},
-    {QStringLiteral("&Aacute"), QString::fromUtf16(u"\x00C1")},
-    {QStringLiteral("&Aacute;"), QString::fromUtf16(u"\x00C1")},
-    {QStringLiteral("&Abreve;"), QString::fromUtf16(u"\x0102")},
-    {QStringLiteral("&Acirc"), QString::fromUtf16(u"\x00C2")},
-    {QStringLiteral("&Acirc;"), QString::fromUtf16(u"\x00C2")},
-    {QStringLiteral("&Acy;"), QString::fromUtf16(u"\x0410")},
-    {QStringLiteral("&Afr;"), QString::fromUtf16(u"\xD835\xDD04")},
-    {QStringLiteral("&Agrave"), QString::fromUtf16(u"\x00C0")},
-    {QStringLiteral("&Agrave;"), QString::fromUtf16(u"\x00C0")},
-    {QStringLiteral("&Alpha;"), QString::fromUtf16(u"\x0391")},
-    {QStringLiteral("&Amacr;"), QString::fromUtf16(u"\x0100")},
-    {QStringLiteral("&And;"), QString::fromUtf16(u"\x2A53")},
-    {QStringLiteral("&Aogon;"), QString::fromUtf16(u"\x0104")},
-    {QStringLiteral("&Aopf;"), QString::fromUtf16(u"\xD835\xDD38")},
-    {QStringLiteral("&ApplyFunction;"), QString::fromUtf16(u"\x2061")},
-    {QStringLiteral("&Aring"), QString::fromUtf16(u"\x00C5")},
-    {QStringLiteral("&Aring;"), QString::fromUtf16(u"\x00C5")},
-    {QStringLiteral("&Ascr;"), QString::fromUtf16(u"\xD835\xDC9C")},
-    {QStringLiteral("&Assign;"), QString::fromUtf16(u"\x2254")},
-    {QStringLiteral("&Atilde"), QString::fromUtf16(u"\x00C3")},
-    {QStringLiteral("&Atilde;"), QString::fromUtf16(u"\x00C3")},
-    {QStringLiteral("&Auml"), QString::fromUtf16(u"\x00C4")},
-    {QStringLiteral("&Auml;"), QString::fromUtf16(u"\x00C4")},
-    {QStringLiteral("&Backslash;"), QString::fromUtf16(u"\x2216")},
-    {QStringLiteral("&Barv;"), QString::fromUtf16(u"\x2AE7")},
-    {QStringLiteral("&Barwed;"), QString::fromUtf16(u"\x2306")},
-    {QStringLiteral("&Bcy;"), QString::fromUtf16(u"\x0411")},
-    {QStringLiteral("&Because;"), QString::fromUtf16(u"\x2235")},
-    {QStringLiteral("&Bernoullis;"), QString::fromUtf16(u"\x212C")},
-    {QStringLiteral("&Beta;"), QString::fromUtf16(u"\x0392")},
-    {QStringLiteral("&Bfr;"), QString::fromUtf16(u"\xD835\xDD05")},
-    {QStringLiteral("&Bopf;"), QString::fromUtf16(u"\xD835\xDD39")},
-    {QStringLiteral("&Breve;"), QString::fromUtf16(u"\x02D8")},
-    {QStringLiteral("&Bscr;"), QString::fromUtf16(u"\x212C")},
-    {QStringLiteral("&Bumpeq;"), QString::fromUtf16(u"\x224E")},
-    {QStringLiteral("&CHcy;"), QString::fromUtf16(u"\x0427")},
-    {QStringLiteral("&COPY"), QString::fromUtf16(u"\x00A9")},
-    {QStringLiteral("&COPY;"), QString::fromUtf16(u"\x00A9")},
-    {QStringLiteral("&Cacute;"), QString::fromUtf16(u"\x0106")},
-    {QStringLiteral("&Cap;"), QString::fromUtf16(u"\x22D2")},
-    {QStringLiteral("&CapitalDifferentialD;"), QString::fromUtf16(u"\x2145")},
-    {QStringLiteral("&Cayleys;"), QString::fromUtf16(u"\x212D")},
-    {QStringLiteral("&Ccaron;"), QString::fromUtf16(u"\x010C")},
-    {QStringLiteral("&Ccedil"), QString::fromUtf16(u"\x00C7")},
-    {QStringLiteral("&Ccedil;"), QString::fromUtf16(u"\x00C7")},
-    {QStringLiteral("&Ccirc;"), QString::fromUtf16(u"\x0108")},
-    {QStringLiteral("&Cconint;"), QString::fromUtf16(u"\x2230")},
-    {QStringLiteral("&Cdot;"), QString::fromUtf16(u"\x010A")},
-    {QStringLiteral("&Cedilla;"), QString::fromUtf16(u"\x00B8")},
-    {QStringLiteral("&CenterDot;"), QString::fromUtf16(u"\x00B7")},
-    {QStringLiteral("&Cfr;"), QString::fromUtf16(u"\x212D")},
-    {QStringLiteral("&Chi;"), QString::fromUtf16(u"\x03A7")},
-    {QStringLiteral("&CircleDot;"), QString::fromUtf16(u"\x2299")},
-    {QStringLiteral("&CircleMinus;"), QString::fromUtf16(u"\x2296")},
-    {QStringLiteral("&CirclePlus;"), QString::fromUtf16(u"\x2295")},
-    {QStringLiteral("&CircleTimes;"), QString::fromUtf16(u"\x2297")},
-    {QStringLiteral("&ClockwiseContourIntegral;"), QString::fromUtf16(u"\x2232")},
-    {QStringLiteral("&CloseCurlyDoubleQuote;"), QString::fromUtf16(u"\x201D")},
-    {QStringLiteral("&CloseCurlyQuote;"), QString::fromUtf16(u"\x2019")},
-    {QStringLiteral("&Colon;"), QString::fromUtf16(u"\x2237")},
-    {QStringLiteral("&Colone;"), QString::fromUtf16(u"\x2A74")},
-    {QStringLiteral("&Congruent;"), QString::fromUtf16(u"\x2261")},
-    {QStringLiteral("&Conint;"), QString::fromUtf16(u"\x222F")},
-    {QStringLiteral("&ContourIntegral;"), QString::fromUtf16(u"\x222E")},
-    {QStringLiteral("&Copf;"), QString::fromUtf16(u"\x2102")},
-    {QStringLiteral("&Coproduct;"), QString::fromUtf16(u"\x2210")},
-    {QStringLiteral("&CounterClockwiseContourIntegral;"), QString::fromUtf16(u"\x2233")},
-    {QStringLiteral("&Cross;"), QString::fromUtf16(u"\x2A2F")},
-    {QStringLiteral("&Cscr;"), QString::fromUtf16(u"\xD835\xDC9E")},
-    {QStringLiteral("&Cup;"), QString::fromUtf16(u"\x22D3")},
-    {QStringLiteral("&CupCap;"), QString::fromUtf16(u"\x224D")},
-    {QStringLiteral("&DD;"), QString::fromUtf16(u"\x2145")},
-    {QStringLiteral("&DDotrahd;"), QString::fromUtf16(u"\x2911")},
-    {QStringLiteral("&DJcy;"), QString::fromUtf16(u"\x0402")},
-    {QStringLiteral("&DScy;"), QString::fromUtf16(u"\x0405")},
-    {QStringLiteral("&DZcy;"), QString::fromUtf16(u"\x040F")},
-    {QStringLiteral("&Dagger;"), QString::fromUtf16(u"\x2021")},
-    {QStringLiteral("&Darr;"), QString::fromUtf16(u"\x21A1")},
-    {QStringLiteral("&Dashv;"), QString::fromUtf16(u"\x2AE4")},
-    {QStringLiteral("&Dcaron;"), QString::fromUtf16(u"\x010E")},
-    {QStringLiteral("&Dcy;"), QString::fromUtf16(u"\x0414")},
-    {QStringLiteral("&Del;"), QString::fromUtf16(u"\x2207")},
-    {QStringLiteral("&Delta;"), QString::fromUtf16(u"\x0394")},
-    {QStringLiteral("&Dfr;"), QString::fromUtf16(u"\xD835\xDD07")},
-    {QStringLiteral("&DiacriticalAcute;"), QString::fromUtf16(u"\x00B4")},
-    {QStringLiteral("&DiacriticalDot;"), QString::fromUtf16(u"\x02D9")},
-    {QStringLiteral("&DiacriticalDoubleAcute;"), QString::fromUtf16(u"\x02DD")},
-    {QStringLiteral("&DiacriticalGrave;"), QString::fromUtf16(u"\x0060")},
-    {QStringLiteral("&DiacriticalTilde;"), QString::fromUtf16(u"\x02DC")},
-    {QStringLiteral("&Diamond;"), QString::fromUtf16(u"\x22C4")},
-    {QStringLiteral("&DifferentialD;"), QString::fromUtf16(u"\x2146")},
-    {QStringLiteral("&Dopf;"), QString::fromUtf16(u"\xD835\xDD3B")},
-    {QStringLiteral("&Dot;"), QString::fromUtf16(u"\x00A8")},
-    {QStringLiteral("&DotDot;"), QString::fromUtf16(u"\x20DC")},
-    {QStringLiteral("&DotEqual;"), QString::fromUtf16(u"\x2250")},
-    {QStringLiteral("&DoubleContourIntegral;"), QString::fromUtf16(u"\x222F")},
-    {QStringLiteral("&DoubleDot;"), QString::fromUtf16(u"\x00A8")},
-    {QStringLiteral("&DoubleDownArrow;"), QString::fromUtf16(u"\x21D3")},
-    {QStringLiteral("&DoubleLeftArrow;"), QString::fromUtf16(u"\x21D0")},
-    {QStringLiteral("&DoubleLeftRightArrow;"), QString::fromUtf16(u"\x21D4")},
-    {QStringLiteral("&DoubleLeftTee;"), QString::fromUtf16(u"\x2AE4")},
-    {QStringLiteral("&DoubleLongLeftArrow;"), QString::fromUtf16(u"\x27F8")},
-    {QStringLiteral("&DoubleLongLeftRightArrow;"), QString::fromUtf16(u"\x27FA")},
-    {QStringLiteral("&DoubleLongRightArrow;"), QString::fromUtf16(u"\x27F9")},
-    {QStringLiteral("&DoubleRightArrow;"), QString::fromUtf16(u"\x21D2")},
-    {QStringLiteral("&DoubleRightTee;"), QString::fromUtf16(u"\x22A8")},
-    {QStringLiteral("&DoubleUpArrow;"), QString::fromUtf16(u"\x21D1")},
-    {QStringLiteral("&DoubleUpDownArrow;"), QString::fromUtf16(u"\x21D5")},
-    {QStringLiteral("&DoubleVerticalBar;"), QString::fromUtf16(u"\x2225")},
-    {QStringLiteral("&DownArrow;"), QString::fromUtf16(u"\x2193")},
-    {QStringLiteral("&DownArrowBar;"), QString::fromUtf16(u"\x2913")},
-    {QStringLiteral("&DownArrowUpArrow;"), QString::fromUtf16(u"\x21F5")},
-    {QStringLiteral("&DownBreve;"), QString::fromUtf16(u"\x0311")},
-    {QStringLiteral("&DownLeftRightVector;"), QString::fromUtf16(u"\x2950")},
-    {QStringLiteral("&DownLeftTeeVector;"), QString::fromUtf16(u"\x295E")},
-    {QStringLiteral("&DownLeftVector;"), QString::fromUtf16(u"\x21BD")},
-    {QStringLiteral("&DownLeftVectorBar;"), QString::fromUtf16(u"\x2956")},
-    {QStringLiteral("&DownRightTeeVector;"), QString::fromUtf16(u"\x295F")},
-    {QStringLiteral("&DownRightVector;"), QString::fromUtf16(u"\x21C1")},
-    {QStringLiteral("&DownRightVectorBar;"), QString::fromUtf16(u"\x2957")},
-    {QStringLiteral("&DownTee;"), QString::fromUtf16(u"\x22A4")},
-    {QStringLiteral("&DownTeeArrow;"), QString::fromUtf16(u"\x21A7")},
-    {QStringLiteral("&Downarrow;"), QString::fromUtf16(u"\x21D3")},
-    {QStringLiteral("&Dscr;"), QString::fromUtf16(u"\xD835\xDC9F")},
-    {QStringLiteral("&Dstrok;"), QString::fromUtf16(u"\x0110")},
-    {QStringLiteral("&ENG;"), QString::fromUtf16(u"\x014A")},
-    {QStringLiteral("&ETH"), QString::fromUtf16(u"\x00D0")},
-    {QStringLiteral("&ETH;"), QString::fromUtf16(u"\x00D0")},
-    {QStringLiteral("&Eacute"), QString::fromUtf16(u"\x00C9")},
-    {QStringLiteral("&Eacute;"), QString::fromUtf16(u"\x00C9")},
-    {QStringLiteral("&Ecaron;"), QString::fromUtf16(u"\x011A")},
-    {QStringLiteral("&Ecirc"), QString::fromUtf16(u"\x00CA")},
-    {QStringLiteral("&Ecirc;"), QString::fromUtf16(u"\x00CA")},
-    {QStringLiteral("&Ecy;"), QString::fromUtf16(u"\x042D")},
-    {QStringLiteral("&Edot;"), QString::fromUtf16(u"\x0116")},
-    {QStringLiteral("&Efr;"), QString::fromUtf16(u"\xD835\xDD08")},
-    {QStringLiteral("&Egrave"), QString::fromUtf16(u"\x00C8")},
-    {QStringLiteral("&Egrave;"), QString::fromUtf16(u"\x00C8")},
-    {QStringLiteral("&Element;"), QString::fromUtf16(u"\x2208")},
-    {QStringLiteral("&Emacr;"), QString::fromUtf16(u"\x0112")},
-    {QStringLiteral("&EmptySmallSquare;"), QString::fromUtf16(u"\x25FB")},
-    {QStringLiteral("&EmptyVerySmallSquare;"), QString::fromUtf16(u"\x25AB")},
-    {QStringLiteral("&Eogon;"), QString::fromUtf16(u"\x0118")},
-    {QStringLiteral("&Eopf;"), QString::fromUtf16(u"\xD835\xDD3C")},
-    {QStringLiteral("&Epsilon;"), QString::fromUtf16(u"\x0395")},
-    {QStringLiteral("&Equal;"), QString::fromUtf16(u"\x2A75")},
-    {QStringLiteral("&EqualTilde;"), QString::fromUtf16(u"\x2242")},
-    {QStringLiteral("&Equilibrium;"), QString::fromUtf16(u"\x21CC")},
-    {QStringLiteral("&Escr;"), QString::fromUtf16(u"\x2130")},
-    {QStringLiteral("&Esim;"), QString::fromUtf16(u"\x2A73")},
-    {QStringLiteral("&Eta;"), QString::fromUtf16(u"\x0397")},
-    {QStringLiteral("&Euml"), QString::fromUtf16(u"\x00CB")},
-    {QStringLiteral("&Euml;"), QString::fromUtf16(u"\x00CB")},
-    {QStringLiteral("&Exists;"), QString::fromUtf16(u"\x2203")},
-    {QStringLiteral("&ExponentialE;"), QString::fromUtf16(u"\x2147")},
-    {QStringLiteral("&Fcy;"), QString::fromUtf16(u"\x0424")},
-    {QStringLiteral("&Ffr;"), QString::fromUtf16(u"\xD835\xDD09")},
-    {QStringLiteral("&FilledSmallSquare;"), QString::fromUtf16(u"\x25FC")},
-    {QStringLiteral("&FilledVerySmallSquare;"), QString::fromUtf16(u"\x25AA")},
-    {QStringLiteral("&Fopf;"), QString::fromUtf16(u"\xD835\xDD3D")},
-    {QStringLiteral("&ForAll;"), QString::fromUtf16(u"\x2200")},
-    {QStringLiteral("&Fouriertrf;"), QString::fromUtf16(u"\x2131")},
-    {QStringLiteral("&Fscr;"), QString::fromUtf16(u"\x2131")},
-    {QStringLiteral("&GJcy;"), QString::fromUtf16(u"\x0403")},
-    {QStringLiteral("&GT"), QString::fromUtf16(u"\x003E")},
-    {QStringLiteral("&GT;"), QString::fromUtf16(u"\x003E")},
-    {QStringLiteral("&Gamma;"), QString::fromUtf16(u"\x0393")},
-    {QStringLiteral("&Gammad;"), QString::fromUtf16(u"\x03DC")},
-    {QStringLiteral("&Gbreve;"), QString::fromUtf16(u"\x011E")},
-    {QStringLiteral("&Gcedil;"), QString::fromUtf16(u"\x0122")},
-    {QStringLiteral("&Gcirc;"), QString::fromUtf16(u"\x011C")},
-    {QStringLiteral("&Gcy;"), QString::fromUtf16(u"\x0413")},
-    {QStringLiteral("&Gdot;"), QString::fromUtf16(u"\x0120")},
-    {QStringLiteral("&Gfr;"), QString::fromUtf16(u"\xD835\xDD0A")},
-    {QStringLiteral("&Gg;"), QString::fromUtf16(u"\x22D9")},
-    {QStringLiteral("&Gopf;"), QString::fromUtf16(u"\xD835\xDD3E")},
-    {QStringLiteral("&GreaterEqual;"), QString::fromUtf16(u"\x2265")},
-    {QStringLiteral("&GreaterEqualLess;"), QString::fromUtf16(u"\x22DB")},
-    {QStringLiteral("&GreaterFullEqual;"), QString::fromUtf16(u"\x2267")},
-    {QStringLiteral("&GreaterGreater;"), QString::fromUtf16(u"\x2AA2")},
-    {QStringLiteral("&GreaterLess;"), QString::fromUtf16(u"\x2277")},
-    {QStringLiteral("&GreaterSlantEqual;"), QString::fromUtf16(u"\x2A7E")},
-    {QStringLiteral("&GreaterTilde;"), QString::fromUtf16(u"\x2273")},
-    {QStringLiteral("&Gscr;"), QString::fromUtf16(u"\xD835\xDCA2")},
-    {QStringLiteral("&Gt;"), QString::fromUtf16(u"\x226B")},
-    {QStringLiteral("&HARDcy;"), QString::fromUtf16(u"\x042A")},
-    {QStringLiteral("&Hacek;"), QString::fromUtf16(u"\x02C7")},
-    {QStringLiteral("&Hat;"), QString::fromUtf16(u"\x005E")},
-    {QStringLiteral("&Hcirc;"), QString::fromUtf16(u"\x0124")},
-    {QStringLiteral("&Hfr;"), QString::fromUtf16(u"\x210C")},
-    {QStringLiteral("&HilbertSpace;"), QString::fromUtf16(u"\x210B")},
-    {QStringLiteral("&Hopf;"), QString::fromUtf16(u"\x210D")},
-    {QStringLiteral("&HorizontalLine;"), QString::fromUtf16(u"\x2500")},
-    {QStringLiteral("&Hscr;"), QString::fromUtf16(u"\x210B")},
-    {QStringLiteral("&Hstrok;"), QString::fromUtf16(u"\x0126")},
-    {QStringLiteral("&HumpDownHump;"), QString::fromUtf16(u"\x224E")},
-    {QStringLiteral("&HumpEqual;"), QString::fromUtf16(u"\x224F")},
-    {QStringLiteral("&IEcy;"), QString::fromUtf16(u"\x0415")},
-    {QStringLiteral("&IJlig;"), QString::fromUtf16(u"\x0132")},
-    {QStringLiteral("&IOcy;"), QString::fromUtf16(u"\x0401")},
-    {QStringLiteral("&Iacute"), QString::fromUtf16(u"\x00CD")},
-    {QStringLiteral("&Iacute;"), QString::fromUtf16(u"\x00CD")},
-    {QStringLiteral("&Icirc"), QString::fromUtf16(u"\x00CE")},
-    {QStringLiteral("&Icirc;"), QString::fromUtf16(u"\x00CE")},
-    {QStringLiteral("&Icy;"), QString::fromUtf16(u"\x0418")},
-    {QStringLiteral("&Idot;"), QString::fromUtf16(u"\x0130")},
-    {QStringLiteral("&Ifr;"), QString::fromUtf16(u"\x2111")},
-    {QStringLiteral("&Igrave"), QString::fromUtf16(u"\x00CC")},
-    {QStringLiteral("&Igrave;"), QString::fromUtf16(u"\x00CC")},
-    {QStringLiteral("&Im;"), QString::fromUtf16(u"\x2111")},
-    {QStringLiteral("&Imacr;"), QString::fromUtf16(u"\x012A")},
-    {QStringLiteral("&ImaginaryI;"), QString::fromUtf16(u"\x2148")},
-    {QStringLiteral("&Implies;"), QString::fromUtf16(u"\x21D2")},
-    {QStringLiteral("&Int;"), QString::fromUtf16(u"\x222C")},
-    {QStringLiteral("&Integral;"), QString::fromUtf16(u"\x222B")},
-    {QStringLiteral("&Intersection;"), QString::fromUtf16(u"\x22C2")},
-    {QStringLiteral("&InvisibleComma;"), QString::fromUtf16(u"\x2063")},
-    {QStringLiteral("&InvisibleTimes;"), QString::fromUtf16(u"\x2062")},
-    {QStringLiteral("&Iogon;"), QString::fromUtf16(u"\x012E")},
-    {QStringLiteral("&Iopf;"), QString::fromUtf16(u"\xD835\xDD40")},
-    {QStringLiteral("&Iota;"), QString::fromUtf16(u"\x0399")},
-    {QStringLiteral("&Iscr;"), QString::fromUtf16(u"\x2110")},
-    {QStringLiteral("&Itilde;"), QString::fromUtf16(u"\x0128")},
-    {QStringLiteral("&Iukcy;"), QString::fromUtf16(u"\x0406")},
-    {QStringLiteral("&Iuml"), QString::fromUtf16(u"\x00CF")},
-    {QStringLiteral("&Iuml;"), QString::fromUtf16(u"\x00CF")},
-    {QStringLiteral("&Jcirc;"), QString::fromUtf16(u"\x0134")},
-    {QStringLiteral("&Jcy;"), QString::fromUtf16(u"\x0419")},
-    {QStringLiteral("&Jfr;"), QString::fromUtf16(u"\xD835\xDD0D")},
-    {QStringLiteral("&Jopf;"), QString::fromUtf16(u"\xD835\xDD41")},
-    {QStringLiteral("&Jscr;"), QString::fromUtf16(u"\xD835\xDCA5")},
-    {QStringLiteral("&Jsercy;"), QString::fromUtf16(u"\x0408")},
-    {QStringLiteral("&Jukcy;"), QString::fromUtf16(u"\x0404")},
-    {QStringLiteral("&KHcy;"), QString::fromUtf16(u"\x0425")},
-    {QStringLiteral("&KJcy;"), QString::fromUtf16(u"\x040C")},
-    {QStringLiteral("&Kappa;"), QString::fromUtf16(u"\x039A")},
-    {QStringLiteral("&Kcedil;"), QString::fromUtf16(u"\x0136")},
-    {QStringLiteral("&Kcy;"), QString::fromUtf16(u"\x041A")},
-    {QStringLiteral("&Kfr;"), QString::fromUtf16(u"\xD835\xDD0E")},
-    {QStringLiteral("&Kopf;"), QString::fromUtf16(u"\xD835\xDD42")},
-    {QStringLiteral("&Kscr;"), QString::fromUtf16(u"\xD835\xDCA6")},
-    {QStringLiteral("&LJcy;"), QString::fromUtf16(u"\x0409")},
-    {QStringLiteral("&LT"), QString::fromUtf16(u"\x003C")},
-    {QStringLiteral("&LT;"), QString::fromUtf16(u"\x003C")},
-    {QStringLiteral("&Lacute;"), QString::fromUtf16(u"\x0139")},
-    {QStringLiteral("&Lambda;"), QString::fromUtf16(u"\x039B")},
-    {QStringLiteral("&Lang;"), QString::fromUtf16(u"\x27EA")},
-    {QStringLiteral("&Laplacetrf;"), QString::fromUtf16(u"\x2112")},
-    {QStringLiteral("&Larr;"), QString::fromUtf16(u"\x219E")},
-    {QStringLiteral("&Lcaron;"), QString::fromUtf16(u"\x013D")},
-    {QStringLiteral("&Lcedil;"), QString::fromUtf16(u"\x013B")},
-    {QStringLiteral("&Lcy;"), QString::fromUtf16(u"\x041B")},
-    {QStringLiteral("&LeftAngleBracket;"), QString::fromUtf16(u"\x27E8")},
-    {QStringLiteral("&LeftArrow;"), QString::fromUtf16(u"\x2190")},
-    {QStringLiteral("&LeftArrowBar;"), QString::fromUtf16(u"\x21E4")},
-    {QStringLiteral("&LeftArrowRightArrow;"), QString::fromUtf16(u"\x21C6")},
-    {QStringLiteral("&LeftCeiling;"), QString::fromUtf16(u"\x2308")},
-    {QStringLiteral("&LeftDoubleBracket;"), QString::fromUtf16(u"\x27E6")},
-    {QStringLiteral("&LeftDownTeeVector;"), QString::fromUtf16(u"\x2961")},
-    {QStringLiteral("&LeftDownVector;"), QString::fromUtf16(u"\x21C3")},
-    {QStringLiteral("&LeftDownVectorBar;"), QString::fromUtf16(u"\x2959")},
-    {QStringLiteral("&LeftFloor;"), QString::fromUtf16(u"\x230A")},
-    {QStringLiteral("&LeftRightArrow;"), QString::fromUtf16(u"\x2194")},
-    {QStringLiteral("&LeftRightVector;"), QString::fromUtf16(u"\x294E")},
-    {QStringLiteral("&LeftTee;"), QString::fromUtf16(u"\x22A3")},
-    {QStringLiteral("&LeftTeeArrow;"), QString::fromUtf16(u"\x21A4")},
-    {QStringLiteral("&LeftTeeVector;"), QString::fromUtf16(u"\x295A")},
-    {QStringLiteral("&LeftTriangle;"), QString::fromUtf16(u"\x22B2")},
-    {QStringLiteral("&LeftTriangleBar;"), QString::fromUtf16(u"\x29CF")},
-    {QStringLiteral("&LeftTriangleEqual;"), QString::fromUtf16(u"\x22B4")},
-    {QStringLiteral("&LeftUpDownVector;"), QString::fromUtf16(u"\x2951")},
-    {QStringLiteral("&LeftUpTeeVector;"), QString::fromUtf16(u"\x2960")},
-    {QStringLiteral("&LeftUpVector;"), QString::fromUtf16(u"\x21BF")},
-    {QStringLiteral("&LeftUpVectorBar;"), QString::fromUtf16(u"\x2958")},
-    {QStringLiteral("&LeftVector;"), QString::fromUtf16(u"\x21BC")},
-    {QStringLiteral("&LeftVectorBar;"), QString::fromUtf16(u"\x2952")},
-    {QStringLiteral("&Leftarrow;"), QString::fromUtf16(u"\x21D0")},
-    {QStringLiteral("&Leftrightarrow;"), QString::fromUtf16(u"\x21D4")},
-    {QStringLiteral("&LessEqualGreater;"), QString::fromUtf16(u"\x22DA")},
-    {QStringLiteral("&LessFullEqual;"), QString::fromUtf16(u"\x2266")},
-    {QStringLiteral("&LessGreater;"), QString::fromUtf16(u"\x2276")},
-    {QStringLiteral("&LessLess;"), QString::fromUtf16(u"\x2AA1")},
-    {QStringLiteral("&LessSlantEqual;"), QString::fromUtf16(u"\x2A7D")},
-    {QStringLiteral("&LessTilde;"), QString::fromUtf16(u"\x2272")},
-    {QStringLiteral("&Lfr;"), QString::fromUtf16(u"\xD835\xDD0F")},
-    {QStringLiteral("&Ll;"), QString::fromUtf16(u"\x22D8")},
-    {QStringLiteral("&Lleftarrow;"), QString::fromUtf16(u"\x21DA")},
-    {QStringLiteral("&Lmidot;"), QString::fromUtf16(u"\x013F")},
-    {QStringLiteral("&LongLeftArrow;"), QString::fromUtf16(u"\x27F5")},
-    {QStringLiteral("&LongLeftRightArrow;"), QString::fromUtf16(u"\x27F7")},
-    {QStringLiteral("&LongRightArrow;"), QString::fromUtf16(u"\x27F6")},
-    {QStringLiteral("&Longleftarrow;"), QString::fromUtf16(u"\x27F8")},
-    {QStringLiteral("&Longleftrightarrow;"), QString::fromUtf16(u"\x27FA")},
-    {QStringLiteral("&Longrightarrow;"), QString::fromUtf16(u"\x27F9")},
-    {QStringLiteral("&Lopf;"), QString::fromUtf16(u"\xD835\xDD43")},
-    {QStringLiteral("&LowerLeftArrow;"), QString::fromUtf16(u"\x2199")},
-    {QStringLiteral("&LowerRightArrow;"), QString::fromUtf16(u"\x2198")},
-    {QStringLiteral("&Lscr;"), QString::fromUtf16(u"\x2112")},
-    {QStringLiteral("&Lsh;"), QString::fromUtf16(u"\x21B0")},
-    {QStringLiteral("&Lstrok;"), QString::fromUtf16(u"\x0141")},
-    {QStringLiteral("&Lt;"), QString::fromUtf16(u"\x226A")},
-    {QStringLiteral("&Map;"), QString::fromUtf16(u"\x2905")},
-    {QStringLiteral("&Mcy;"), QString::fromUtf16(u"\x041C")},
-    {QStringLiteral("&MediumSpace;"), QString::fromUtf16(u"\x205F")},
-    {QStringLiteral("&Mellintrf;"), QString::fromUtf16(u"\x2133")},
-    {QStringLiteral("&Mfr;"), QString::fromUtf16(u"\xD835\xDD10")},
-    {QStringLiteral("&MinusPlus;"), QString::fromUtf16(u"\x2213")},
-    {QStringLiteral("&Mopf;"), QString::fromUtf16(u"\xD835\xDD44")},
-    {QStringLiteral("&Mscr;"), QString::fromUtf16(u"\x2133")},
-    {QStringLiteral("&Mu;"), QString::fromUtf16(u"\x039C")},
-    {QStringLiteral("&NJcy;"), QString::fromUtf16(u"\x040A")},
-    {QStringLiteral("&Nacute;"), QString::fromUtf16(u"\x0143")},
-    {QStringLiteral("&Ncaron;"), QString::fromUtf16(u"\x0147")},
-    {QStringLiteral("&Ncedil;"), QString::fromUtf16(u"\x0145")},
-    {QStringLiteral("&Ncy;"), QString::fromUtf16(u"\x041D")},
-    {QStringLiteral("&NegativeMediumSpace;"), QString::fromUtf16(u"\x200B")},
-    {QStringLiteral("&NegativeThickSpace;"), QString::fromUtf16(u"\x200B")},
-    {QStringLiteral("&NegativeThinSpace;"), QString::fromUtf16(u"\x200B")},
-    {QStringLiteral("&NegativeVeryThinSpace;"), QString::fromUtf16(u"\x200B")},
-    {QStringLiteral("&NestedGreaterGreater;"), QString::fromUtf16(u"\x226B")},
-    {QStringLiteral("&NestedLessLess;"), QString::fromUtf16(u"\x226A")},
-    {QStringLiteral("&NewLine;"), QString::fromUtf16(u"\x000A")},
-    {QStringLiteral("&Nfr;"), QString::fromUtf16(u"\xD835\xDD11")},
-    {QStringLiteral("&NoBreak;"), QString::fromUtf16(u"\x2060")},
-    {QStringLiteral("&NonBreakingSpace;"), QString::fromUtf16(u"\x00A0")},
-    {QStringLiteral("&Nopf;"), QString::fromUtf16(u"\x2115")},
-    {QStringLiteral("&Not;"), QString::fromUtf16(u"\x2AEC")},
-    {QStringLiteral("&NotCongruent;"), QString::fromUtf16(u"\x2262")},
-    {QStringLiteral("&NotCupCap;"), QString::fromUtf16(u"\x226D")},
-    {QStringLiteral("&NotDoubleVerticalBar;"), QString::fromUtf16(u"\x2226")},
-    {QStringLiteral("&NotElement;"), QString::fromUtf16(u"\x2209")},
-    {QStringLiteral("&NotEqual;"), QString::fromUtf16(u"\x2260")},
-    {QStringLiteral("&NotEqualTilde;"), QString::fromUtf16(u"\x2242\x0338")},
-    {QStringLiteral("&NotExists;"), QString::fromUtf16(u"\x2204")},
-    {QStringLiteral("&NotGreater;"), QString::fromUtf16(u"\x226F")},
-    {QStringLiteral("&NotGreaterEqual;"), QString::fromUtf16(u"\x2271")},
-    {QStringLiteral("&NotGreaterFullEqual;"), QString::fromUtf16(u"\x2267\x0338")},
-    {QStringLiteral("&NotGreaterGreater;"), QString::fromUtf16(u"\x226B\x0338")},
-    {QStringLiteral("&NotGreaterLess;"), QString::fromUtf16(u"\x2279")},
-    {QStringLiteral("&NotGreaterSlantEqual;"), QString::fromUtf16(u"\x2A7E\x0338")},
-    {QStringLiteral("&NotGreaterTilde;"), QString::fromUtf16(u"\x2275")},
-    {QStringLiteral("&NotHumpDownHump;"), QString::fromUtf16(u"\x224E\x0338")},
-    {QStringLiteral("&NotHumpEqual;"), QString::fromUtf16(u"\x224F\x0338")},
-    {QStringLiteral("&NotLeftTriangle;"), QString::fromUtf16(u"\x22EA")},
-    {QStringLiteral("&NotLeftTriangleBar;"), QString::fromUtf16(u"\x29CF\x0338")},
-    {QStringLiteral("&NotLeftTriangleEqual;"), QString::fromUtf16(u"\x22EC")},
-    {QStringLiteral("&NotLess;"), QString::fromUtf16(u"\x226E")},
-    {QStringLiteral("&NotLessEqual;"), QString::fromUtf16(u"\x2270")},
-    {QStringLiteral("&NotLessGreater;"), QString::fromUtf16(u"\x2278")},
-    {QStringLiteral("&NotLessLess;"), QString::fromUtf16(u"\x226A\x0338")},
-    {QStringLiteral("&NotLessSlantEqual;"), QString::fromUtf16(u"\x2A7D\x0338")},
-    {QStringLiteral("&NotLessTilde;"), QString::fromUtf16(u"\x2274")},
-    {QStringLiteral("&NotNestedGreaterGreater;"), QString::fromUtf16(u"\x2AA2\x0338")},
-    {QStringLiteral("&NotNestedLessLess;"), QString::fromUtf16(u"\x2AA1\x0338")},
-    {QStringLiteral("&NotPrecedes;"), QString::fromUtf16(u"\x2280")},
-    {QStringLiteral("&NotPrecedesEqual;"), QString::fromUtf16(u"\x2AAF\x0338")},
-    {QStringLiteral("&NotPrecedesSlantEqual;"), QString::fromUtf16(u"\x22E0")},
-    {QStringLiteral("&NotReverseElement;"), QString::fromUtf16(u"\x220C")},
-    {QStringLiteral("&NotRightTriangle;"), QString::fromUtf16(u"\x22EB")},
-    {QStringLiteral("&NotRightTriangleBar;"), QString::fromUtf16(u"\x29D0\x0338")},
-    {QStringLiteral("&NotRightTriangleEqual;"), QString::fromUtf16(u"\x22ED")},
-    {QStringLiteral("&NotSquareSubset;"), QString::fromUtf16(u"\x228F\x0338")},
-    {QStringLiteral("&NotSquareSubsetEqual;"), QString::fromUtf16(u"\x22E2")},
-    {QStringLiteral("&NotSquareSuperset;"), QString::fromUtf16(u"\x2290\x0338")},
-    {QStringLiteral("&NotSquareSupersetEqual;"), QString::fromUtf16(u"\x22E3")},
-    {QStringLiteral("&NotSubset;"), QString::fromUtf16(u"\x2282\x20D2")},
-    {QStringLiteral("&NotSubsetEqual;"), QString::fromUtf16(u"\x2288")},
-    {QStringLiteral("&NotSucceeds;"), QString::fromUtf16(u"\x2281")},
-    {QStringLiteral("&NotSucceedsEqual;"), QString::fromUtf16(u"\x2AB0\x0338")},
-    {QStringLiteral("&NotSucceedsSlantEqual;"), QString::fromUtf16(u"\x22E1")},
-    {QStringLiteral("&NotSucceedsTilde;"), QString::fromUtf16(u"\x227F\x0338")},
-    {QStringLiteral("&NotSuperset;"), QString::fromUtf16(u"\x2283\x20D2")},
-    {QStringLiteral("&NotSupersetEqual;"), QString::fromUtf16(u"\x2289")},
-    {QStringLiteral("&NotTilde;"), QString::fromUtf16(u"\x2241")},
-    {QStringLiteral("&NotTildeEqual;"), QString::fromUtf16(u"\x2244")},
-    {QStringLiteral("&NotTildeFullEqual;"), QString::fromUtf16(u"\x2247")},
-    {QStringLiteral("&NotTildeTilde;"), QString::fromUtf16(u"\x2249")},
-    {QStringLiteral("&NotVerticalBar;"), QString::fromUtf16(u"\x2224")},
-    {QStringLiteral("&Nscr;"), QString::fromUtf16(u"\xD835\xDCA9")},
-    {QStringLiteral("&Ntilde"), QString::fromUtf16(u"\x00D1")},
-    {QStringLiteral("&Ntilde;"), QString::fromUtf16(u"\x00D1")},
-    {QStringLiteral("&Nu;"), QString::fromUtf16(u"\x039D")},
-    {QStringLiteral("&OElig;"), QString::fromUtf16(u"\x0152")},
-    {QStringLiteral("&Oacute"), QString::fromUtf16(u"\x00D3")},
-    {QStringLiteral("&Oacute;"), QString::fromUtf16(u"\x00D3")},
-    {QStringLiteral("&Ocirc"), QString::fromUtf16(u"\x00D4")},
-    {QStringLiteral("&Ocirc;"), QString::fromUtf16(u"\x00D4")},
-    {QStringLiteral("&Ocy;"), QString::fromUtf16(u"\x041E")},
-    {QStringLiteral("&Odblac;"), QString::fromUtf16(u"\x0150")},
-    {QStringLiteral("&Ofr;"), QString::fromUtf16(u"\xD835\xDD12")},
-    {QStringLiteral("&Ograve"), QString::fromUtf16(u"\x00D2")},
-    {QStringLiteral("&Ograve;"), QString::fromUtf16(u"\x00D2")},
-    {QStringLiteral("&Omacr;"), QString::fromUtf16(u"\x014C")},
-    {QStringLiteral("&Omega;"), QString::fromUtf16(u"\x03A9")},
-    {QStringLiteral("&Omicron;"), QString::fromUtf16(u"\x039F")},
-    {QStringLiteral("&Oopf;"), QString::fromUtf16(u"\xD835\xDD46")},
-    {QStringLiteral("&OpenCurlyDoubleQuote;"), QString::fromUtf16(u"\x201C")},
-    {QStringLiteral("&OpenCurlyQuote;"), QString::fromUtf16(u"\x2018")},
-    {QStringLiteral("&Or;"), QString::fromUtf16(u"\x2A54")},
-    {QStringLiteral("&Oscr;"), QString::fromUtf16(u"\xD835\xDCAA")},
-    {QStringLiteral("&Oslash"), QString::fromUtf16(u"\x00D8")},
-    {QStringLiteral("&Oslash;"), QString::fromUtf16(u"\x00D8")},
-    {QStringLiteral("&Otilde"), QString::fromUtf16(u"\x00D5")},
-    {QStringLiteral("&Otilde;"), QString::fromUtf16(u"\x00D5")},
-    {QStringLiteral("&Otimes;"), QString::fromUtf16(u"\x2A37")},
-    {QStringLiteral("&Ouml"), QString::fromUtf16(u"\x00D6")},
-    {QStringLiteral("&Ouml;"), QString::fromUtf16(u"\x00D6")},
-    {QStringLiteral("&OverBar;"), QString::fromUtf16(u"\x203E")},
-    {QStringLiteral("&OverBrace;"), QString::fromUtf16(u"\x23DE")},
-    {QStringLiteral("&OverBracket;"), QString::fromUtf16(u"\x23B4")},
-    {QStringLiteral("&OverParenthesis;"), QString::fromUtf16(u"\x23DC")},
-    {QStringLiteral("&PartialD;"), QString::fromUtf16(u"\x2202")},
-    {QStringLiteral("&Pcy;"), QString::fromUtf16(u"\x041F")},
-    {QStringLiteral("&Pfr;"), QString::fromUtf16(u"\xD835\xDD13")},
-    {QStringLiteral("&Phi;"), QString::fromUtf16(u"\x03A6")},
-    {QStringLiteral("&Pi;"), QString::fromUtf16(u"\x03A0")},
-    {QStringLiteral("&PlusMinus;"), QString::fromUtf16(u"\x00B1")},
-    {QStringLiteral("&Poincareplane;"), QString::fromUtf16(u"\x210C")},
-    {QStringLiteral("&Popf;"), QString::fromUtf16(u"\x2119")},
-    {QStringLiteral("&Pr;"), QString::fromUtf16(u"\x2ABB")},
-    {QStringLiteral("&Precedes;"), QString::fromUtf16(u"\x227A")},
-    {QStringLiteral("&PrecedesEqual;"), QString::fromUtf16(u"\x2AAF")},
-    {QStringLiteral("&PrecedesSlantEqual;"), QString::fromUtf16(u"\x227C")},
-    {QStringLiteral("&PrecedesTilde;"), QString::fromUtf16(u"\x227E")},
-    {QStringLiteral("&Prime;"), QString::fromUtf16(u"\x2033")},
-    {QStringLiteral("&Product;"), QString::fromUtf16(u"\x220F")},
-    {QStringLiteral("&Proportion;"), QString::fromUtf16(u"\x2237")},
-    {QStringLiteral("&Proportional;"), QString::fromUtf16(u"\x221D")},
-    {QStringLiteral("&Pscr;"), QString::fromUtf16(u"\xD835\xDCAB")},
-    {QStringLiteral("&Psi;"), QString::fromUtf16(u"\x03A8")},
-    {QStringLiteral("&QUOT"), QString::fromUtf16(u"\x0022")},
-    {QStringLiteral("&QUOT;"), QString::fromUtf16(u"\x0022")},
-    {QStringLiteral("&Qfr;"), QString::fromUtf16(u"\xD835\xDD14")},
-    {QStringLiteral("&Qopf;"), QString::fromUtf16(u"\x211A")},
-    {QStringLiteral("&Qscr;"), QString::fromUtf16(u"\xD835\xDCAC")},
-    {QStringLiteral("&RBarr;"), QString::fromUtf16(u"\x2910")},
-    {QStringLiteral("&REG"), QString::fromUtf16(u"\x00AE")},
-    {QStringLiteral("&REG;"), QString::fromUtf16(u"\x00AE")},
-    {QStringLiteral("&Racute;"), QString::fromUtf16(u"\x0154")},
-    {QStringLiteral("&Rang;"), QString::fromUtf16(u"\x27EB")},
-    {QStringLiteral("&Rarr;"), QString::fromUtf16(u"\x21A0")},
-    {QStringLiteral("&Rarrtl;"), QString::fromUtf16(u"\x2916")},
-    {QStringLiteral("&Rcaron;"), QString::fromUtf16(u"\x0158")},
-    {QStringLiteral("&Rcedil;"), QString::fromUtf16(u"\x0156")},
-    {QStringLiteral("&Rcy;"), QString::fromUtf16(u"\x0420")},
-    {QStringLiteral("&Re;"), QString::fromUtf16(u"\x211C")},
-    {QStringLiteral("&ReverseElement;"), QString::fromUtf16(u"\x220B")},
-    {QStringLiteral("&ReverseEquilibrium;"), QString::fromUtf16(u"\x21CB")},
-    {QStringLiteral("&ReverseUpEquilibrium;"), QString::fromUtf16(u"\x296F")},
-    {QStringLiteral("&Rfr;"), QString::fromUtf16(u"\x211C")},
-    {QStringLiteral("&Rho;"), QString::fromUtf16(u"\x03A1")},
-    {QStringLiteral("&RightAngleBracket;"), QString::fromUtf16(u"\x27E9")},
-    {QStringLiteral("&RightArrow;"), QString::fromUtf16(u"\x2192")},
-    {QStringLiteral("&RightArrowBar;"), QString::fromUtf16(u"\x21E5")},
-    {QStringLiteral("&RightArrowLeftArrow;"), QString::fromUtf16(u"\x21C4")},
-    {QStringLiteral("&RightCeiling;"), QString::fromUtf16(u"\x2309")},
-    {QStringLiteral("&RightDoubleBracket;"), QString::fromUtf16(u"\x27E7")},
-    {QStringLiteral("&RightDownTeeVector;"), QString::fromUtf16(u"\x295D")},
-    {QStringLiteral("&RightDownVector;"), QString::fromUtf16(u"\x21C2")},
-    {QStringLiteral("&RightDownVectorBar;"), QString::fromUtf16(u"\x2955")},
-    {QStringLiteral("&RightFloor;"), QString::fromUtf16(u"\x230B")},
-    {QStringLiteral("&RightTee;"), QString::fromUtf16(u"\x22A2")},
-    {QStringLiteral("&RightTeeArrow;"), QString::fromUtf16(u"\x21A6")},
-    {QStringLiteral("&RightTeeVector;"), QString::fromUtf16(u"\x295B")},
-    {QStringLiteral("&RightTriangle;"), QString::fromUtf16(u"\x22B3")},
-    {QStringLiteral("&RightTriangleBar;"), QString::fromUtf16(u"\x29D0")},
-    {QStringLiteral("&RightTriangleEqual;"), QString::fromUtf16(u"\x22B5")},
-    {QStringLiteral("&RightUpDownVector;"), QString::fromUtf16(u"\x294F")},
-    {QStringLiteral("&RightUpTeeVector;"), QString::fromUtf16(u"\x295C")},
-    {QStringLiteral("&RightUpVector;"), QString::fromUtf16(u"\x21BE")},
-    {QStringLiteral("&RightUpVectorBar;"), QString::fromUtf16(u"\x2954")},
-    {QStringLiteral("&RightVector;"), QString::fromUtf16(u"\x21C0")},
-    {QStringLiteral("&RightVectorBar;"), QString::fromUtf16(u"\x2953")},
-    {QStringLiteral("&Rightarrow;"), QString::fromUtf16(u"\x21D2")},
-    {QStringLiteral("&Ropf;"), QString::fromUtf16(u"\x211D")},
-    {QStringLiteral("&RoundImplies;"), QString::fromUtf16(u"\x2970")},
-    {QStringLiteral("&Rrightarrow;"), QString::fromUtf16(u"\x21DB")},
-    {QStringLiteral("&Rscr;"), QString::fromUtf16(u"\x211B")},
-    {QStringLiteral("&Rsh;"), QString::fromUtf16(u"\x21B1")},
-    {QStringLiteral("&RuleDelayed;"), QString::fromUtf16(u"\x29F4")},
-    {QStringLiteral("&SHCHcy;"), QString::fromUtf16(u"\x0429")},
-    {QStringLiteral("&SHcy;"), QString::fromUtf16(u"\x0428")},
-    {QStringLiteral("&SOFTcy;"), QString::fromUtf16(u"\x042C")},
-    {QStringLiteral("&Sacute;"), QString::fromUtf16(u"\x015A")},
-    {QStringLiteral("&Sc;"), QString::fromUtf16(u"\x2ABC")},
-    {QStringLiteral("&Scaron;"), QString::fromUtf16(u"\x0160")},
-    {QStringLiteral("&Scedil;"), QString::fromUtf16(u"\x015E")},
-    {QStringLiteral("&Scirc;"), QString::fromUtf16(u"\x015C")},
-    {QStringLiteral("&Scy;"), QString::fromUtf16(u"\x0421")},
-    {QStringLiteral("&Sfr;"), QString::fromUtf16(u"\xD835\xDD16")},
-    {QStringLiteral("&ShortDownArrow;"), QString::fromUtf16(u"\x2193")},
-    {QStringLiteral("&ShortLeftArrow;"), QString::fromUtf16(u"\x2190")},
-    {QStringLiteral("&ShortRightArrow;"), QString::fromUtf16(u"\x2192")},
-    {QStringLiteral("&ShortUpArrow;"), QString::fromUtf16(u"\x2191")},
-    {QStringLiteral("&Sigma;"), QString::fromUtf16(u"\x03A3")},
-    {QStringLiteral("&SmallCircle;"), QString::fromUtf16(u"\x2218")},
-    {QStringLiteral("&Sopf;"), QString::fromUtf16(u"\xD835\xDD4A")},
-    {QStringLiteral("&Sqrt;"), QString::fromUtf16(u"\x221A")},
-    {QStringLiteral("&Square;"), QString::fromUtf16(u"\x25A1")},
-    {QStringLiteral("&SquareIntersection;"), QString::fromUtf16(u"\x2293")},
-    {QStringLiteral("&SquareSubset;"), QString::fromUtf16(u"\x228F")},
-    {QStringLiteral("&SquareSubsetEqual;"), QString::fromUtf16(u"\x2291")},
-    {QStringLiteral("&SquareSuperset;"), QString::fromUtf16(u"\x2290")},
-    {QStringLiteral("&SquareSupersetEqual;"), QString::fromUtf16(u"\x2292")},
-    {QStringLiteral("&SquareUnion;"), QString::fromUtf16(u"\x2294")},
-    {QStringLiteral("&Sscr;"), QString::fromUtf16(u"\xD835\xDCAE")},
-    {QStringLiteral("&Star;"), QString::fromUtf16(u"\x22C6")},
-    {QStringLiteral("&Sub;"), QString::fromUtf16(u"\x22D0")},
-    {QStringLiteral("&Subset;"), QString::fromUtf16(u"\x22D0")},
-    {QStringLiteral("&SubsetEqual;"), QString::fromUtf16(u"\x2286")},
-    {QStringLiteral("&Succeeds;"), QString::fromUtf16(u"\x227B")},
-    {QStringLiteral("&SucceedsEqual;"), QString::fromUtf16(u"\x2AB0")},
-    {QStringLiteral("&SucceedsSlantEqual;"), QString::fromUtf16(u"\x227D")},
-    {QStringLiteral("&SucceedsTilde;"), QString::fromUtf16(u"\x227F")},
-    {QStringLiteral("&SuchThat;"), QString::fromUtf16(u"\x220B")},
-    {QStringLiteral("&Sum;"), QString::fromUtf16(u"\x2211")},
-    {QStringLiteral("&Sup;"), QString::fromUtf16(u"\x22D1")},
-    {QStringLiteral("&Superset;"), QString::fromUtf16(u"\x2283")},
-    {QStringLiteral("&SupersetEqual;"), QString::fromUtf16(u"\x2287")},
-    {QStringLiteral("&Supset;"), QString::fromUtf16(u"\x22D1")},
-    {QStringLiteral("&THORN"), QString::fromUtf16(u"\x00DE")},
-    {QStringLiteral("&THORN;"), QString::fromUtf16(u"\x00DE")},
-    {QStringLiteral("&TRADE;"), QString::fromUtf16(u"\x2122")},
-    {QStringLiteral("&TSHcy;"), QString::fromUtf16(u"\x040B")},
-    {QStringLiteral("&TScy;"), QString::fromUtf16(u"\x0426")},
-    {QStringLiteral("&Tab;"), QString::fromUtf16(u"\x0009")},
-    {QStringLiteral("&Tau;"), QString::fromUtf16(u"\x03A4")},
-    {QStringLiteral("&Tcaron;"), QString::fromUtf16(u"\x0164")},
-    {QStringLiteral("&Tcedil;"), QString::fromUtf16(u"\x0162")},
-    {QStringLiteral("&Tcy;"), QString::fromUtf16(u"\x0422")},
-    {QStringLiteral("&Tfr;"), QString::fromUtf16(u"\xD835\xDD17")},
-    {QStringLiteral("&Therefore;"), QString::fromUtf16(u"\x2234")},
-    {QStringLiteral("&Theta;"), QString::fromUtf16(u"\x0398")},
-    {QStringLiteral("&ThickSpace;"), QString::fromUtf16(u"\x205F\x200A")},
-    {QStringLiteral("&ThinSpace;"), QString::fromUtf16(u"\x2009")},
-    {QStringLiteral("&Tilde;"), QString::fromUtf16(u"\x223C")},
-    {QStringLiteral("&TildeEqual;"), QString::fromUtf16(u"\x2243")},
-    {QStringLiteral("&TildeFullEqual;"), QString::fromUtf16(u"\x2245")},
-    {QStringLiteral("&TildeTilde;"), QString::fromUtf16(u"\x2248")},
-    {QStringLiteral("&Topf;"), QString::fromUtf16(u"\xD835\xDD4B")},
-    {QStringLiteral("&TripleDot;"), QString::fromUtf16(u"\x20DB")},
-    {QStringLiteral("&Tscr;"), QString::fromUtf16(u"\xD835\xDCAF")},
-    {QStringLiteral("&Tstrok;"), QString::fromUtf16(u"\x0166")},
-    {QStringLiteral("&Uacute"), QString::fromUtf16(u"\x00DA")},
-    {QStringLiteral("&Uacute;"), QString::fromUtf16(u"\x00DA")},
-    {QStringLiteral("&Uarr;"), QString::fromUtf16(u"\x219F")},
-    {QStringLiteral("&Uarrocir;"), QString::fromUtf16(u"\x2949")},
-    {QStringLiteral("&Ubrcy;"), QString::fromUtf16(u"\x040E")},
-    {QStringLiteral("&Ubreve;"), QString::fromUtf16(u"\x016C")},
-    {QStringLiteral("&Ucirc"), QString::fromUtf16(u"\x00DB")},
-    {QStringLiteral("&Ucirc;"), QString::fromUtf16(u"\x00DB")},
-    {QStringLiteral("&Ucy;"), QString::fromUtf16(u"\x0423")},
-    {QStringLiteral("&Udblac;"), QString::fromUtf16(u"\x0170")},
-    {QStringLiteral("&Ufr;"), QString::fromUtf16(u"\xD835\xDD18")},
-    {QStringLiteral("&Ugrave"), QString::fromUtf16(u"\x00D9")},
-    {QStringLiteral("&Ugrave;"), QString::fromUtf16(u"\x00D9")},
-    {QStringLiteral("&Umacr;"), QString::fromUtf16(u"\x016A")},
-    {QStringLiteral("&UnderBar;"), QString::fromUtf16(u"\x005F")},
-    {QStringLiteral("&UnderBrace;"), QString::fromUtf16(u"\x23DF")},
-    {QStringLiteral("&UnderBracket;"), QString::fromUtf16(u"\x23B5")},
-    {QStringLiteral("&UnderParenthesis;"), QString::fromUtf16(u"\x23DD")},
-    {QStringLiteral("&Union;"), QString::fromUtf16(u"\x22C3")},
-    {QStringLiteral("&UnionPlus;"), QString::fromUtf16(u"\x228E")},
-    {QStringLiteral("&Uogon;"), QString::fromUtf16(u"\x0172")},
-    {QStringLiteral("&Uopf;"), QString::fromUtf16(u"\xD835\xDD4C")},
-    {QStringLiteral("&UpArrow;"), QString::fromUtf16(u"\x2191")},
-    {QStringLiteral("&UpArrowBar;"), QString::fromUtf16(u"\x2912")},
-    {QStringLiteral("&UpArrowDownArrow;"), QString::fromUtf16(u"\x21C5")},
-    {QStringLiteral("&UpDownArrow;"), QString::fromUtf16(u"\x2195")},
-    {QStringLiteral("&UpEquilibrium;"), QString::fromUtf16(u"\x296E")},
-    {QStringLiteral("&UpTee;"), QString::fromUtf16(u"\x22A5")},
-    {QStringLiteral("&UpTeeArrow;"), QString::fromUtf16(u"\x21A5")},
-    {QStringLiteral("&Uparrow;"), QString::fromUtf16(u"\x21D1")},
-    {QStringLiteral("&Updownarrow;"), QString::fromUtf16(u"\x21D5")},
-    {QStringLiteral("&UpperLeftArrow;"), QString::fromUtf16(u"\x2196")},
-    {QStringLiteral("&UpperRightArrow;"), QString::fromUtf16(u"\x2197")},
-    {QStringLiteral("&Upsi;"), QString::fromUtf16(u"\x03D2")},
-    {QStringLiteral("&Upsilon;"), QString::fromUtf16(u"\x03A5")},
-    {QStringLiteral("&Uring;"), QString::fromUtf16(u"\x016E")},
-    {QStringLiteral("&Uscr;"), QString::fromUtf16(u"\xD835\xDCB0")},
-    {QStringLiteral("&Utilde;"), QString::fromUtf16(u"\x0168")},
-    {QStringLiteral("&Uuml"), QString::fromUtf16(u"\x00DC")},
-    {QStringLiteral("&Uuml;"), QString::fromUtf16(u"\x00DC")},
-    {QStringLiteral("&VDash;"), QString::fromUtf16(u"\x22AB")},
-    {QStringLiteral("&Vbar;"), QString::fromUtf16(u"\x2AEB")},
-    {QStringLiteral("&Vcy;"), QString::fromUtf16(u"\x0412")},
-    {QStringLiteral("&Vdash;"), QString::fromUtf16(u"\x22A9")},
-    {QStringLiteral("&Vdashl;"), QString::fromUtf16(u"\x2AE6")},
-    {QStringLiteral("&Vee;"), QString::fromUtf16(u"\x22C1")},
-    {QStringLiteral("&Verbar;"), QString::fromUtf16(u"\x2016")},
-    {QStringLiteral("&Vert;"), QString::fromUtf16(u"\x2016")},
-    {QStringLiteral("&VerticalBar;"), QString::fromUtf16(u"\x2223")},
-    {QStringLiteral("&VerticalLine;"), QString::fromUtf16(u"\x007C")},
-    {QStringLiteral("&VerticalSeparator;"), QString::fromUtf16(u"\x2758")},
-    {QStringLiteral("&VerticalTilde;"), QString::fromUtf16(u"\x2240")},
-    {QStringLiteral("&VeryThinSpace;"), QString::fromUtf16(u"\x200A")},
-    {QStringLiteral("&Vfr;"), QString::fromUtf16(u"\xD835\xDD19")},
-    {QStringLiteral("&Vopf;"), QString::fromUtf16(u"\xD835\xDD4D")},
-    {QStringLiteral("&Vscr;"), QString::fromUtf16(u"\xD835\xDCB1")},
-    {QStringLiteral("&Vvdash;"), QString::fromUtf16(u"\x22AA")},
-    {QStringLiteral("&Wcirc;"), QString::fromUtf16(u"\x0174")},
-    {QStringLiteral("&Wedge;"), QString::fromUtf16(u"\x22C0")},
-    {QStringLiteral("&Wfr;"), QString::fromUtf16(u"\xD835\xDD1A")},
-    {QStringLiteral("&Wopf;"), QString::fromUtf16(u"\xD835\xDD4E")},
-    {QStringLiteral("&Wscr;"), QString::fromUtf16(u"\xD835\xDCB2")},
-    {QStringLiteral("&Xfr;"), QString::fromUtf16(u"\xD835\xDD1B")},
-    {QStringLiteral("&Xi;"), QString::fromUtf16(u"\x039E")},
-    {QStringLiteral("&Xopf;"), QString::fromUtf16(u"\xD835\xDD4F")},
-    {QStringLiteral("&Xscr;"), QString::fromUtf16(u"\xD835\xDCB3")},
-    {QStringLiteral("&YAcy;"), QString::fromUtf16(u"\x042F")},
-    {QStringLiteral("&YIcy;"), QString::fromUtf16(u"\x0407")},
-    {QStringLiteral("&YUcy;"), QString::fromUtf16(u"\x042E")},
-    {QStringLiteral("&Yacute"), QString::fromUtf16(u"\x00DD")},
-    {QStringLiteral("&Yacute;"), QString::fromUtf16(u"\x00DD")},
-    {QStringLiteral("&Ycirc;"), QString::fromUtf16(u"\x0176")},
-    {QStringLiteral("&Ycy;"), QString::fromUtf16(u"\x042B")},
-    {QStringLiteral("&Yfr;"), QString::fromUtf16(u"\xD835\xDD1C")},
-    {QStringLiteral("&Yopf;"), QString::fromUtf16(u"\xD835\xDD50")},
-    {QStringLiteral("&Yscr;"), QString::fromUtf16(u"\xD835\xDCB4")},
-    {QStringLiteral("&Yuml;"), QString::fromUtf16(u"\x0178")},
-    {QStringLiteral("&ZHcy;"), QString::fromUtf16(u"\x0416")},
-    {QStringLiteral("&Zacute;"), QString::fromUtf16(u"\x0179")},
-    {QStringLiteral("&Zcaron;"), QString::fromUtf16(u"\x017D")},
-    {QStringLiteral("&Zcy;"), QString::fromUtf16(u"\x0417")},
-    {QStringLiteral("&Zdot;"), QString::fromUtf16(u"\x017B")},
-    {QStringLiteral("&ZeroWidthSpace;"), QString::fromUtf16(u"\x200B")},
-    {QStringLiteral("&Zeta;"), QString::fromUtf16(u"\x0396")},
-    {QStringLiteral("&Zfr;"), QString::fromUtf16(u"\x2128")},
-    {QStringLiteral("&Zopf;"), QString::fromUtf16(u"\x2124")},
-    {QStringLiteral("&Zscr;"), QString::fromUtf16(u"\xD835\xDCB5")},
-    {QStringLiteral("&aacute"), QString::fromUtf16(u"\x00E1")},
-    {QStringLiteral("&aacute;"), QString::fromUtf16(u"\x00E1")},
-    {QStringLiteral("&abreve;"), QString::fromUtf16(u"\x0103")},
-    {QStringLiteral("&ac;"), QString::fromUtf16(u"\x223E")},
-    {QStringLiteral("&acE;"), QString::fromUtf16(u"\x223E\x0333")},
-    {QStringLiteral("&acd;"), QString::fromUtf16(u"\x223F")},
-    {QStringLiteral("&acirc"), QString::fromUtf16(u"\x00E2")},
-    {QStringLiteral("&acirc;"), QString::fromUtf16(u"\x00E2")},
-    {QStringLiteral("&acute"), QString::fromUtf16(u"\x00B4")},
-    {QStringLiteral("&acute;"), QString::fromUtf16(u"\x00B4")},
-    {QStringLiteral("&acy;"), QString::fromUtf16(u"\x0430")},
-    {QStringLiteral("&aelig"), QString::fromUtf16(u"\x00E6")},
-    {QStringLiteral("&aelig;"), QString::fromUtf16(u"\x00E6")},
-    {QStringLiteral("&af;"), QString::fromUtf16(u"\x2061")},
-    {QStringLiteral("&afr;"), QString::fromUtf16(u"\xD835\xDD1E")},
-    {QStringLiteral("&agrave"), QString::fromUtf16(u"\x00E0")},
-    {QStringLiteral("&agrave;"), QString::fromUtf16(u"\x00E0")},
-    {QStringLiteral("&alefsym;"), QString::fromUtf16(u"\x2135")},
-    {QStringLiteral("&aleph;"), QString::fromUtf16(u"\x2135")},
-    {QStringLiteral("&alpha;"), QString::fromUtf16(u"\x03B1")},
-    {QStringLiteral("&amacr;"), QString::fromUtf16(u"\x0101")},
-    {QStringLiteral("&amalg;"), QString::fromUtf16(u"\x2A3F")},
-    {QStringLiteral("&amp"), QString::fromUtf16(u"\x0026")},
-    {QStringLiteral("&amp;"), QString::fromUtf16(u"\x0026")},
-    {QStringLiteral("&and;"), QString::fromUtf16(u"\x2227")},
-    {QStringLiteral("&andand;"), QString::fromUtf16(u"\x2A55")},
-    {QStringLiteral("&andd;"), QString::fromUtf16(u"\x2A5C")},
-    {QStringLiteral("&andslope;"), QString::fromUtf16(u"\x2A58")},
-    {QStringLiteral("&andv;"), QString::fromUtf16(u"\x2A5A")},
-    {QStringLiteral("&ang;"), QString::fromUtf16(u"\x2220")},
-    {QStringLiteral("&ange;"), QString::fromUtf16(u"\x29A4")},
-    {QStringLiteral("&angle;"), QString::fromUtf16(u"\x2220")},
-    {QStringLiteral("&angmsd;"), QString::fromUtf16(u"\x2221")},
-    {QStringLiteral("&angmsdaa;"), QString::fromUtf16(u"\x29A8")},
-    {QStringLiteral("&angmsdab;"), QString::fromUtf16(u"\x29A9")},
-    {QStringLiteral("&angmsdac;"), QString::fromUtf16(u"\x29AA")},
-    {QStringLiteral("&angmsdad;"), QString::fromUtf16(u"\x29AB")},
-    {QStringLiteral("&angmsdae;"), QString::fromUtf16(u"\x29AC")},
-    {QStringLiteral("&angmsdaf;"), QString::fromUtf16(u"\x29AD")},
-    {QStringLiteral("&angmsdag;"), QString::fromUtf16(u"\x29AE")},
-    {QStringLiteral("&angmsdah;"), QString::fromUtf16(u"\x29AF")},
-    {QStringLiteral("&angrt;"), QString::fromUtf16(u"\x221F")},
-    {QStringLiteral("&angrtvb;"), QString::fromUtf16(u"\x22BE")},
-    {QStringLiteral("&angrtvbd;"), QString::fromUtf16(u"\x299D")},
-    {QStringLiteral("&angsph;"), QString::fromUtf16(u"\x2222")},
-    {QStringLiteral("&angst;"), QString::fromUtf16(u"\x00C5")},
-    {QStringLiteral("&angzarr;"), QString::fromUtf16(u"\x237C")},
-    {QStringLiteral("&aogon;"), QString::fromUtf16(u"\x0105")},
-    {QStringLiteral("&aopf;"), QString::fromUtf16(u"\xD835\xDD52")},
-    {QStringLiteral("&ap;"), QString::fromUtf16(u"\x2248")},
-    {QStringLiteral("&apE;"), QString::fromUtf16(u"\x2A70")},
-    {QStringLiteral("&apacir;"), QString::fromUtf16(u"\x2A6F")},
-    {QStringLiteral("&ape;"), QString::fromUtf16(u"\x224A")},
-    {QStringLiteral("&apid;"), QString::fromUtf16(u"\x224B")},
-    {QStringLiteral("&apos;"), QString::fromUtf16(u"\x0027")},
-    {QStringLiteral("&approx;"), QString::fromUtf16(u"\x2248")},
-    {QStringLiteral("&approxeq;"), QString::fromUtf16(u"\x224A")},
-    {QStringLiteral("&aring"), QString::fromUtf16(u"\x00E5")},
-    {QStringLiteral("&aring;"), QString::fromUtf16(u"\x00E5")},
-    {QStringLiteral("&ascr;"), QString::fromUtf16(u"\xD835\xDCB6")},
-    {QStringLiteral("&ast;"), QString::fromUtf16(u"\x002A")},
-    {QStringLiteral("&asymp;"), QString::fromUtf16(u"\x2248")},
-    {QStringLiteral("&asympeq;"), QString::fromUtf16(u"\x224D")},
-    {QStringLiteral("&atilde"), QString::fromUtf16(u"\x00E3")},
-    {QStringLiteral("&atilde;"), QString::fromUtf16(u"\x00E3")},
-    {QStringLiteral("&auml"), QString::fromUtf16(u"\x00E4")},
-    {QStringLiteral("&auml;"), QString::fromUtf16(u"\x00E4")},
-    {QStringLiteral("&awconint;"), QString::fromUtf16(u"\x2233")},
-    {QStringLiteral("&awint;"), QString::fromUtf16(u"\x2A11")},
-    {QStringLiteral("&bNot;"), QString::fromUtf16(u"\x2AED")},
-    {QStringLiteral("&backcong;"), QString::fromUtf16(u"\x224C")},
-    {QStringLiteral("&backepsilon;"), QString::fromUtf16(u"\x03F6")},
-    {QStringLiteral("&backprime;"), QString::fromUtf16(u"\x2035")},
-    {QStringLiteral("&backsim;"), QString::fromUtf16(u"\x223D")},
-    {QStringLiteral("&backsimeq;"), QString::fromUtf16(u"\x22CD")},
-    {QStringLiteral("&barvee;"), QString::fromUtf16(u"\x22BD")},
-    {QStringLiteral("&barwed;"), QString::fromUtf16(u"\x2305")},
-    {QStringLiteral("&barwedge;"), QString::fromUtf16(u"\x2305")},
-    {QStringLiteral("&bbrk;"), QString::fromUtf16(u"\x23B5")},
-    {QStringLiteral("&bbrktbrk;"), QString::fromUtf16(u"\x23B6")},
-    {QStringLiteral("&bcong;"), QString::fromUtf16(u"\x224C")},
-    {QStringLiteral("&bcy;"), QString::fromUtf16(u"\x0431")},
-    {QStringLiteral("&bdquo;"), QString::fromUtf16(u"\x201E")},
-    {QStringLiteral("&becaus;"), QString::fromUtf16(u"\x2235")},
-    {QStringLiteral("&because;"), QString::fromUtf16(u"\x2235")},
-    {QStringLiteral("&bemptyv;"), QString::fromUtf16(u"\x29B0")},
-    {QStringLiteral("&bepsi;"), QString::fromUtf16(u"\x03F6")},
-    {QStringLiteral("&bernou;"), QString::fromUtf16(u"\x212C")},
-    {QStringLiteral("&beta;"), QString::fromUtf16(u"\x03B2")},
-    {QStringLiteral("&beth;"), QString::fromUtf16(u"\x2136")},
-    {QStringLiteral("&between;"), QString::fromUtf16(u"\x226C")},
-    {QStringLiteral("&bfr;"), QString::fromUtf16(u"\xD835\xDD1F")},
-    {QStringLiteral("&bigcap;"), QString::fromUtf16(u"\x22C2")},
-    {QStringLiteral("&bigcirc;"), QString::fromUtf16(u"\x25EF")},
-    {QStringLiteral("&bigcup;"), QString::fromUtf16(u"\x22C3")},
-    {QStringLiteral("&bigodot;"), QString::fromUtf16(u"\x2A00")},
-    {QStringLiteral("&bigoplus;"), QString::fromUtf16(u"\x2A01")},
-    {QStringLiteral("&bigotimes;"), QString::fromUtf16(u"\x2A02")},
-    {QStringLiteral("&bigsqcup;"), QString::fromUtf16(u"\x2A06")},
-    {QStringLiteral("&bigstar;"), QString::fromUtf16(u"\x2605")},
-    {QStringLiteral("&bigtriangledown;"), QString::fromUtf16(u"\x25BD")},
-    {QStringLiteral("&bigtriangleup;"), QString::fromUtf16(u"\x25B3")},
-    {QStringLiteral("&biguplus;"), QString::fromUtf16(u"\x2A04")},
-    {QStringLiteral("&bigvee;"), QString::fromUtf16(u"\x22C1")},
-    {QStringLiteral("&bigwedge;"), QString::fromUtf16(u"\x22C0")},
-    {QStringLiteral("&bkarow;"), QString::fromUtf16(u"\x290D")},
-    {QStringLiteral("&blacklozenge;"), QString::fromUtf16(u"\x29EB")},
-    {QStringLiteral("&blacksquare;"), QString::fromUtf16(u"\x25AA")},
-    {QStringLiteral("&blacktriangle;"), QString::fromUtf16(u"\x25B4")},
-    {QStringLiteral("&blacktriangledown;"), QString::fromUtf16(u"\x25BE")},
-    {QStringLiteral("&blacktriangleleft;"), QString::fromUtf16(u"\x25C2")},
-    {QStringLiteral("&blacktriangleright;"), QString::fromUtf16(u"\x25B8")},
-    {QStringLiteral("&blank;"), QString::fromUtf16(u"\x2423")},
-    {QStringLiteral("&blk12;"), QString::fromUtf16(u"\x2592")},
-    {QStringLiteral("&blk14;"), QString::fromUtf16(u"\x2591")},
-    {QStringLiteral("&blk34;"), QString::fromUtf16(u"\x2593")},
-    {QStringLiteral("&block;"), QString::fromUtf16(u"\x2588")},
-    {QStringLiteral("&bne;"), QString::fromUtf16(u"\x003D\x20E5")},
-    {QStringLiteral("&bnequiv;"), QString::fromUtf16(u"\x2261\x20E5")},
-    {QStringLiteral("&bnot;"), QString::fromUtf16(u"\x2310")},
-    {QStringLiteral("&bopf;"), QString::fromUtf16(u"\xD835\xDD53")},
-    {QStringLiteral("&bot;"), QString::fromUtf16(u"\x22A5")},
-    {QStringLiteral("&bottom;"), QString::fromUtf16(u"\x22A5")},
-    {QStringLiteral("&bowtie;"), QString::fromUtf16(u"\x22C8")},
-    {QStringLiteral("&boxDL;"), QString::fromUtf16(u"\x2557")},
-    {QStringLiteral("&boxDR;"), QString::fromUtf16(u"\x2554")},
-    {QStringLiteral("&boxDl;"), QString::fromUtf16(u"\x2556")},
-    {QStringLiteral("&boxDr;"), QString::fromUtf16(u"\x2553")},
-    {QStringLiteral("&boxH;"), QString::fromUtf16(u"\x2550")},
-    {QStringLiteral("&boxHD;"), QString::fromUtf16(u"\x2566")},
-    {QStringLiteral("&boxHU;"), QString::fromUtf16(u"\x2569")},
-    {QStringLiteral("&boxHd;"), QString::fromUtf16(u"\x2564")},
-    {QStringLiteral("&boxHu;"), QString::fromUtf16(u"\x2567")},
-    {QStringLiteral("&boxUL;"), QString::fromUtf16(u"\x255D")},
-    {QStringLiteral("&boxUR;"), QString::fromUtf16(u"\x255A")},
-    {QStringLiteral("&boxUl;"), QString::fromUtf16(u"\x255C")},
-    {QStringLiteral("&boxUr;"), QString::fromUtf16(u"\x2559")},
-    {QStringLiteral("&boxV;"), QString::fromUtf16(u"\x2551")},
-    {QStringLiteral("&boxVH;"), QString::fromUtf16(u"\x256C")},
-    {QStringLiteral("&boxVL;"), QString::fromUtf16(u"\x2563")},
-    {QStringLiteral("&boxVR;"), QString::fromUtf16(u"\x2560")},
-    {QStringLiteral("&boxVh;"), QString::fromUtf16(u"\x256B")},
-    {QStringLiteral("&boxVl;"), QString::fromUtf16(u"\x2562")},
-    {QStringLiteral("&boxVr;"), QString::fromUtf16(u"\x255F")},
-    {QStringLiteral("&boxbox;"), QString::fromUtf16(u"\x29C9")},
-    {QStringLiteral("&boxdL;"), QString::fromUtf16(u"\x2555")},
-    {QStringLiteral("&boxdR;"), QString::fromUtf16(u"\x2552")},
-    {QStringLiteral("&boxdl;"), QString::fromUtf16(u"\x2510")},
-    {QStringLiteral("&boxdr;"), QString::fromUtf16(u"\x250C")},
-    {QStringLiteral("&boxh;"), QString::fromUtf16(u"\x2500")},
-    {QStringLiteral("&boxhD;"), QString::fromUtf16(u"\x2565")},
-    {QStringLiteral("&boxhU;"), QString::fromUtf16(u"\x2568")},
-    {QStringLiteral("&boxhd;"), QString::fromUtf16(u"\x252C")},
-    {QStringLiteral("&boxhu;"), QString::fromUtf16(u"\x2534")},
-    {QStringLiteral("&boxminus;"), QString::fromUtf16(u"\x229F")},
-    {QStringLiteral("&boxplus;"), QString::fromUtf16(u"\x229E")},
-    {QStringLiteral("&boxtimes;"), QString::fromUtf16(u"\x22A0")},
-    {QStringLiteral("&boxuL;"), QString::fromUtf16(u"\x255B")},
-    {QStringLiteral("&boxuR;"), QString::fromUtf16(u"\x2558")},
-    {QStringLiteral("&boxul;"), QString::fromUtf16(u"\x2518")},
-    {QStringLiteral("&boxur;"), QString::fromUtf16(u"\x2514")},
-    {QStringLiteral("&boxv;"), QString::fromUtf16(u"\x2502")},
-    {QStringLiteral("&boxvH;"), QString::fromUtf16(u"\x256A")},
-    {QStringLiteral("&boxvL;"), QString::fromUtf16(u"\x2561")},
-    {QStringLiteral("&boxvR;"), QString::fromUtf16(u"\x255E")},
-    {QStringLiteral("&boxvh;"), QString::fromUtf16(u"\x253C")},
-    {QStringLiteral("&boxvl;"), QString::fromUtf16(u"\x2524")},
-    {QStringLiteral("&boxvr;"), QString::fromUtf16(u"\x251C")},
-    {QStringLiteral("&bprime;"), QString::fromUtf16(u"\x2035")},
-    {QStringLiteral("&breve;"), QString::fromUtf16(u"\x02D8")},
-    {QStringLiteral("&brvbar"), QString::fromUtf16(u"\x00A6")},
-    {QStringLiteral("&brvbar;"), QString::fromUtf16(u"\x00A6")},
-    {QStringLiteral("&bscr;"), QString::fromUtf16(u"\xD835\xDCB7")},
-    {QStringLiteral("&bsemi;"), QString::fromUtf16(u"\x204F")},
-    {QStringLiteral("&bsim;"), QString::fromUtf16(u"\x223D")},
-    {QStringLiteral("&bsime;"), QString::fromUtf16(u"\x22CD")},
-    {QStringLiteral("&bsol;"), QString::fromUtf16(u"\x005C")},
-    {QStringLiteral("&bsolb;"), QString::fromUtf16(u"\x29C5")},
-    {QStringLiteral("&bsolhsub;"), QString::fromUtf16(u"\x27C8")},
-    {QStringLiteral("&bull;"), QString::fromUtf16(u"\x2022")},
-    {QStringLiteral("&bullet;"), QString::fromUtf16(u"\x2022")},
-    {QStringLiteral("&bump;"), QString::fromUtf16(u"\x224E")},
-    {QStringLiteral("&bumpE;"), QString::fromUtf16(u"\x2AAE")},
-    {QStringLiteral("&bumpe;"), QString::fromUtf16(u"\x224F")},
-    {QStringLiteral("&bumpeq;"), QString::fromUtf16(u"\x224F")},
-    {QStringLiteral("&cacute;"), QString::fromUtf16(u"\x0107")},
-    {QStringLiteral("&cap;"), QString::fromUtf16(u"\x2229")},
-    {QStringLiteral("&capand;"), QString::fromUtf16(u"\x2A44")},
-    {QStringLiteral("&capbrcup;"), QString::fromUtf16(u"\x2A49")},
-    {QStringLiteral("&capcap;"), QString::fromUtf16(u"\x2A4B")},
-    {QStringLiteral("&capcup;"), QString::fromUtf16(u"\x2A47")},
-    {QStringLiteral("&capdot;"), QString::fromUtf16(u"\x2A40")},
-    {QStringLiteral("&caps;"), QString::fromUtf16(u"\x2229\xFE00")},
-    {QStringLiteral("&caret;"), QString::fromUtf16(u"\x2041")},
-    {QStringLiteral("&caron;"), QString::fromUtf16(u"\x02C7")},
-    {QStringLiteral("&ccaps;"), QString::fromUtf16(u"\x2A4D")},
-    {QStringLiteral("&ccaron;"), QString::fromUtf16(u"\x010D")},
-    {QStringLiteral("&ccedil"), QString::fromUtf16(u"\x00E7")},
-    {QStringLiteral("&ccedil;"), QString::fromUtf16(u"\x00E7")},
-    {QStringLiteral("&ccirc;"), QString::fromUtf16(u"\x0109")},
-    {QStringLiteral("&ccups;"), QString::fromUtf16(u"\x2A4C")},
-    {QStringLiteral("&ccupssm;"), QString::fromUtf16(u"\x2A50")},
-    {QStringLiteral("&cdot;"), QString::fromUtf16(u"\x010B")},
-    {QStringLiteral("&cedil"), QString::fromUtf16(u"\x00B8")},
-    {QStringLiteral("&cedil;"), QString::fromUtf16(u"\x00B8")},
-    {QStringLiteral("&cemptyv;"), QString::fromUtf16(u"\x29B2")},
-    {QStringLiteral("&cent"), QString::fromUtf16(u"\x00A2")},
-    {QStringLiteral("&cent;"), QString::fromUtf16(u"\x00A2")},
-    {QStringLiteral("&centerdot;"), QString::fromUtf16(u"\x00B7")},
-    {QStringLiteral("&cfr;"), QString::fromUtf16(u"\xD835\xDD20")},
-    {QStringLiteral("&chcy;"), QString::fromUtf16(u"\x0447")},
-    {QStringLiteral("&check;"), QString::fromUtf16(u"\x2713")},
-    {QStringLiteral("&checkmark;"), QString::fromUtf16(u"\x2713")},
-    {QStringLiteral("&chi;"), QString::fromUtf16(u"\x03C7")},
-    {QStringLiteral("&cir;"), QString::fromUtf16(u"\x25CB")},
-    {QStringLiteral("&cirE;"), QString::fromUtf16(u"\x29C3")},
-    {QStringLiteral("&circ;"), QString::fromUtf16(u"\x02C6")},
-    {QStringLiteral("&circeq;"), QString::fromUtf16(u"\x2257")},
-    {QStringLiteral("&circlearrowleft;"), QString::fromUtf16(u"\x21BA")},
-    {QStringLiteral("&circlearrowright;"), QString::fromUtf16(u"\x21BB")},
-    {QStringLiteral("&circledR;"), QString::fromUtf16(u"\x00AE")},
-    {QStringLiteral("&circledS;"), QString::fromUtf16(u"\x24C8")},
-    {QStringLiteral("&circledast;"), QString::fromUtf16(u"\x229B")},
-    {QStringLiteral("&circledcirc;"), QString::fromUtf16(u"\x229A")},
-    {QStringLiteral("&circleddash;"), QString::fromUtf16(u"\x229D")},
-    {QStringLiteral("&cire;"), QString::fromUtf16(u"\x2257")},
-    {QStringLiteral("&cirfnint;"), QString::fromUtf16(u"\x2A10")},
-    {QStringLiteral("&cirmid;"), QString::fromUtf16(u"\x2AEF")},
-    {QStringLiteral("&cirscir;"), QString::fromUtf16(u"\x29C2")},
-    {QStringLiteral("&clubs;"), QString::fromUtf16(u"\x2663")},
-    {QStringLiteral("&clubsuit;"), QString::fromUtf16(u"\x2663")},
-    {QStringLiteral("&colon;"), QString::fromUtf16(u"\x003A")},
-    {QStringLiteral("&colone;"), QString::fromUtf16(u"\x2254")},
-    {QStringLiteral("&coloneq;"), QString::fromUtf16(u"\x2254")},
-    {QStringLiteral("&comma;"), QString::fromUtf16(u"\x002C")},
-    {QStringLiteral("&commat;"), QString::fromUtf16(u"\x0040")},
-    {QStringLiteral("&comp;"), QString::fromUtf16(u"\x2201")},
-    {QStringLiteral("&compfn;"), QString::fromUtf16(u"\x2218")},
-    {QStringLiteral("&complement;"), QString::fromUtf16(u"\x2201")},
-    {QStringLiteral("&complexes;"), QString::fromUtf16(u"\x2102")},
-    {QStringLiteral("&cong;"), QString::fromUtf16(u"\x2245")},
-    {QStringLiteral("&congdot;"), QString::fromUtf16(u"\x2A6D")},
-    {QStringLiteral("&conint;"), QString::fromUtf16(u"\x222E")},
-    {QStringLiteral("&copf;"), QString::fromUtf16(u"\xD835\xDD54")},
-    {QStringLiteral("&coprod;"), QString::fromUtf16(u"\x2210")},
-    {QStringLiteral("&copy"), QString::fromUtf16(u"\x00A9")},
-    {QStringLiteral("&copy;"), QString::fromUtf16(u"\x00A9")},
-    {QStringLiteral("&copysr;"), QString::fromUtf16(u"\x2117")},
-    {QStringLiteral("&crarr;"), QString::fromUtf16(u"\x21B5")},
-    {QStringLiteral("&cross;"), QString::fromUtf16(u"\x2717")},
-    {QStringLiteral("&cscr;"), QString::fromUtf16(u"\xD835\xDCB8")},
-    {QStringLiteral("&csub;"), QString::fromUtf16(u"\x2ACF")},
-    {QStringLiteral("&csube;"), QString::fromUtf16(u"\x2AD1")},
-    {QStringLiteral("&csup;"), QString::fromUtf16(u"\x2AD0")},
-    {QStringLiteral("&csupe;"), QString::fromUtf16(u"\x2AD2")},
-    {QStringLiteral("&ctdot;"), QString::fromUtf16(u"\x22EF")},
-    {QStringLiteral("&cudarrl;"), QString::fromUtf16(u"\x2938")},
-    {QStringLiteral("&cudarrr;"), QString::fromUtf16(u"\x2935")},
-    {QStringLiteral("&cuepr;"), QString::fromUtf16(u"\x22DE")},
-    {QStringLiteral("&cuesc;"), QString::fromUtf16(u"\x22DF")},
-    {QStringLiteral("&cularr;"), QString::fromUtf16(u"\x21B6")},
-    {QStringLiteral("&cularrp;"), QString::fromUtf16(u"\x293D")},
-    {QStringLiteral("&cup;"), QString::fromUtf16(u"\x222A")},
-    {QStringLiteral("&cupbrcap;"), QString::fromUtf16(u"\x2A48")},
-    {QStringLiteral("&cupcap;"), QString::fromUtf16(u"\x2A46")},
-    {QStringLiteral("&cupcup;"), QString::fromUtf16(u"\x2A4A")},
-    {QStringLiteral("&cupdot;"), QString::fromUtf16(u"\x228D")},
-    {QStringLiteral("&cupor;"), QString::fromUtf16(u"\x2A45")},
-    {QStringLiteral("&cups;"), QString::fromUtf16(u"\x222A\xFE00")},
-    {QStringLiteral("&curarr;"), QString::fromUtf16(u"\x21B7")},
-    {QStringLiteral("&curarrm;"), QString::fromUtf16(u"\x293C")},
-    {QStringLiteral("&curlyeqprec;"), QString::fromUtf16(u"\x22DE")},
-    {QStringLiteral("&curlyeqsucc;"), QString::fromUtf16(u"\x22DF")},
-    {QStringLiteral("&curlyvee;"), QString::fromUtf16(u"\x22CE")},
-    {QStringLiteral("&curlywedge;"), QString::fromUtf16(u"\x22CF")},
-    {QStringLiteral("&curren"), QString::fromUtf16(u"\x00A4")},
-    {QStringLiteral("&curren;"), QString::fromUtf16(u"\x00A4")},
-    {QStringLiteral("&curvearrowleft;"), QString::fromUtf16(u"\x21B6")},
-    {QStringLiteral("&curvearrowright;"), QString::fromUtf16(u"\x21B7")},
-    {QStringLiteral("&cuvee;"), QString::fromUtf16(u"\x22CE")},
-    {QStringLiteral("&cuwed;"), QString::fromUtf16(u"\x22CF")},
-    {QStringLiteral("&cwconint;"), QString::fromUtf16(u"\x2232")},
-    {QStringLiteral("&cwint;"), QString::fromUtf16(u"\x2231")},
-    {QStringLiteral("&cylcty;"), QString::fromUtf16(u"\x232D")},
-    {QStringLiteral("&dArr;"), QString::fromUtf16(u"\x21D3")},
-    {QStringLiteral("&dHar;"), QString::fromUtf16(u"\x2965")},
-    {QStringLiteral("&dagger;"), QString::fromUtf16(u"\x2020")},
-    {QStringLiteral("&daleth;"), QString::fromUtf16(u"\x2138")},
-    {QStringLiteral("&darr;"), QString::fromUtf16(u"\x2193")},
-    {QStringLiteral("&dash;"), QString::fromUtf16(u"\x2010")},
-    {QStringLiteral("&dashv;"), QString::fromUtf16(u"\x22A3")},
-    {QStringLiteral("&dbkarow;"), QString::fromUtf16(u"\x290F")},
-    {QStringLiteral("&dblac;"), QString::fromUtf16(u"\x02DD")},
-    {QStringLiteral("&dcaron;"), QString::fromUtf16(u"\x010F")},
-    {QStringLiteral("&dcy;"), QString::fromUtf16(u"\x0434")},
-    {QStringLiteral("&dd;"), QString::fromUtf16(u"\x2146")},
-    {QStringLiteral("&ddagger;"), QString::fromUtf16(u"\x2021")},
-    {QStringLiteral("&ddarr;"), QString::fromUtf16(u"\x21CA")},
-    {QStringLiteral("&ddotseq;"), QString::fromUtf16(u"\x2A77")},
-    {QStringLiteral("&deg"), QString::fromUtf16(u"\x00B0")},
-    {QStringLiteral("&deg;"), QString::fromUtf16(u"\x00B0")},
-    {QStringLiteral("&delta;"), QString::fromUtf16(u"\x03B4")},
-    {QStringLiteral("&demptyv;"), QString::fromUtf16(u"\x29B1")},
-    {QStringLiteral("&dfisht;"), QString::fromUtf16(u"\x297F")},
-    {QStringLiteral("&dfr;"), QString::fromUtf16(u"\xD835\xDD21")},
-    {QStringLiteral("&dharl;"), QString::fromUtf16(u"\x21C3")},
-    {QStringLiteral("&dharr;"), QString::fromUtf16(u"\x21C2")},
-    {QStringLiteral("&diam;"), QString::fromUtf16(u"\x22C4")},
-    {QStringLiteral("&diamond;"), QString::fromUtf16(u"\x22C4")},
-    {QStringLiteral("&diamondsuit;"), QString::fromUtf16(u"\x2666")},
-    {QStringLiteral("&diams;"), QString::fromUtf16(u"\x2666")},
-    {QStringLiteral("&die;"), QString::fromUtf16(u"\x00A8")},
-    {QStringLiteral("&digamma;"), QString::fromUtf16(u"\x03DD")},
-    {QStringLiteral("&disin;"), QString::fromUtf16(u"\x22F2")},
-    {QStringLiteral("&div;"), QString::fromUtf16(u"\x00F7")},
-    {QStringLiteral("&divide"), QString::fromUtf16(u"\x00F7")},
-    {QStringLiteral("&divide;"), QString::fromUtf16(u"\x00F7")},
-    {QStringLiteral("&divideontimes;"), QString::fromUtf16(u"\x22C7")},
-    {QStringLiteral("&divonx;"), QString::fromUtf16(u"\x22C7")},
-    {QStringLiteral("&djcy;"), QString::fromUtf16(u"\x0452")},
-    {QStringLiteral("&dlcorn;"), QString::fromUtf16(u"\x231E")},
-    {QStringLiteral("&dlcrop;"), QString::fromUtf16(u"\x230D")},
-    {QStringLiteral("&dollar;"), QString::fromUtf16(u"\x0024")},
-    {QStringLiteral("&dopf;"), QString::fromUtf16(u"\xD835\xDD55")},
-    {QStringLiteral("&dot;"), QString::fromUtf16(u"\x02D9")},
-    {QStringLiteral("&doteq;"), QString::fromUtf16(u"\x2250")},
-    {QStringLiteral("&doteqdot;"), QString::fromUtf16(u"\x2251")},
-    {QStringLiteral("&dotminus;"), QString::fromUtf16(u"\x2238")},
-    {QStringLiteral("&dotplus;"), QString::fromUtf16(u"\x2214")},
-    {QStringLiteral("&dotsquare;"), QString::fromUtf16(u"\x22A1")},
-    {QStringLiteral("&doublebarwedge;"), QString::fromUtf16(u"\x2306")},
-    {QStringLiteral("&downarrow;"), QString::fromUtf16(u"\x2193")},
-    {QStringLiteral("&downdownarrows;"), QString::fromUtf16(u"\x21CA")},
-    {QStringLiteral("&downharpoonleft;"), QString::fromUtf16(u"\x21C3")},
-    {QStringLiteral("&downharpoonright;"), QString::fromUtf16(u"\x21C2")},
-    {QStringLiteral("&drbkarow;"), QString::fromUtf16(u"\x2910")},
-    {QStringLiteral("&drcorn;"), QString::fromUtf16(u"\x231F")},
-    {QStringLiteral("&drcrop;"), QString::fromUtf16(u"\x230C")},
-    {QStringLiteral("&dscr;"), QString::fromUtf16(u"\xD835\xDCB9")},
-    {QStringLiteral("&dscy;"), QString::fromUtf16(u"\x0455")},
-    {QStringLiteral("&dsol;"), QString::fromUtf16(u"\x29F6")},
-    {QStringLiteral("&dstrok;"), QString::fromUtf16(u"\x0111")},
-    {QStringLiteral("&dtdot;"), QString::fromUtf16(u"\x22F1")},
-    {QStringLiteral("&dtri;"), QString::fromUtf16(u"\x25BF")},
-    {QStringLiteral("&dtrif;"), QString::fromUtf16(u"\x25BE")},
-    {QStringLiteral("&duarr;"), QString::fromUtf16(u"\x21F5")},
-    {QStringLiteral("&duhar;"), QString::fromUtf16(u"\x296F")},
-    {QStringLiteral("&dwangle;"), QString::fromUtf16(u"\x29A6")},
-    {QStringLiteral("&dzcy;"), QString::fromUtf16(u"\x045F")},
-    {QStringLiteral("&dzigrarr;"), QString::fromUtf16(u"\x27FF")},
-    {QStringLiteral("&eDDot;"), QString::fromUtf16(u"\x2A77")},
-    {QStringLiteral("&eDot;"), QString::fromUtf16(u"\x2251")},
-    {QStringLiteral("&eacute"), QString::fromUtf16(u"\x00E9")},
-    {QStringLiteral("&eacute;"), QString::fromUtf16(u"\x00E9")},
-    {QStringLiteral("&easter;"), QString::fromUtf16(u"\x2A6E")},
-    {QStringLiteral("&ecaron;"), QString::fromUtf16(u"\x011B")},
-    {QStringLiteral("&ecir;"), QString::fromUtf16(u"\x2256")},
-    {QStringLiteral("&ecirc"), QString::fromUtf16(u"\x00EA")},
-    {QStringLiteral("&ecirc;"), QString::fromUtf16(u"\x00EA")},
-    {QStringLiteral("&ecolon;"), QString::fromUtf16(u"\x2255")},
-    {QStringLiteral("&ecy;"), QString::fromUtf16(u"\x044D")},
-    {QStringLiteral("&edot;"), QString::fromUtf16(u"\x0117")},
-    {QStringLiteral("&ee;"), QString::fromUtf16(u"\x2147")},
-    {QStringLiteral("&efDot;"), QString::fromUtf16(u"\x2252")},
-    {QStringLiteral("&efr;"), QString::fromUtf16(u"\xD835\xDD22")},
-    {QStringLiteral("&eg;"), QString::fromUtf16(u"\x2A9A")},
-    {QStringLiteral("&egrave"), QString::fromUtf16(u"\x00E8")},
-    {QStringLiteral("&egrave;"), QString::fromUtf16(u"\x00E8")},
-    {QStringLiteral("&egs;"), QString::fromUtf16(u"\x2A96")},
-    {QStringLiteral("&egsdot;"), QString::fromUtf16(u"\x2A98")},
-    {QStringLiteral("&el;"), QString::fromUtf16(u"\x2A99")},
-    {QStringLiteral("&elinters;"), QString::fromUtf16(u"\x23E7")},
-    {QStringLiteral("&ell;"), QString::fromUtf16(u"\x2113")},
-    {QStringLiteral("&els;"), QString::fromUtf16(u"\x2A95")},
-    {QStringLiteral("&elsdot;"), QString::fromUtf16(u"\x2A97")},
-    {QStringLiteral("&emacr;"), QString::fromUtf16(u"\x0113")},
-    {QStringLiteral("&empty;"), QString::fromUtf16(u"\x2205")},
-    {QStringLiteral("&emptyset;"), QString::fromUtf16(u"\x2205")},
-    {QStringLiteral("&emptyv;"), QString::fromUtf16(u"\x2205")},
-    {QStringLiteral("&emsp13;"), QString::fromUtf16(u"\x2004")},
-    {QStringLiteral("&emsp14;"), QString::fromUtf16(u"\x2005")},
-    {QStringLiteral("&emsp;"), QString::fromUtf16(u"\x2003")},
-    {QStringLiteral("&eng;"), QString::fromUtf16(u"\x014B")},
-    {QStringLiteral("&ensp;"), QString::fromUtf16(u"\x2002")},
-    {QStringLiteral("&eogon;"), QString::fromUtf16(u"\x0119")},
-    {QStringLiteral("&eopf;"), QString::fromUtf16(u"\xD835\xDD56")},
-    {QStringLiteral("&epar;"), QString::fromUtf16(u"\x22D5")},
-    {QStringLiteral("&eparsl;"), QString::fromUtf16(u"\x29E3")},
-    {QStringLiteral("&eplus;"), QString::fromUtf16(u"\x2A71")},
-    {QStringLiteral("&epsi;"), QString::fromUtf16(u"\x03B5")},
-    {QStringLiteral("&epsilon;"), QString::fromUtf16(u"\x03B5")},
-    {QStringLiteral("&epsiv;"), QString::fromUtf16(u"\x03F5")},
-    {QStringLiteral("&eqcirc;"), QString::fromUtf16(u"\x2256")},
-    {QStringLiteral("&eqcolon;"), QString::fromUtf16(u"\x2255")},
-    {QStringLiteral("&eqsim;"), QString::fromUtf16(u"\x2242")},
-    {QStringLiteral("&eqslantgtr;"), QString::fromUtf16(u"\x2A96")},
-    {QStringLiteral("&eqslantless;"), QString::fromUtf16(u"\x2A95")},
-    {QStringLiteral("&equals;"), QString::fromUtf16(u"\x003D")},
-    {QStringLiteral("&equest;"), QString::fromUtf16(u"\x225F")},
-    {QStringLiteral("&equiv;"), QString::fromUtf16(u"\x2261")},
-    {QStringLiteral("&equivDD;"), QString::fromUtf16(u"\x2A78")},
-    {QStringLiteral("&eqvparsl;"), QString::fromUtf16(u"\x29E5")},
-    {QStringLiteral("&erDot;"), QString::fromUtf16(u"\x2253")},
-    {QStringLiteral("&erarr;"), QString::fromUtf16(u"\x2971")},
-    {QStringLiteral("&escr;"), QString::fromUtf16(u"\x212F")},
-    {QStringLiteral("&esdot;"), QString::fromUtf16(u"\x2250")},
-    {QStringLiteral("&esim;"), QString::fromUtf16(u"\x2242")},
-    {QStringLiteral("&eta;"), QString::fromUtf16(u"\x03B7")},
-    {QStringLiteral("&eth"), QString::fromUtf16(u"\x00F0")},
-    {QStringLiteral("&eth;"), QString::fromUtf16(u"\x00F0")},
-    {QStringLiteral("&euml"), QString::fromUtf16(u"\x00EB")},
-    {QStringLiteral("&euml;"), QString::fromUtf16(u"\x00EB")},
-    {QStringLiteral("&euro;"), QString::fromUtf16(u"\x20AC")},
-    {QStringLiteral("&excl;"), QString::fromUtf16(u"\x0021")},
-    {QStringLiteral("&exist;"), QString::fromUtf16(u"\x2203")},
-    {QStringLiteral("&expectation;"), QString::fromUtf16(u"\x2130")},
-    {QStringLiteral("&exponentiale;"), QString::fromUtf16(u"\x2147")},
-    {QStringLiteral("&fallingdotseq;"), QString::fromUtf16(u"\x2252")},
-    {QStringLiteral("&fcy;"), QString::fromUtf16(u"\x0444")},
-    {QStringLiteral("&female;"), QString::fromUtf16(u"\x2640")},
-    {QStringLiteral("&ffilig;"), QString::fromUtf16(u"\xFB03")},
-    {QStringLiteral("&fflig;"), QString::fromUtf16(u"\xFB00")},
-    {QStringLiteral("&ffllig;"), QString::fromUtf16(u"\xFB04")},
-    {QStringLiteral("&ffr;"), QString::fromUtf16(u"\xD835\xDD23")},
-    {QStringLiteral("&filig;"), QString::fromUtf16(u"\xFB01")},
-    {QStringLiteral("&fjlig;"), QString::fromUtf16(u"\x0066\x006A")},
-    {QStringLiteral("&flat;"), QString::fromUtf16(u"\x266D")},
-    {QStringLiteral("&fllig;"), QString::fromUtf16(u"\xFB02")},
-    {QStringLiteral("&fltns;"), QString::fromUtf16(u"\x25B1")},
-    {QStringLiteral("&fnof;"), QString::fromUtf16(u"\x0192")},
-    {QStringLiteral("&fopf;"), QString::fromUtf16(u"\xD835\xDD57")},
-    {QStringLiteral("&forall;"), QString::fromUtf16(u"\x2200")},
-    {QStringLiteral("&fork;"), QString::fromUtf16(u"\x22D4")},
-    {QStringLiteral("&forkv;"), QString::fromUtf16(u"\x2AD9")},
-    {QStringLiteral("&fpartint;"), QString::fromUtf16(u"\x2A0D")},
-    {QStringLiteral("&frac12"), QString::fromUtf16(u"\x00BD")},
-    {QStringLiteral("&frac12;"), QString::fromUtf16(u"\x00BD")},
-    {QStringLiteral("&frac13;"), QString::fromUtf16(u"\x2153")},
-    {QStringLiteral("&frac14"), QString::fromUtf16(u"\x00BC")},
-    {QStringLiteral("&frac14;"), QString::fromUtf16(u"\x00BC")},
-    {QStringLiteral("&frac15;"), QString::fromUtf16(u"\x2155")},
-    {QStringLiteral("&frac16;"), QString::fromUtf16(u"\x2159")},
-    {QStringLiteral("&frac18;"), QString::fromUtf16(u"\x215B")},
-    {QStringLiteral("&frac23;"), QString::fromUtf16(u"\x2154")},
-    {QStringLiteral("&frac25;"), QString::fromUtf16(u"\x2156")},
-    {QStringLiteral("&frac34"), QString::fromUtf16(u"\x00BE")},
-    {QStringLiteral("&frac34;"), QString::fromUtf16(u"\x00BE")},
-    {QStringLiteral("&frac35;"), QString::fromUtf16(u"\x2157")},
-    {QStringLiteral("&frac38;"), QString::fromUtf16(u"\x215C")},
-    {QStringLiteral("&frac45;"), QString::fromUtf16(u"\x2158")},
-    {QStringLiteral("&frac56;"), QString::fromUtf16(u"\x215A")},
-    {QStringLiteral("&frac58;"), QString::fromUtf16(u"\x215D")},
-    {QStringLiteral("&frac78;"), QString::fromUtf16(u"\x215E")},
-    {QStringLiteral("&frasl;"), QString::fromUtf16(u"\x2044")},
-    {QStringLiteral("&frown;"), QString::fromUtf16(u"\x2322")},
-    {QStringLiteral("&fscr;"), QString::fromUtf16(u"\xD835\xDCBB")},
-    {QStringLiteral("&gE;"), QString::fromUtf16(u"\x2267")},
-    {QStringLiteral("&gEl;"), QString::fromUtf16(u"\x2A8C")},
-    {QStringLiteral("&gacute;"), QString::fromUtf16(u"\x01F5")},
-    {QStringLiteral("&gamma;"), QString::fromUtf16(u"\x03B3")},
-    {QStringLiteral("&gammad;"), QString::fromUtf16(u"\x03DD")},
-    {QStringLiteral("&gap;"), QString::fromUtf16(u"\x2A86")},
-    {QStringLiteral("&gbreve;"), QString::fromUtf16(u"\x011F")},
-    {QStringLiteral("&gcirc;"), QString::fromUtf16(u"\x011D")},
-    {QStringLiteral("&gcy;"), QString::fromUtf16(u"\x0433")},
-    {QStringLiteral("&gdot;"), QString::fromUtf16(u"\x0121")},
-    {QStringLiteral("&ge;"), QString::fromUtf16(u"\x2265")},
-    {QStringLiteral("&gel;"), QString::fromUtf16(u"\x22DB")},
-    {QStringLiteral("&geq;"), QString::fromUtf16(u"\x2265")},
-    {QStringLiteral("&geqq;"), QString::fromUtf16(u"\x2267")},
-    {QStringLiteral("&geqslant;"), QString::fromUtf16(u"\x2A7E")},
-    {QStringLiteral("&ges;"), QString::fromUtf16(u"\x2A7E")},
-    {QStringLiteral("&gescc;"), QString::fromUtf16(u"\x2AA9")},
-    {QStringLiteral("&gesdot;"), QString::fromUtf16(u"\x2A80")},
-    {QStringLiteral("&gesdoto;"), QString::fromUtf16(u"\x2A82")},
-    {QStringLiteral("&gesdotol;"), QString::fromUtf16(u"\x2A84")},
-    {QStringLiteral("&gesl;"), QString::fromUtf16(u"\x22DB\xFE00")},
-    {QStringLiteral("&gesles;"), QString::fromUtf16(u"\x2A94")},
-    {QStringLiteral("&gfr;"), QString::fromUtf16(u"\xD835\xDD24")},
-    {QStringLiteral("&gg;"), QString::fromUtf16(u"\x226B")},
-    {QStringLiteral("&ggg;"), QString::fromUtf16(u"\x22D9")},
-    {QStringLiteral("&gimel;"), QString::fromUtf16(u"\x2137")},
-    {QStringLiteral("&gjcy;"), QString::fromUtf16(u"\x0453")},
-    {QStringLiteral("&gl;"), QString::fromUtf16(u"\x2277")},
-    {QStringLiteral("&glE;"), QString::fromUtf16(u"\x2A92")},
-    {QStringLiteral("&gla;"), QString::fromUtf16(u"\x2AA5")},
-    {QStringLiteral("&glj;"), QString::fromUtf16(u"\x2AA4")},
-    {QStringLiteral("&gnE;"), QString::fromUtf16(u"\x2269")},
-    {QStringLiteral("&gnap;"), QString::fromUtf16(u"\x2A8A")},
-    {QStringLiteral("&gnapprox;"), QString::fromUtf16(u"\x2A8A")},
-    {QStringLiteral("&gne;"), QString::fromUtf16(u"\x2A88")},
-    {QStringLiteral("&gneq;"), QString::fromUtf16(u"\x2A88")},
-    {QStringLiteral("&gneqq;"), QString::fromUtf16(u"\x2269")},
-    {QStringLiteral("&gnsim;"), QString::fromUtf16(u"\x22E7")},
-    {QStringLiteral("&gopf;"), QString::fromUtf16(u"\xD835\xDD58")},
-    {QStringLiteral("&grave;"), QString::fromUtf16(u"\x0060")},
-    {QStringLiteral("&gscr;"), QString::fromUtf16(u"\x210A")},
-    {QStringLiteral("&gsim;"), QString::fromUtf16(u"\x2273")},
-    {QStringLiteral("&gsime;"), QString::fromUtf16(u"\x2A8E")},
-    {QStringLiteral("&gsiml;"), QString::fromUtf16(u"\x2A90")},
-    {QStringLiteral("&gt"), QString::fromUtf16(u"\x003E")},
-    {QStringLiteral("&gt;"), QString::fromUtf16(u"\x003E")},
-    {QStringLiteral("&gtcc;"), QString::fromUtf16(u"\x2AA7")},
-    {QStringLiteral("&gtcir;"), QString::fromUtf16(u"\x2A7A")},
-    {QStringLiteral("&gtdot;"), QString::fromUtf16(u"\x22D7")},
-    {QStringLiteral("&gtlPar;"), QString::fromUtf16(u"\x2995")},
-    {QStringLiteral("&gtquest;"), QString::fromUtf16(u"\x2A7C")},
-    {QStringLiteral("&gtrapprox;"), QString::fromUtf16(u"\x2A86")},
-    {QStringLiteral("&gtrarr;"), QString::fromUtf16(u"\x2978")},
-    {QStringLiteral("&gtrdot;"), QString::fromUtf16(u"\x22D7")},
-    {QStringLiteral("&gtreqless;"), QString::fromUtf16(u"\x22DB")},
-    {QStringLiteral("&gtreqqless;"), QString::fromUtf16(u"\x2A8C")},
-    {QStringLiteral("&gtrless;"), QString::fromUtf16(u"\x2277")},
-    {QStringLiteral("&gtrsim;"), QString::fromUtf16(u"\x2273")},
-    {QStringLiteral("&gvertneqq;"), QString::fromUtf16(u"\x2269\xFE00")},
-    {QStringLiteral("&gvnE;"), QString::fromUtf16(u"\x2269\xFE00")},
-    {QStringLiteral("&hArr;"), QString::fromUtf16(u"\x21D4")},
-    {QStringLiteral("&hairsp;"), QString::fromUtf16(u"\x200A")},
-    {QStringLiteral("&half;"), QString::fromUtf16(u"\x00BD")},
-    {QStringLiteral("&hamilt;"), QString::fromUtf16(u"\x210B")},
-    {QStringLiteral("&hardcy;"), QString::fromUtf16(u"\x044A")},
-    {QStringLiteral("&harr;"), QString::fromUtf16(u"\x2194")},
-    {QStringLiteral("&harrcir;"), QString::fromUtf16(u"\x2948")},
-    {QStringLiteral("&harrw;"), QString::fromUtf16(u"\x21AD")},
-    {QStringLiteral("&hbar;"), QString::fromUtf16(u"\x210F")},
-    {QStringLiteral("&hcirc;"), QString::fromUtf16(u"\x0125")},
-    {QStringLiteral("&hearts;"), QString::fromUtf16(u"\x2665")},
-    {QStringLiteral("&heartsuit;"), QString::fromUtf16(u"\x2665")},
-    {QStringLiteral("&hellip;"), QString::fromUtf16(u"\x2026")},
-    {QStringLiteral("&hercon;"), QString::fromUtf16(u"\x22B9")},
-    {QStringLiteral("&hfr;"), QString::fromUtf16(u"\xD835\xDD25")},
-    {QStringLiteral("&hksearow;"), QString::fromUtf16(u"\x2925")},
-    {QStringLiteral("&hkswarow;"), QString::fromUtf16(u"\x2926")},
-    {QStringLiteral("&hoarr;"), QString::fromUtf16(u"\x21FF")},
-    {QStringLiteral("&homtht;"), QString::fromUtf16(u"\x223B")},
-    {QStringLiteral("&hookleftarrow;"), QString::fromUtf16(u"\x21A9")},
-    {QStringLiteral("&hookrightarrow;"), QString::fromUtf16(u"\x21AA")},
-    {QStringLiteral("&hopf;"), QString::fromUtf16(u"\xD835\xDD59")},
-    {QStringLiteral("&horbar;"), QString::fromUtf16(u"\x2015")},
-    {QStringLiteral("&hscr;"), QString::fromUtf16(u"\xD835\xDCBD")},
-    {QStringLiteral("&hslash;"), QString::fromUtf16(u"\x210F")},
-    {QStringLiteral("&hstrok;"), QString::fromUtf16(u"\x0127")},
-    {QStringLiteral("&hybull;"), QString::fromUtf16(u"\x2043")},
-    {QStringLiteral("&hyphen;"), QString::fromUtf16(u"\x2010")},
-    {QStringLiteral("&iacute"), QString::fromUtf16(u"\x00ED")},
-    {QStringLiteral("&iacute;"), QString::fromUtf16(u"\x00ED")},
-    {QStringLiteral("&ic;"), QString::fromUtf16(u"\x2063")},
-    {QStringLiteral("&icirc"), QString::fromUtf16(u"\x00EE")},
-    {QStringLiteral("&icirc;"), QString::fromUtf16(u"\x00EE")},
-    {QStringLiteral("&icy;"), QString::fromUtf16(u"\x0438")},
-    {QStringLiteral("&iecy;"), QString::fromUtf16(u"\x0435")},
-    {QStringLiteral("&iexcl"), QString::fromUtf16(u"\x00A1")},
-    {QStringLiteral("&iexcl;"), QString::fromUtf16(u"\x00A1")},
-    {QStringLiteral("&iff;"), QString::fromUtf16(u"\x21D4")},
-    {QStringLiteral("&ifr;"), QString::fromUtf16(u"\xD835\xDD26")},
-    {QStringLiteral("&igrave"), QString::fromUtf16(u"\x00EC")},
-    {QStringLiteral("&igrave;"), QString::fromUtf16(u"\x00EC")},
-    {QStringLiteral("&ii;"), QString::fromUtf16(u"\x2148")},
-    {QStringLiteral("&iiiint;"), QString::fromUtf16(u"\x2A0C")},
-    {QStringLiteral("&iiint;"), QString::fromUtf16(u"\x222D")},
-    {QStringLiteral("&iinfin;"), QString::fromUtf16(u"\x29DC")},
-    {QStringLiteral("&iiota;"), QString::fromUtf16(u"\x2129")},
-    {QStringLiteral("&ijlig;"), QString::fromUtf16(u"\x0133")},
-    {QStringLiteral("&imacr;"), QString::fromUtf16(u"\x012B")},
-    {QStringLiteral("&image;"), QString::fromUtf16(u"\x2111")},
-    {QStringLiteral("&imagline;"), QString::fromUtf16(u"\x2110")},
-    {QStringLiteral("&imagpart;"), QString::fromUtf16(u"\x2111")},
-    {QStringLiteral("&imath;"), QString::fromUtf16(u"\x0131")},
-    {QStringLiteral("&imof;"), QString::fromUtf16(u"\x22B7")},
-    {QStringLiteral("&imped;"), QString::fromUtf16(u"\x01B5")},
-    {QStringLiteral("&in;"), QString::fromUtf16(u"\x2208")},
-    {QStringLiteral("&incare;"), QString::fromUtf16(u"\x2105")},
-    {QStringLiteral("&infin;"), QString::fromUtf16(u"\x221E")},
-    {QStringLiteral("&infintie;"), QString::fromUtf16(u"\x29DD")},
-    {QStringLiteral("&inodot;"), QString::fromUtf16(u"\x0131")},
-    {QStringLiteral("&int;"), QString::fromUtf16(u"\x222B")},
-    {QStringLiteral("&intcal;"), QString::fromUtf16(u"\x22BA")},
-    {QStringLiteral("&integers;"), QString::fromUtf16(u"\x2124")},
-    {QStringLiteral("&intercal;"), QString::fromUtf16(u"\x22BA")},
-    {QStringLiteral("&intlarhk;"), QString::fromUtf16(u"\x2A17")},
-    {QStringLiteral("&intprod;"), QString::fromUtf16(u"\x2A3C")},
-    {QStringLiteral("&iocy;"), QString::fromUtf16(u"\x0451")},
-    {QStringLiteral("&iogon;"), QString::fromUtf16(u"\x012F")},
-    {QStringLiteral("&iopf;"), QString::fromUtf16(u"\xD835\xDD5A")},
-    {QStringLiteral("&iota;"), QString::fromUtf16(u"\x03B9")},
-    {QStringLiteral("&iprod;"), QString::fromUtf16(u"\x2A3C")},
-    {QStringLiteral("&iquest"), QString::fromUtf16(u"\x00BF")},
-    {QStringLiteral("&iquest;"), QString::fromUtf16(u"\x00BF")},
-    {QStringLiteral("&iscr;"), QString::fromUtf16(u"\xD835\xDCBE")},
-    {QStringLiteral("&isin;"), QString::fromUtf16(u"\x2208")},
-    {QStringLiteral("&isinE;"), QString::fromUtf16(u"\x22F9")},
-    {QStringLiteral("&isindot;"), QString::fromUtf16(u"\x22F5")},
-    {QStringLiteral("&isins;"), QString::fromUtf16(u"\x22F4")},
-    {QStringLiteral("&isinsv;"), QString::fromUtf16(u"\x22F3")},
-    {QStringLiteral("&isinv;"), QString::fromUtf16(u"\x2208")},
-    {QStringLiteral("&it;"), QString::fromUtf16(u"\x2062")},
-    {QStringLiteral("&itilde;"), QString::fromUtf16(u"\x0129")},
-    {QStringLiteral("&iukcy;"), QString::fromUtf16(u"\x0456")},
-    {QStringLiteral("&iuml"), QString::fromUtf16(u"\x00EF")},
-    {QStringLiteral("&iuml;"), QString::fromUtf16(u"\x00EF")},
-    {QStringLiteral("&jcirc;"), QString::fromUtf16(u"\x0135")},
-    {QStringLiteral("&jcy;"), QString::fromUtf16(u"\x0439")},
-    {QStringLiteral("&jfr;"), QString::fromUtf16(u"\xD835\xDD27")},
-    {QStringLiteral("&jmath;"), QString::fromUtf16(u"\x0237")},
-    {QStringLiteral("&jopf;"), QString::fromUtf16(u"\xD835\xDD5B")},
-    {QStringLiteral("&jscr;"), QString::fromUtf16(u"\xD835\xDCBF")},
-    {QStringLiteral("&jsercy;"), QString::fromUtf16(u"\x0458")},
-    {QStringLiteral("&jukcy;"), QString::fromUtf16(u"\x0454")},
-    {QStringLiteral("&kappa;"), QString::fromUtf16(u"\x03BA")},
-    {QStringLiteral("&kappav;"), QString::fromUtf16(u"\x03F0")},
-    {QStringLiteral("&kcedil;"), QString::fromUtf16(u"\x0137")},
-    {QStringLiteral("&kcy;"), QString::fromUtf16(u"\x043A")},
-    {QStringLiteral("&kfr;"), QString::fromUtf16(u"\xD835\xDD28")},
-    {QStringLiteral("&kgreen;"), QString::fromUtf16(u"\x0138")},
-    {QStringLiteral("&khcy;"), QString::fromUtf16(u"\x0445")},
-    {QStringLiteral("&kjcy;"), QString::fromUtf16(u"\x045C")},
-    {QStringLiteral("&kopf;"), QString::fromUtf16(u"\xD835\xDD5C")},
-    {QStringLiteral("&kscr;"), QString::fromUtf16(u"\xD835\xDCC0")},
-    {QStringLiteral("&lAarr;"), QString::fromUtf16(u"\x21DA")},
-    {QStringLiteral("&lArr;"), QString::fromUtf16(u"\x21D0")},
-    {QStringLiteral("&lAtail;"), QString::fromUtf16(u"\x291B")},
-    {QStringLiteral("&lBarr;"), QString::fromUtf16(u"\x290E")},
-    {QStringLiteral("&lE;"), QString::fromUtf16(u"\x2266")},
-    {QStringLiteral("&lEg;"), QString::fromUtf16(u"\x2A8B")},
-    {QStringLiteral("&lHar;"), QString::fromUtf16(u"\x2962")},
-    {QStringLiteral("&lacute;"), QString::fromUtf16(u"\x013A")},
-    {QStringLiteral("&laemptyv;"), QString::fromUtf16(u"\x29B4")},
-    {QStringLiteral("&lagran;"), QString::fromUtf16(u"\x2112")},
-    {QStringLiteral("&lambda;"), QString::fromUtf16(u"\x03BB")},
-    {QStringLiteral("&lang;"), QString::fromUtf16(u"\x27E8")},
-    {QStringLiteral("&langd;"), QString::fromUtf16(u"\x2991")},
-    {QStringLiteral("&langle;"), QString::fromUtf16(u"\x27E8")},
-    {QStringLiteral("&lap;"), QString::fromUtf16(u"\x2A85")},
-    {QStringLiteral("&laquo"), QString::fromUtf16(u"\x00AB")},
-    {QStringLiteral("&laquo;"), QString::fromUtf16(u"\x00AB")},
-    {QStringLiteral("&larr;"), QString::fromUtf16(u"\x2190")},
-    {QStringLiteral("&larrb;"), QString::fromUtf16(u"\x21E4")},
-    {QStringLiteral("&larrbfs;"), QString::fromUtf16(u"\x291F")},
-    {QStringLiteral("&larrfs;"), QString::fromUtf16(u"\x291D")},
-    {QStringLiteral("&larrhk;"), QString::fromUtf16(u"\x21A9")},
-    {QStringLiteral("&larrlp;"), QString::fromUtf16(u"\x21AB")},
-    {QStringLiteral("&larrpl;"), QString::fromUtf16(u"\x2939")},
-    {QStringLiteral("&larrsim;"), QString::fromUtf16(u"\x2973")},
-    {QStringLiteral("&larrtl;"), QString::fromUtf16(u"\x21A2")},
-    {QStringLiteral("&lat;"), QString::fromUtf16(u"\x2AAB")},
-    {QStringLiteral("&latail;"), QString::fromUtf16(u"\x2919")},
-    {QStringLiteral("&late;"), QString::fromUtf16(u"\x2AAD")},
-    {QStringLiteral("&lates;"), QString::fromUtf16(u"\x2AAD\xFE00")},
-    {QStringLiteral("&lbarr;"), QString::fromUtf16(u"\x290C")},
-    {QStringLiteral("&lbbrk;"), QString::fromUtf16(u"\x2772")},
-    {QStringLiteral("&lbrace;"), QString::fromUtf16(u"\x007B")},
-    {QStringLiteral("&lbrack;"), QString::fromUtf16(u"\x005B")},
-    {QStringLiteral("&lbrke;"), QString::fromUtf16(u"\x298B")},
-    {QStringLiteral("&lbrksld;"), QString::fromUtf16(u"\x298F")},
-    {QStringLiteral("&lbrkslu;"), QString::fromUtf16(u"\x298D")},
-    {QStringLiteral("&lcaron;"), QString::fromUtf16(u"\x013E")},
-    {QStringLiteral("&lcedil;"), QString::fromUtf16(u"\x013C")},
-    {QStringLiteral("&lceil;"), QString::fromUtf16(u"\x2308")},
-    {QStringLiteral("&lcub;"), QString::fromUtf16(u"\x007B")},
-    {QStringLiteral("&lcy;"), QString::fromUtf16(u"\x043B")},
-    {QStringLiteral("&ldca;"), QString::fromUtf16(u"\x2936")},
-    {QStringLiteral("&ldquo;"), QString::fromUtf16(u"\x201C")},
-    {QStringLiteral("&ldquor;"), QString::fromUtf16(u"\x201E")},
-    {QStringLiteral("&ldrdhar;"), QString::fromUtf16(u"\x2967")},
-    {QStringLiteral("&ldrushar;"), QString::fromUtf16(u"\x294B")},
-    {QStringLiteral("&ldsh;"), QString::fromUtf16(u"\x21B2")},
-    {QStringLiteral("&le;"), QString::fromUtf16(u"\x2264")},
-    {QStringLiteral("&leftarrow;"), QString::fromUtf16(u"\x2190")},
-    {QStringLiteral("&leftarrowtail;"), QString::fromUtf16(u"\x21A2")},
-    {QStringLiteral("&leftharpoondown;"), QString::fromUtf16(u"\x21BD")},
-    {QStringLiteral("&leftharpoonup;"), QString::fromUtf16(u"\x21BC")},
-    {QStringLiteral("&leftleftarrows;"), QString::fromUtf16(u"\x21C7")},
-    {QStringLiteral("&leftrightarrow;"), QString::fromUtf16(u"\x2194")},
-    {QStringLiteral("&leftrightarrows;"), QString::fromUtf16(u"\x21C6")},
-    {QStringLiteral("&leftrightharpoons;"), QString::fromUtf16(u"\x21CB")},
-    {QStringLiteral("&leftrightsquigarrow;"), QString::fromUtf16(u"\x21AD")},
-    {QStringLiteral("&leftthreetimes;"), QString::fromUtf16(u"\x22CB")},
-    {QStringLiteral("&leg;"), QString::fromUtf16(u"\x22DA")},
-    {QStringLiteral("&leq;"), QString::fromUtf16(u"\x2264")},
-    {QStringLiteral("&leqq;"), QString::fromUtf16(u"\x2266")},
-    {QStringLiteral("&leqslant;"), QString::fromUtf16(u"\x2A7D")},
-    {QStringLiteral("&les;"), QString::fromUtf16(u"\x2A7D")},
-    {QStringLiteral("&lescc;"), QString::fromUtf16(u"\x2AA8")},
-    {QStringLiteral("&lesdot;"), QString::fromUtf16(u"\x2A7F")},
-    {QStringLiteral("&lesdoto;"), QString::fromUtf16(u"\x2A81")},
-    {QStringLiteral("&lesdotor;"), QString::fromUtf16(u"\x2A83")},
-    {QStringLiteral("&lesg;"), QString::fromUtf16(u"\x22DA\xFE00")},
-    {QStringLiteral("&lesges;"), QString::fromUtf16(u"\x2A93")},
-    {QStringLiteral("&lessapprox;"), QString::fromUtf16(u"\x2A85")},
-    {QStringLiteral("&lessdot;"), QString::fromUtf16(u"\x22D6")},
-    {QStringLiteral("&lesseqgtr;"), QString::fromUtf16(u"\x22DA")},
-    {QStringLiteral("&lesseqqgtr;"), QString::fromUtf16(u"\x2A8B")},
-    {QStringLiteral("&lessgtr;"), QString::fromUtf16(u"\x2276")},
-    {QStringLiteral("&lesssim;"), QString::fromUtf16(u"\x2272")},
-    {QStringLiteral("&lfisht;"), QString::fromUtf16(u"\x297C")},
-    {QStringLiteral("&lfloor;"), QString::fromUtf16(u"\x230A")},
-    {QStringLiteral("&lfr;"), QString::fromUtf16(u"\xD835\xDD29")},
-    {QStringLiteral("&lg;"), QString::fromUtf16(u"\x2276")},
-    {QStringLiteral("&lgE;"), QString::fromUtf16(u"\x2A91")},
-    {QStringLiteral("&lhard;"), QString::fromUtf16(u"\x21BD")},
-    {QStringLiteral("&lharu;"), QString::fromUtf16(u"\x21BC")},
-    {QStringLiteral("&lharul;"), QString::fromUtf16(u"\x296A")},
-    {QStringLiteral("&lhblk;"), QString::fromUtf16(u"\x2584")},
-    {QStringLiteral("&ljcy;"), QString::fromUtf16(u"\x0459")},
-    {QStringLiteral("&ll;"), QString::fromUtf16(u"\x226A")},
-    {QStringLiteral("&llarr;"), QString::fromUtf16(u"\x21C7")},
-    {QStringLiteral("&llcorner;"), QString::fromUtf16(u"\x231E")},
-    {QStringLiteral("&llhard;"), QString::fromUtf16(u"\x296B")},
-    {QStringLiteral("&lltri;"), QString::fromUtf16(u"\x25FA")},
-    {QStringLiteral("&lmidot;"), QString::fromUtf16(u"\x0140")},
-    {QStringLiteral("&lmoust;"), QString::fromUtf16(u"\x23B0")},
-    {QStringLiteral("&lmoustache;"), QString::fromUtf16(u"\x23B0")},
-    {QStringLiteral("&lnE;"), QString::fromUtf16(u"\x2268")},
-    {QStringLiteral("&lnap;"), QString::fromUtf16(u"\x2A89")},
-    {QStringLiteral("&lnapprox;"), QString::fromUtf16(u"\x2A89")},
-    {QStringLiteral("&lne;"), QString::fromUtf16(u"\x2A87")},
-    {QStringLiteral("&lneq;"), QString::fromUtf16(u"\x2A87")},
-    {QStringLiteral("&lneqq;"), QString::fromUtf16(u"\x2268")},
-    {QStringLiteral("&lnsim;"), QString::fromUtf16(u"\x22E6")},
-    {QStringLiteral("&loang;"), QString::fromUtf16(u"\x27EC")},
-    {QStringLiteral("&loarr;"), QString::fromUtf16(u"\x21FD")},
-    {QStringLiteral("&lobrk;"), QString::fromUtf16(u"\x27E6")},
-    {QStringLiteral("&longleftarrow;"), QString::fromUtf16(u"\x27F5")},
-    {QStringLiteral("&longleftrightarrow;"), QString::fromUtf16(u"\x27F7")},
-    {QStringLiteral("&longmapsto;"), QString::fromUtf16(u"\x27FC")},
-    {QStringLiteral("&longrightarrow;"), QString::fromUtf16(u"\x27F6")},
-    {QStringLiteral("&looparrowleft;"), QString::fromUtf16(u"\x21AB")},
-    {QStringLiteral("&looparrowright;"), QString::fromUtf16(u"\x21AC")},
-    {QStringLiteral("&lopar;"), QString::fromUtf16(u"\x2985")},
-    {QStringLiteral("&lopf;"), QString::fromUtf16(u"\xD835\xDD5D")},
-    {QStringLiteral("&loplus;"), QString::fromUtf16(u"\x2A2D")},
-    {QStringLiteral("&lotimes;"), QString::fromUtf16(u"\x2A34")},
-    {QStringLiteral("&lowast;"), QString::fromUtf16(u"\x2217")},
-    {QStringLiteral("&lowbar;"), QString::fromUtf16(u"\x005F")},
-    {QStringLiteral("&loz;"), QString::fromUtf16(u"\x25CA")},
-    {QStringLiteral("&lozenge;"), QString::fromUtf16(u"\x25CA")},
-    {QStringLiteral("&lozf;"), QString::fromUtf16(u"\x29EB")},
-    {QStringLiteral("&lpar;"), QString::fromUtf16(u"\x0028")},
-    {QStringLiteral("&lparlt;"), QString::fromUtf16(u"\x2993")},
-    {QStringLiteral("&lrarr;"), QString::fromUtf16(u"\x21C6")},
-    {QStringLiteral("&lrcorner;"), QString::fromUtf16(u"\x231F")},
-    {QStringLiteral("&lrhar;"), QString::fromUtf16(u"\x21CB")},
-    {QStringLiteral("&lrhard;"), QString::fromUtf16(u"\x296D")},
-    {QStringLiteral("&lrm;"), QString::fromUtf16(u"\x200E")},
-    {QStringLiteral("&lrtri;"), QString::fromUtf16(u"\x22BF")},
-    {QStringLiteral("&lsaquo;"), QString::fromUtf16(u"\x2039")},
-    {QStringLiteral("&lscr;"), QString::fromUtf16(u"\xD835\xDCC1")},
-    {QStringLiteral("&lsh;"), QString::fromUtf16(u"\x21B0")},
-    {QStringLiteral("&lsim;"), QString::fromUtf16(u"\x2272")},
-    {QStringLiteral("&lsime;"), QString::fromUtf16(u"\x2A8D")},
-    {QStringLiteral("&lsimg;"), QString::fromUtf16(u"\x2A8F")},
-    {QStringLiteral("&lsqb;"), QString::fromUtf16(u"\x005B")},
-    {QStringLiteral("&lsquo;"), QString::fromUtf16(u"\x2018")},
-    {QStringLiteral("&lsquor;"), QString::fromUtf16(u"\x201A")},
-    {QStringLiteral("&lstrok;"), QString::fromUtf16(u"\x0142")},
-    {QStringLiteral("&lt"), QString::fromUtf16(u"\x003C")},
-    {QStringLiteral("&lt;"), QString::fromUtf16(u"\x003C")},
-    {QStringLiteral("&ltcc;"), QString::fromUtf16(u"\x2AA6")},
-    {QStringLiteral("&ltcir;"), QString::fromUtf16(u"\x2A79")},
-    {QStringLiteral("&ltdot;"), QString::fromUtf16(u"\x22D6")},
-    {QStringLiteral("&lthree;"), QString::fromUtf16(u"\x22CB")},
-    {QStringLiteral("&ltimes;"), QString::fromUtf16(u"\x22C9")},
-    {QStringLiteral("&ltlarr;"), QString::fromUtf16(u"\x2976")},
-    {QStringLiteral("&ltquest;"), QString::fromUtf16(u"\x2A7B")},
-    {QStringLiteral("&ltrPar;"), QString::fromUtf16(u"\x2996")},
-    {QStringLiteral("&ltri;"), QString::fromUtf16(u"\x25C3")},
-    {QStringLiteral("&ltrie;"), QString::fromUtf16(u"\x22B4")},
-    {QStringLiteral("&ltrif;"), QString::fromUtf16(u"\x25C2")},
-    {QStringLiteral("&lurdshar;"), QString::fromUtf16(u"\x294A")},
-    {QStringLiteral("&luruhar;"), QString::fromUtf16(u"\x2966")},
-    {QStringLiteral("&lvertneqq;"), QString::fromUtf16(u"\x2268\xFE00")},
-    {QStringLiteral("&lvnE;"), QString::fromUtf16(u"\x2268\xFE00")},
-    {QStringLiteral("&mDDot;"), QString::fromUtf16(u"\x223A")},
-    {QStringLiteral("&macr"), QString::fromUtf16(u"\x00AF")},
-    {QStringLiteral("&macr;"), QString::fromUtf16(u"\x00AF")},
-    {QStringLiteral("&male;"), QString::fromUtf16(u"\x2642")},
-    {QStringLiteral("&malt;"), QString::fromUtf16(u"\x2720")},
-    {QStringLiteral("&maltese;"), QString::fromUtf16(u"\x2720")},
-    {QStringLiteral("&map;"), QString::fromUtf16(u"\x21A6")},
-    {QStringLiteral("&mapsto;"), QString::fromUtf16(u"\x21A6")},
-    {QStringLiteral("&mapstodown;"), QString::fromUtf16(u"\x21A7")},
-    {QStringLiteral("&mapstoleft;"), QString::fromUtf16(u"\x21A4")},
-    {QStringLiteral("&mapstoup;"), QString::fromUtf16(u"\x21A5")},
-    {QStringLiteral("&marker;"), QString::fromUtf16(u"\x25AE")},
-    {QStringLiteral("&mcomma;"), QString::fromUtf16(u"\x2A29")},
-    {QStringLiteral("&mcy;"), QString::fromUtf16(u"\x043C")},
-    {QStringLiteral("&mdash;"), QString::fromUtf16(u"\x2014")},
-    {QStringLiteral("&measuredangle;"), QString::fromUtf16(u"\x2221")},
-    {QStringLiteral("&mfr;"), QString::fromUtf16(u"\xD835\xDD2A")},
-    {QStringLiteral("&mho;"), QString::fromUtf16(u"\x2127")},
-    {QStringLiteral("&micro"), QString::fromUtf16(u"\x00B5")},
-    {QStringLiteral("&micro;"), QString::fromUtf16(u"\x00B5")},
-    {QStringLiteral("&mid;"), QString::fromUtf16(u"\x2223")},
-    {QStringLiteral("&midast;"), QString::fromUtf16(u"\x002A")},
-    {QStringLiteral("&midcir;"), QString::fromUtf16(u"\x2AF0")},
-    {QStringLiteral("&middot"), QString::fromUtf16(u"\x00B7")},
-    {QStringLiteral("&middot;"), QString::fromUtf16(u"\x00B7")},
-    {QStringLiteral("&minus;"), QString::fromUtf16(u"\x2212")},
-    {QStringLiteral("&minusb;"), QString::fromUtf16(u"\x229F")},
-    {QStringLiteral("&minusd;"), QString::fromUtf16(u"\x2238")},
-    {QStringLiteral("&minusdu;"), QString::fromUtf16(u"\x2A2A")},
-    {QStringLiteral("&mlcp;"), QString::fromUtf16(u"\x2ADB")},
-    {QStringLiteral("&mldr;"), QString::fromUtf16(u"\x2026")},
-    {QStringLiteral("&mnplus;"), QString::fromUtf16(u"\x2213")},
-    {QStringLiteral("&models;"), QString::fromUtf16(u"\x22A7")},
-    {QStringLiteral("&mopf;"), QString::fromUtf16(u"\xD835\xDD5E")},
-    {QStringLiteral("&mp;"), QString::fromUtf16(u"\x2213")},
-    {QStringLiteral("&mscr;"), QString::fromUtf16(u"\xD835\xDCC2")},
-    {QStringLiteral("&mstpos;"), QString::fromUtf16(u"\x223E")},
-    {QStringLiteral("&mu;"), QString::fromUtf16(u"\x03BC")},
-    {QStringLiteral("&multimap;"), QString::fromUtf16(u"\x22B8")},
-    {QStringLiteral("&mumap;"), QString::fromUtf16(u"\x22B8")},
-    {QStringLiteral("&nGg;"), QString::fromUtf16(u"\x22D9\x0338")},
-    {QStringLiteral("&nGt;"), QString::fromUtf16(u"\x226B\x20D2")},
-    {QStringLiteral("&nGtv;"), QString::fromUtf16(u"\x226B\x0338")},
-    {QStringLiteral("&nLeftarrow;"), QString::fromUtf16(u"\x21CD")},
-    {QStringLiteral("&nLeftrightarrow;"), QString::fromUtf16(u"\x21CE")},
-    {QStringLiteral("&nLl;"), QString::fromUtf16(u"\x22D8\x0338")},
-    {QStringLiteral("&nLt;"), QString::fromUtf16(u"\x226A\x20D2")},
-    {QStringLiteral("&nLtv;"), QString::fromUtf16(u"\x226A\x0338")},
-    {QStringLiteral("&nRightarrow;"), QString::fromUtf16(u"\x21CF")},
-    {QStringLiteral("&nVDash;"), QString::fromUtf16(u"\x22AF")},
-    {QStringLiteral("&nVdash;"), QString::fromUtf16(u"\x22AE")},
-    {QStringLiteral("&nabla;"), QString::fromUtf16(u"\x2207")},
-    {QStringLiteral("&nacute;"), QString::fromUtf16(u"\x0144")},
-    {QStringLiteral("&nang;"), QString::fromUtf16(u"\x2220\x20D2")},
-    {QStringLiteral("&nap;"), QString::fromUtf16(u"\x2249")},
-    {QStringLiteral("&napE;"), QString::fromUtf16(u"\x2A70\x0338")},
-    {QStringLiteral("&napid;"), QString::fromUtf16(u"\x224B\x0338")},
-    {QStringLiteral("&napos;"), QString::fromUtf16(u"\x0149")},
-    {QStringLiteral("&napprox;"), QString::fromUtf16(u"\x2249")},
-    {QStringLiteral("&natur;"), QString::fromUtf16(u"\x266E")},
-    {QStringLiteral("&natural;"), QString::fromUtf16(u"\x266E")},
-    {QStringLiteral("&naturals;"), QString::fromUtf16(u"\x2115")},
-    {QStringLiteral("&nbsp"), QString::fromUtf16(u"\x00A0")},
-    {QStringLiteral("&nbsp;"), QString::fromUtf16(u"\x00A0")},
-    {QStringLiteral("&nbump;"), QString::fromUtf16(u"\x224E\x0338")},
-    {QStringLiteral("&nbumpe;"), QString::fromUtf16(u"\x224F\x0338")},
-    {QStringLiteral("&ncap;"), QString::fromUtf16(u"\x2A43")},
-    {QStringLiteral("&ncaron;"), QString::fromUtf16(u"\x0148")},
-    {QStringLiteral("&ncedil;"), QString::fromUtf16(u"\x0146")},
-    {QStringLiteral("&ncong;"), QString::fromUtf16(u"\x2247")},
-    {QStringLiteral("&ncongdot;"), QString::fromUtf16(u"\x2A6D\x0338")},
-    {QStringLiteral("&ncup;"), QString::fromUtf16(u"\x2A42")},
-    {QStringLiteral("&ncy;"), QString::fromUtf16(u"\x043D")},
-    {QStringLiteral("&ndash;"), QString::fromUtf16(u"\x2013")},
-    {QStringLiteral("&ne;"), QString::fromUtf16(u"\x2260")},
-    {QStringLiteral("&neArr;"), QString::fromUtf16(u"\x21D7")},
-    {QStringLiteral("&nearhk;"), QString::fromUtf16(u"\x2924")},
-    {QStringLiteral("&nearr;"), QString::fromUtf16(u"\x2197")},
-    {QStringLiteral("&nearrow;"), QString::fromUtf16(u"\x2197")},
-    {QStringLiteral("&nedot;"), QString::fromUtf16(u"\x2250\x0338")},
-    {QStringLiteral("&nequiv;"), QString::fromUtf16(u"\x2262")},
-    {QStringLiteral("&nesear;"), QString::fromUtf16(u"\x2928")},
-    {QStringLiteral("&nesim;"), QString::fromUtf16(u"\x2242\x0338")},
-    {QStringLiteral("&nexist;"), QString::fromUtf16(u"\x2204")},
-    {QStringLiteral("&nexists;"), QString::fromUtf16(u"\x2204")},
-    {QStringLiteral("&nfr;"), QString::fromUtf16(u"\xD835\xDD2B")},
-    {QStringLiteral("&ngE;"), QString::fromUtf16(u"\x2267\x0338")},
-    {QStringLiteral("&nge;"), QString::fromUtf16(u"\x2271")},
-    {QStringLiteral("&ngeq;"), QString::fromUtf16(u"\x2271")},
-    {QStringLiteral("&ngeqq;"), QString::fromUtf16(u"\x2267\x0338")},
-    {QStringLiteral("&ngeqslant;"), QString::fromUtf16(u"\x2A7E\x0338")},
-    {QStringLiteral("&nges;"), QString::fromUtf16(u"\x2A7E\x0338")},
-    {QStringLiteral("&ngsim;"), QString::fromUtf16(u"\x2275")},
-    {QStringLiteral("&ngt;"), QString::fromUtf16(u"\x226F")},
-    {QStringLiteral("&ngtr;"), QString::fromUtf16(u"\x226F")},
-    {QStringLiteral("&nhArr;"), QString::fromUtf16(u"\x21CE")},
-    {QStringLiteral("&nharr;"), QString::fromUtf16(u"\x21AE")},
-    {QStringLiteral("&nhpar;"), QString::fromUtf16(u"\x2AF2")},
-    {QStringLiteral("&ni;"), QString::fromUtf16(u"\x220B")},
-    {QStringLiteral("&nis;"), QString::fromUtf16(u"\x22FC")},
-    {QStringLiteral("&nisd;"), QString::fromUtf16(u"\x22FA")},
-    {QStringLiteral("&niv;"), QString::fromUtf16(u"\x220B")},
-    {QStringLiteral("&njcy;"), QString::fromUtf16(u"\x045A")},
-    {QStringLiteral("&nlArr;"), QString::fromUtf16(u"\x21CD")},
-    {QStringLiteral("&nlE;"), QString::fromUtf16(u"\x2266\x0338")},
-    {QStringLiteral("&nlarr;"), QString::fromUtf16(u"\x219A")},
-    {QStringLiteral("&nldr;"), QString::fromUtf16(u"\x2025")},
-    {QStringLiteral("&nle;"), QString::fromUtf16(u"\x2270")},
-    {QStringLiteral("&nleftarrow;"), QString::fromUtf16(u"\x219A")},
-    {QStringLiteral("&nleftrightarrow;"), QString::fromUtf16(u"\x21AE")},
-    {QStringLiteral("&nleq;"), QString::fromUtf16(u"\x2270")},
-    {QStringLiteral("&nleqq;"), QString::fromUtf16(u"\x2266\x0338")},
-    {QStringLiteral("&nleqslant;"), QString::fromUtf16(u"\x2A7D\x0338")},
-    {QStringLiteral("&nles;"), QString::fromUtf16(u"\x2A7D\x0338")},
-    {QStringLiteral("&nless;"), QString::fromUtf16(u"\x226E")},
-    {QStringLiteral("&nlsim;"), QString::fromUtf16(u"\x2274")},
-    {QStringLiteral("&nlt;"), QString::fromUtf16(u"\x226E")},
-    {QStringLiteral("&nltri;"), QString::fromUtf16(u"\x22EA")},
-    {QStringLiteral("&nltrie;"), QString::fromUtf16(u"\x22EC")},
-    {QStringLiteral("&nmid;"), QString::fromUtf16(u"\x2224")},
-    {QStringLiteral("&nopf;"), QString::fromUtf16(u"\xD835\xDD5F")},
-    {QStringLiteral("&not"), QString::fromUtf16(u"\x00AC")},
-    {QStringLiteral("&not;"), QString::fromUtf16(u"\x00AC")},
-    {QStringLiteral("&notin;"), QString::fromUtf16(u"\x2209")},
-    {QStringLiteral("&notinE;"), QString::fromUtf16(u"\x22F9\x0338")},
-    {QStringLiteral("&notindot;"), QString::fromUtf16(u"\x22F5\x0338")},
-    {QStringLiteral("&notinva;"), QString::fromUtf16(u"\x2209")},
-    {QStringLiteral("&notinvb;"), QString::fromUtf16(u"\x22F7")},
-    {QStringLiteral("&notinvc;"), QString::fromUtf16(u"\x22F6")},
-    {QStringLiteral("&notni;"), QString::fromUtf16(u"\x220C")},
-    {QStringLiteral("&notniva;"), QString::fromUtf16(u"\x220C")},
-    {QStringLiteral("&notnivb;"), QString::fromUtf16(u"\x22FE")},
-    {QStringLiteral("&notnivc;"), QString::fromUtf16(u"\x22FD")},
-    {QStringLiteral("&npar;"), QString::fromUtf16(u"\x2226")},
-    {QStringLiteral("&nparallel;"), QString::fromUtf16(u"\x2226")},
-    {QStringLiteral("&nparsl;"), QString::fromUtf16(u"\x2AFD\x20E5")},
-    {QStringLiteral("&npart;"), QString::fromUtf16(u"\x2202\x0338")},
-    {QStringLiteral("&npolint;"), QString::fromUtf16(u"\x2A14")},
-    {QStringLiteral("&npr;"), QString::fromUtf16(u"\x2280")},
-    {QStringLiteral("&nprcue;"), QString::fromUtf16(u"\x22E0")},
-    {QStringLiteral("&npre;"), QString::fromUtf16(u"\x2AAF\x0338")},
-    {QStringLiteral("&nprec;"), QString::fromUtf16(u"\x2280")},
-    {QStringLiteral("&npreceq;"), QString::fromUtf16(u"\x2AAF\x0338")},
-    {QStringLiteral("&nrArr;"), QString::fromUtf16(u"\x21CF")},
-    {QStringLiteral("&nrarr;"), QString::fromUtf16(u"\x219B")},
-    {QStringLiteral("&nrarrc;"), QString::fromUtf16(u"\x2933\x0338")},
-    {QStringLiteral("&nrarrw;"), QString::fromUtf16(u"\x219D\x0338")},
-    {QStringLiteral("&nrightarrow;"), QString::fromUtf16(u"\x219B")},
-    {QStringLiteral("&nrtri;"), QString::fromUtf16(u"\x22EB")},
-    {QStringLiteral("&nrtrie;"), QString::fromUtf16(u"\x22ED")},
-    {QStringLiteral("&nsc;"), QString::fromUtf16(u"\x2281")},
-    {QStringLiteral("&nsccue;"), QString::fromUtf16(u"\x22E1")},
-    {QStringLiteral("&nsce;"), QString::fromUtf16(u"\x2AB0\x0338")},
-    {QStringLiteral("&nscr;"), QString::fromUtf16(u"\xD835\xDCC3")},
-    {QStringLiteral("&nshortmid;"), QString::fromUtf16(u"\x2224")},
-    {QStringLiteral("&nshortparallel;"), QString::fromUtf16(u"\x2226")},
-    {QStringLiteral("&nsim;"), QString::fromUtf16(u"\x2241")},
-    {QStringLiteral("&nsime;"), QString::fromUtf16(u"\x2244")},
-    {QStringLiteral("&nsimeq;"), QString::fromUtf16(u"\x2244")},
-    {QStringLiteral("&nsmid;"), QString::fromUtf16(u"\x2224")},
-    {QStringLiteral("&nspar;"), QString::fromUtf16(u"\x2226")},
-    {QStringLiteral("&nsqsube;"), QString::fromUtf16(u"\x22E2")},
-    {QStringLiteral("&nsqsupe;"), QString::fromUtf16(u"\x22E3")},
-    {QStringLiteral("&nsub;"), QString::fromUtf16(u"\x2284")},
-    {QStringLiteral("&nsubE;"), QString::fromUtf16(u"\x2AC5\x0338")},
-    {QStringLiteral("&nsube;"), QString::fromUtf16(u"\x2288")},
-    {QStringLiteral("&nsubset;"), QString::fromUtf16(u"\x2282\x20D2")},
-    {QStringLiteral("&nsubseteq;"), QString::fromUtf16(u"\x2288")},
-    {QStringLiteral("&nsubseteqq;"), QString::fromUtf16(u"\x2AC5\x0338")},
-    {QStringLiteral("&nsucc;"), QString::fromUtf16(u"\x2281")},
-    {QStringLiteral("&nsucceq;"), QString::fromUtf16(u"\x2AB0\x0338")},
-    {QStringLiteral("&nsup;"), QString::fromUtf16(u"\x2285")},
-    {QStringLiteral("&nsupE;"), QString::fromUtf16(u"\x2AC6\x0338")},
-    {QStringLiteral("&nsupe;"), QString::fromUtf16(u"\x2289")},
-    {QStringLiteral("&nsupset;"), QString::fromUtf16(u"\x2283\x20D2")},
-    {QStringLiteral("&nsupseteq;"), QString::fromUtf16(u"\x2289")},
-    {QStringLiteral("&nsupseteqq;"), QString::fromUtf16(u"\x2AC6\x0338")},
-    {QStringLiteral("&ntgl;"), QString::fromUtf16(u"\x2279")},
-    {QStringLiteral("&ntilde"), QString::fromUtf16(u"\x00F1")},
-    {QStringLiteral("&ntilde;"), QString::fromUtf16(u"\x00F1")},
-    {QStringLiteral("&ntlg;"), QString::fromUtf16(u"\x2278")},
-    {QStringLiteral("&ntriangleleft;"), QString::fromUtf16(u"\x22EA")},
-    {QStringLiteral("&ntrianglelefteq;"), QString::fromUtf16(u"\x22EC")},
-    {QStringLiteral("&ntriangleright;"), QString::fromUtf16(u"\x22EB")},
-    {QStringLiteral("&ntrianglerighteq;"), QString::fromUtf16(u"\x22ED")},
-    {QStringLiteral("&nu;"), QString::fromUtf16(u"\x03BD")},
-    {QStringLiteral("&num;"), QString::fromUtf16(u"\x0023")},
-    {QStringLiteral("&numero;"), QString::fromUtf16(u"\x2116")},
-    {QStringLiteral("&numsp;"), QString::fromUtf16(u"\x2007")},
-    {QStringLiteral("&nvDash;"), QString::fromUtf16(u"\x22AD")},
-    {QStringLiteral("&nvHarr;"), QString::fromUtf16(u"\x2904")},
-    {QStringLiteral("&nvap;"), QString::fromUtf16(u"\x224D\x20D2")},
-    {QStringLiteral("&nvdash;"), QString::fromUtf16(u"\x22AC")},
-    {QStringLiteral("&nvge;"), QString::fromUtf16(u"\x2265\x20D2")},
-    {QStringLiteral("&nvgt;"), QString::fromUtf16(u"\x003E\x20D2")},
-    {QStringLiteral("&nvinfin;"), QString::fromUtf16(u"\x29DE")},
-    {QStringLiteral("&nvlArr;"), QString::fromUtf16(u"\x2902")},
-    {QStringLiteral("&nvle;"), QString::fromUtf16(u"\x2264\x20D2")},
-    {QStringLiteral("&nvlt;"), QString::fromUtf16(u"\x003C\x20D2")},
-    {QStringLiteral("&nvltrie;"), QString::fromUtf16(u"\x22B4\x20D2")},
-    {QStringLiteral("&nvrArr;"), QString::fromUtf16(u"\x2903")},
-    {QStringLiteral("&nvrtrie;"), QString::fromUtf16(u"\x22B5\x20D2")},
-    {QStringLiteral("&nvsim;"), QString::fromUtf16(u"\x223C\x20D2")},
-    {QStringLiteral("&nwArr;"), QString::fromUtf16(u"\x21D6")},
-    {QStringLiteral("&nwarhk;"), QString::fromUtf16(u"\x2923")},
-    {QStringLiteral("&nwarr;"), QString::fromUtf16(u"\x2196")},
-    {QStringLiteral("&nwarrow;"), QString::fromUtf16(u"\x2196")},
-    {QStringLiteral("&nwnear;"), QString::fromUtf16(u"\x2927")},
-    {QStringLiteral("&oS;"), QString::fromUtf16(u"\x24C8")},
-    {QStringLiteral("&oacute"), QString::fromUtf16(u"\x00F3")},
-    {QStringLiteral("&oacute;"), QString::fromUtf16(u"\x00F3")},
-    {QStringLiteral("&oast;"), QString::fromUtf16(u"\x229B")},
-    {QStringLiteral("&ocir;"), QString::fromUtf16(u"\x229A")},
-    {QStringLiteral("&ocirc"), QString::fromUtf16(u"\x00F4")},
-    {QStringLiteral("&ocirc;"), QString::fromUtf16(u"\x00F4")},
-    {QStringLiteral("&ocy;"), QString::fromUtf16(u"\x043E")},
-    {QStringLiteral("&odash;"), QString::fromUtf16(u"\x229D")},
-    {QStringLiteral("&odblac;"), QString::fromUtf16(u"\x0151")},
-    {QStringLiteral("&odiv;"), QString::fromUtf16(u"\x2A38")},
-    {QStringLiteral("&odot;"), QString::fromUtf16(u"\x2299")},
-    {QStringLiteral("&odsold;"), QString::fromUtf16(u"\x29BC")},
-    {QStringLiteral("&oelig;"), QString::fromUtf16(u"\x0153")},
-    {QStringLiteral("&ofcir;"), QString::fromUtf16(u"\x29BF")},
-    {QStringLiteral("&ofr;"), QString::fromUtf16(u"\xD835\xDD2C")},
-    {QStringLiteral("&ogon;"), QString::fromUtf16(u"\x02DB")},
-    {QStringLiteral("&ograve"), QString::fromUtf16(u"\x00F2")},
-    {QStringLiteral("&ograve;"), QString::fromUtf16(u"\x00F2")},
-    {QStringLiteral("&ogt;"), QString::fromUtf16(u"\x29C1")},
-    {QStringLiteral("&ohbar;"), QString::fromUtf16(u"\x29B5")},
-    {QStringLiteral("&ohm;"), QString::fromUtf16(u"\x03A9")},
-    {QStringLiteral("&oint;"), QString::fromUtf16(u"\x222E")},
-    {QStringLiteral("&olarr;"), QString::fromUtf16(u"\x21BA")},
-    {QStringLiteral("&olcir;"), QString::fromUtf16(u"\x29BE")},
-    {QStringLiteral("&olcross;"), QString::fromUtf16(u"\x29BB")},
-    {QStringLiteral("&oline;"), QString::fromUtf16(u"\x203E")},
-    {QStringLiteral("&olt;"), QString::fromUtf16(u"\x29C0")},
-    {QStringLiteral("&omacr;"), QString::fromUtf16(u"\x014D")},
-    {QStringLiteral("&omega;"), QString::fromUtf16(u"\x03C9")},
-    {QStringLiteral("&omicron;"), QString::fromUtf16(u"\x03BF")},
-    {QStringLiteral("&omid;"), QString::fromUtf16(u"\x29B6")},
-    {QStringLiteral("&ominus;"), QString::fromUtf16(u"\x2296")},
-    {QStringLiteral("&oopf;"), QString::fromUtf16(u"\xD835\xDD60")},
-    {QStringLiteral("&opar;"), QString::fromUtf16(u"\x29B7")},
-    {QStringLiteral("&operp;"), QString::fromUtf16(u"\x29B9")},
-    {QStringLiteral("&oplus;"), QString::fromUtf16(u"\x2295")},
-    {QStringLiteral("&or;"), QString::fromUtf16(u"\x2228")},
-    {QStringLiteral("&orarr;"), QString::fromUtf16(u"\x21BB")},
-    {QStringLiteral("&ord;"), QString::fromUtf16(u"\x2A5D")},
-    {QStringLiteral("&order;"), QString::fromUtf16(u"\x2134")},
-    {QStringLiteral("&orderof;"), QString::fromUtf16(u"\x2134")},
-    {QStringLiteral("&ordf"), QString::fromUtf16(u"\x00AA")},
-    {QStringLiteral("&ordf;"), QString::fromUtf16(u"\x00AA")},
-    {QStringLiteral("&ordm"), QString::fromUtf16(u"\x00BA")},
-    {QStringLiteral("&ordm;"), QString::fromUtf16(u"\x00BA")},
-    {QStringLiteral("&origof;"), QString::fromUtf16(u"\x22B6")},
-    {QStringLiteral("&oror;"), QString::fromUtf16(u"\x2A56")},
-    {QStringLiteral("&orslope;"), QString::fromUtf16(u"\x2A57")},
-    {QStringLiteral("&orv;"), QString::fromUtf16(u"\x2A5B")},
-    {QStringLiteral("&oscr;"), QString::fromUtf16(u"\x2134")},
-    {QStringLiteral("&oslash"), QString::fromUtf16(u"\x00F8")},
-    {QStringLiteral("&oslash;"), QString::fromUtf16(u"\x00F8")},
-    {QStringLiteral("&osol;"), QString::fromUtf16(u"\x2298")},
-    {QStringLiteral("&otilde"), QString::fromUtf16(u"\x00F5")},
-    {QStringLiteral("&otilde;"), QString::fromUtf16(u"\x00F5")},
-    {QStringLiteral("&otimes;"), QString::fromUtf16(u"\x2297")},
-    {QStringLiteral("&otimesas;"), QString::fromUtf16(u"\x2A36")},
-    {QStringLiteral("&ouml"), QString::fromUtf16(u"\x00F6")},
-    {QStringLiteral("&ouml;"), QString::fromUtf16(u"\x00F6")},
-    {QStringLiteral("&ovbar;"), QString::fromUtf16(u"\x233D")},
-    {QStringLiteral("&par;"), QString::fromUtf16(u"\x2225")},
-    {QStringLiteral("&para"), QString::fromUtf16(u"\x00B6")},
-    {QStringLiteral("&para;"), QString::fromUtf16(u"\x00B6")},
-    {QStringLiteral("&parallel;"), QString::fromUtf16(u"\x2225")},
-    {QStringLiteral("&parsim;"), QString::fromUtf16(u"\x2AF3")},
-    {QStringLiteral("&parsl;"), QString::fromUtf16(u"\x2AFD")},
-    {QStringLiteral("&part;"), QString::fromUtf16(u"\x2202")},
-    {QStringLiteral("&pcy;"), QString::fromUtf16(u"\x043F")},
-    {QStringLiteral("&percnt;"), QString::fromUtf16(u"\x0025")},
-    {QStringLiteral("&period;"), QString::fromUtf16(u"\x002E")},
-    {QStringLiteral("&permil;"), QString::fromUtf16(u"\x2030")},
-    {QStringLiteral("&perp;"), QString::fromUtf16(u"\x22A5")},
-    {QStringLiteral("&pertenk;"), QString::fromUtf16(u"\x2031")},
-    {QStringLiteral("&pfr;"), QString::fromUtf16(u"\xD835\xDD2D")},
-    {QStringLiteral("&phi;"), QString::fromUtf16(u"\x03C6")},
-    {QStringLiteral("&phiv;"), QString::fromUtf16(u"\x03D5")},
-    {QStringLiteral("&phmmat;"), QString::fromUtf16(u"\x2133")},
-    {QStringLiteral("&phone;"), QString::fromUtf16(u"\x260E")},
-    {QStringLiteral("&pi;"), QString::fromUtf16(u"\x03C0")},
-    {QStringLiteral("&pitchfork;"), QString::fromUtf16(u"\x22D4")},
-    {QStringLiteral("&piv;"), QString::fromUtf16(u"\x03D6")},
-    {QStringLiteral("&planck;"), QString::fromUtf16(u"\x210F")},
-    {QStringLiteral("&planckh;"), QString::fromUtf16(u"\x210E")},
-    {QStringLiteral("&plankv;"), QString::fromUtf16(u"\x210F")},
-    {QStringLiteral("&plus;"), QString::fromUtf16(u"\x002B")},
-    {QStringLiteral("&plusacir;"), QString::fromUtf16(u"\x2A23")},
-    {QStringLiteral("&plusb;"), QString::fromUtf16(u"\x229E")},
-    {QStringLiteral("&pluscir;"), QString::fromUtf16(u"\x2A22")},
-    {QStringLiteral("&plusdo;"), QString::fromUtf16(u"\x2214")},
-    {QStringLiteral("&plusdu;"), QString::fromUtf16(u"\x2A25")},
-    {QStringLiteral("&pluse;"), QString::fromUtf16(u"\x2A72")},
-    {QStringLiteral("&plusmn"), QString::fromUtf16(u"\x00B1")},
-    {QStringLiteral("&plusmn;"), QString::fromUtf16(u"\x00B1")},
-    {QStringLiteral("&plussim;"), QString::fromUtf16(u"\x2A26")},
-    {QStringLiteral("&plustwo;"), QString::fromUtf16(u"\x2A27")},
-    {QStringLiteral("&pm;"), QString::fromUtf16(u"\x00B1")},
-    {QStringLiteral("&pointint;"), QString::fromUtf16(u"\x2A15")},
-    {QStringLiteral("&popf;"), QString::fromUtf16(u"\xD835\xDD61")},
-    {QStringLiteral("&pound"), QString::fromUtf16(u"\x00A3")},
-    {QStringLiteral("&pound;"), QString::fromUtf16(u"\x00A3")},
-    {QStringLiteral("&pr;"), QString::fromUtf16(u"\x227A")},
-    {QStringLiteral("&prE;"), QString::fromUtf16(u"\x2AB3")},
-    {QStringLiteral("&prap;"), QString::fromUtf16(u"\x2AB7")},
-    {QStringLiteral("&prcue;"), QString::fromUtf16(u"\x227C")},
-    {QStringLiteral("&pre;"), QString::fromUtf16(u"\x2AAF")},
-    {QStringLiteral("&prec;"), QString::fromUtf16(u"\x227A")},
-    {QStringLiteral("&precapprox;"), QString::fromUtf16(u"\x2AB7")},
-    {QStringLiteral("&preccurlyeq;"), QString::fromUtf16(u"\x227C")},
-    {QStringLiteral("&preceq;"), QString::fromUtf16(u"\x2AAF")},
-    {QStringLiteral("&precnapprox;"), QString::fromUtf16(u"\x2AB9")},
-    {QStringLiteral("&precneqq;"), QString::fromUtf16(u"\x2AB5")},
-    {QStringLiteral("&precnsim;"), QString::fromUtf16(u"\x22E8")},
-    {QStringLiteral("&precsim;"), QString::fromUtf16(u"\x227E")},
-    {QStringLiteral("&prime;"), QString::fromUtf16(u"\x2032")},
-    {QStringLiteral("&primes;"), QString::fromUtf16(u"\x2119")},
-    {QStringLiteral("&prnE;"), QString::fromUtf16(u"\x2AB5")},
-    {QStringLiteral("&prnap;"), QString::fromUtf16(u"\x2AB9")},
-    {QStringLiteral("&prnsim;"), QString::fromUtf16(u"\x22E8")},
-    {QStringLiteral("&prod;"), QString::fromUtf16(u"\x220F")},
-    {QStringLiteral("&profalar;"), QString::fromUtf16(u"\x232E")},
-    {QStringLiteral("&profline;"), QString::fromUtf16(u"\x2312")},
-    {QStringLiteral("&profsurf;"), QString::fromUtf16(u"\x2313")},
-    {QStringLiteral("&prop;"), QString::fromUtf16(u"\x221D")},
-    {QStringLiteral("&propto;"), QString::fromUtf16(u"\x221D")},
-    {QStringLiteral("&prsim;"), QString::fromUtf16(u"\x227E")},
-    {QStringLiteral("&prurel;"), QString::fromUtf16(u"\x22B0")},
-    {QStringLiteral("&pscr;"), QString::fromUtf16(u"\xD835\xDCC5")},
-    {QStringLiteral("&psi;"), QString::fromUtf16(u"\x03C8")},
-    {QStringLiteral("&puncsp;"), QString::fromUtf16(u"\x2008")},
-    {QStringLiteral("&qfr;"), QString::fromUtf16(u"\xD835\xDD2E")},
-    {QStringLiteral("&qint;"), QString::fromUtf16(u"\x2A0C")},
-    {QStringLiteral("&qopf;"), QString::fromUtf16(u"\xD835\xDD62")},
-    {QStringLiteral("&qprime;"), QString::fromUtf16(u"\x2057")},
-    {QStringLiteral("&qscr;"), QString::fromUtf16(u"\xD835\xDCC6")},
-    {QStringLiteral("&quaternions;"), QString::fromUtf16(u"\x210D")},
-    {QStringLiteral("&quatint;"), QString::fromUtf16(u"\x2A16")},
-    {QStringLiteral("&quest;"), QString::fromUtf16(u"\x003F")},
-    {QStringLiteral("&questeq;"), QString::fromUtf16(u"\x225F")},
-    {QStringLiteral("&quot"), QString::fromUtf16(u"\x0022")},
-    {QStringLiteral("&quot;"), QString::fromUtf16(u"\x0022")},
-    {QStringLiteral("&rAarr;"), QString::fromUtf16(u"\x21DB")},
-    {QStringLiteral("&rArr;"), QString::fromUtf16(u"\x21D2")},
-    {QStringLiteral("&rAtail;"), QString::fromUtf16(u"\x291C")},
-    {QStringLiteral("&rBarr;"), QString::fromUtf16(u"\x290F")},
-    {QStringLiteral("&rHar;"), QString::fromUtf16(u"\x2964")},
-    {QStringLiteral("&race;"), QString::fromUtf16(u"\x223D\x0331")},
-    {QStringLiteral("&racute;"), QString::fromUtf16(u"\x0155")},
-    {QStringLiteral("&radic;"), QString::fromUtf16(u"\x221A")},
-    {QStringLiteral("&raemptyv;"), QString::fromUtf16(u"\x29B3")},
-    {QStringLiteral("&rang;"), QString::fromUtf16(u"\x27E9")},
-    {QStringLiteral("&rangd;"), QString::fromUtf16(u"\x2992")},
-    {QStringLiteral("&range;"), QString::fromUtf16(u"\x29A5")},
-    {QStringLiteral("&rangle;"), QString::fromUtf16(u"\x27E9")},
-    {QStringLiteral("&raquo"), QString::fromUtf16(u"\x00BB")},
-    {QStringLiteral("&raquo;"), QString::fromUtf16(u"\x00BB")},
-    {QStringLiteral("&rarr;"), QString::fromUtf16(u"\x2192")},
-    {QStringLiteral("&rarrap;"), QString::fromUtf16(u"\x2975")},
-    {QStringLiteral("&rarrb;"), QString::fromUtf16(u"\x21E5")},
-    {QStringLiteral("&rarrbfs;"), QString::fromUtf16(u"\x2920")},
-    {QStringLiteral("&rarrc;"), QString::fromUtf16(u"\x2933")},
-    {QStringLiteral("&rarrfs;"), QString::fromUtf16(u"\x291E")},
-    {QStringLiteral("&rarrhk;"), QString::fromUtf16(u"\x21AA")},
-    {QStringLiteral("&rarrlp;"), QString::fromUtf16(u"\x21AC")},
-    {QStringLiteral("&rarrpl;"), QString::fromUtf16(u"\x2945")},
-    {QStringLiteral("&rarrsim;"), QString::fromUtf16(u"\x2974")},
-    {QStringLiteral("&rarrtl;"), QString::fromUtf16(u"\x21A3")},
-    {QStringLiteral("&rarrw;"), QString::fromUtf16(u"\x219D")},
-    {QStringLiteral("&ratail;"), QString::fromUtf16(u"\x291A")},
-    {QStringLiteral("&ratio;"), QString::fromUtf16(u"\x2236")},
-    {QStringLiteral("&rationals;"), QString::fromUtf16(u"\x211A")},
-    {QStringLiteral("&rbarr;"), QString::fromUtf16(u"\x290D")},
-    {QStringLiteral("&rbbrk;"), QString::fromUtf16(u"\x2773")},
-    {QStringLiteral("&rbrace;"), QString::fromUtf16(u"\x007D")},
-    {QStringLiteral("&rbrack;"), QString::fromUtf16(u"\x005D")},
-    {QStringLiteral("&rbrke;"), QString::fromUtf16(u"\x298C")},
-    {QStringLiteral("&rbrksld;"), QString::fromUtf16(u"\x298E")},
-    {QStringLiteral("&rbrkslu;"), QString::fromUtf16(u"\x2990")},
-    {QStringLiteral("&rcaron;"), QString::fromUtf16(u"\x0159")},
-    {QStringLiteral("&rcedil;"), QString::fromUtf16(u"\x0157")},
-    {QStringLiteral("&rceil;"), QString::fromUtf16(u"\x2309")},
-    {QStringLiteral("&rcub;"), QString::fromUtf16(u"\x007D")},
-    {QStringLiteral("&rcy;"), QString::fromUtf16(u"\x0440")},
-    {QStringLiteral("&rdca;"), QString::fromUtf16(u"\x2937")},
-    {QStringLiteral("&rdldhar;"), QString::fromUtf16(u"\x2969")},
-    {QStringLiteral("&rdquo;"), QString::fromUtf16(u"\x201D")},
-    {QStringLiteral("&rdquor;"), QString::fromUtf16(u"\x201D")},
-    {QStringLiteral("&rdsh;"), QString::fromUtf16(u"\x21B3")},
-    {QStringLiteral("&real;"), QString::fromUtf16(u"\x211C")},
-    {QStringLiteral("&realine;"), QString::fromUtf16(u"\x211B")},
-    {QStringLiteral("&realpart;"), QString::fromUtf16(u"\x211C")},
-    {QStringLiteral("&reals;"), QString::fromUtf16(u"\x211D")},
-    {QStringLiteral("&rect;"), QString::fromUtf16(u"\x25AD")},
-    {QStringLiteral("&reg"), QString::fromUtf16(u"\x00AE")},
-    {QStringLiteral("&reg;"), QString::fromUtf16(u"\x00AE")},
-    {QStringLiteral("&rfisht;"), QString::fromUtf16(u"\x297D")},
-    {QStringLiteral("&rfloor;"), QString::fromUtf16(u"\x230B")},
-    {QStringLiteral("&rfr;"), QString::fromUtf16(u"\xD835\xDD2F")},
-    {QStringLiteral("&rhard;"), QString::fromUtf16(u"\x21C1")},
-    {QStringLiteral("&rharu;"), QString::fromUtf16(u"\x21C0")},
-    {QStringLiteral("&rharul;"), QString::fromUtf16(u"\x296C")},
-    {QStringLiteral("&rho;"), QString::fromUtf16(u"\x03C1")},
-    {QStringLiteral("&rhov;"), QString::fromUtf16(u"\x03F1")},
-    {QStringLiteral("&rightarrow;"), QString::fromUtf16(u"\x2192")},
-    {QStringLiteral("&rightarrowtail;"), QString::fromUtf16(u"\x21A3")},
-    {QStringLiteral("&rightharpoondown;"), QString::fromUtf16(u"\x21C1")},
-    {QStringLiteral("&rightharpoonup;"), QString::fromUtf16(u"\x21C0")},
-    {QStringLiteral("&rightleftarrows;"), QString::fromUtf16(u"\x21C4")},
-    {QStringLiteral("&rightleftharpoons;"), QString::fromUtf16(u"\x21CC")},
-    {QStringLiteral("&rightrightarrows;"), QString::fromUtf16(u"\x21C9")},
-    {QStringLiteral("&rightsquigarrow;"), QString::fromUtf16(u"\x219D")},
-    {QStringLiteral("&rightthreetimes;"), QString::fromUtf16(u"\x22CC")},
-    {QStringLiteral("&ring;"), QString::fromUtf16(u"\x02DA")},
-    {QStringLiteral("&risingdotseq;"), QString::fromUtf16(u"\x2253")},
-    {QStringLiteral("&rlarr;"), QString::fromUtf16(u"\x21C4")},
-    {QStringLiteral("&rlhar;"), QString::fromUtf16(u"\x21CC")},
-    {QStringLiteral("&rlm;"), QString::fromUtf16(u"\x200F")},
-    {QStringLiteral("&rmoust;"), QString::fromUtf16(u"\x23B1")},
-    {QStringLiteral("&rmoustache;"), QString::fromUtf16(u"\x23B1")},
-    {QStringLiteral("&rnmid;"), QString::fromUtf16(u"\x2AEE")},
-    {QStringLiteral("&roang;"), QString::fromUtf16(u"\x27ED")},
-    {QStringLiteral("&roarr;"), QString::fromUtf16(u"\x21FE")},
-    {QStringLiteral("&robrk;"), QString::fromUtf16(u"\x27E7")},
-    {QStringLiteral("&ropar;"), QString::fromUtf16(u"\x2986")},
-    {QStringLiteral("&ropf;"), QString::fromUtf16(u"\xD835\xDD63")},
-    {QStringLiteral("&roplus;"), QString::fromUtf16(u"\x2A2E")},
-    {QStringLiteral("&rotimes;"), QString::fromUtf16(u"\x2A35")},
-    {QStringLiteral("&rpar;"), QString::fromUtf16(u"\x0029")},
-    {QStringLiteral("&rpargt;"), QString::fromUtf16(u"\x2994")},
-    {QStringLiteral("&rppolint;"), QString::fromUtf16(u"\x2A12")},
-    {QStringLiteral("&rrarr;"), QString::fromUtf16(u"\x21C9")},
-    {QStringLiteral("&rsaquo;"), QString::fromUtf16(u"\x203A")},
-    {QStringLiteral("&rscr;"), QString::fromUtf16(u"\xD835\xDCC7")},
-    {QStringLiteral("&rsh;"), QString::fromUtf16(u"\x21B1")},
-    {QStringLiteral("&rsqb;"), QString::fromUtf16(u"\x005D")},
-    {QStringLiteral("&rsquo;"), QString::fromUtf16(u"\x2019")},
-    {QStringLiteral("&rsquor;"), QString::fromUtf16(u"\x2019")},
-    {QStringLiteral("&rthree;"), QString::fromUtf16(u"\x22CC")},
-    {QStringLiteral("&rtimes;"), QString::fromUtf16(u"\x22CA")},
-    {QStringLiteral("&rtri;"), QString::fromUtf16(u"\x25B9")},
-    {QStringLiteral("&rtrie;"), QString::fromUtf16(u"\x22B5")},
-    {QStringLiteral("&rtrif;"), QString::fromUtf16(u"\x25B8")},
-    {QStringLiteral("&rtriltri;"), QString::fromUtf16(u"\x29CE")},
-    {QStringLiteral("&ruluhar;"), QString::fromUtf16(u"\x2968")},
-    {QStringLiteral("&rx;"), QString::fromUtf16(u"\x211E")},
-    {QStringLiteral("&sacute;"), QString::fromUtf16(u"\x015B")},
-    {QStringLiteral("&sbquo;"), QString::fromUtf16(u"\x201A")},
-    {QStringLiteral("&sc;"), QString::fromUtf16(u"\x227B")},
-    {QStringLiteral("&scE;"), QString::fromUtf16(u"\x2AB4")},
-    {QStringLiteral("&scap;"), QString::fromUtf16(u"\x2AB8")},
-    {QStringLiteral("&scaron;"), QString::fromUtf16(u"\x0161")},
-    {QStringLiteral("&sccue;"), QString::fromUtf16(u"\x227D")},
-    {QStringLiteral("&sce;"), QString::fromUtf16(u"\x2AB0")},
-    {QStringLiteral("&scedil;"), QString::fromUtf16(u"\x015F")},
-    {QStringLiteral("&scirc;"), QString::fromUtf16(u"\x015D")},
-    {QStringLiteral("&scnE;"), QString::fromUtf16(u"\x2AB6")},
-    {QStringLiteral("&scnap;"), QString::fromUtf16(u"\x2ABA")},
-    {QStringLiteral("&scnsim;"), QString::fromUtf16(u"\x22E9")},
-    {QStringLiteral("&scpolint;"), QString::fromUtf16(u"\x2A13")},
-    {QStringLiteral("&scsim;"), QString::fromUtf16(u"\x227F")},
-    {QStringLiteral("&scy;"), QString::fromUtf16(u"\x0441")},
-    {QStringLiteral("&sdot;"), QString::fromUtf16(u"\x22C5")},
-    {QStringLiteral("&sdotb;"), QString::fromUtf16(u"\x22A1")},
-    {QStringLiteral("&sdote;"), QString::fromUtf16(u"\x2A66")},
-    {QStringLiteral("&seArr;"), QString::fromUtf16(u"\x21D8")},
-    {QStringLiteral("&searhk;"), QString::fromUtf16(u"\x2925")},
-    {QStringLiteral("&searr;"), QString::fromUtf16(u"\x2198")},
-    {QStringLiteral("&searrow;"), QString::fromUtf16(u"\x2198")},
-    {QStringLiteral("&sect"), QString::fromUtf16(u"\x00A7")},
-    {QStringLiteral("&sect;"), QString::fromUtf16(u"\x00A7")},
-    {QStringLiteral("&semi;"), QString::fromUtf16(u"\x003B")},
-    {QStringLiteral("&seswar;"), QString::fromUtf16(u"\x2929")},
-    {QStringLiteral("&setminus;"), QString::fromUtf16(u"\x2216")},
-    {QStringLiteral("&setmn;"), QString::fromUtf16(u"\x2216")},
-    {QStringLiteral("&sext;"), QString::fromUtf16(u"\x2736")},
-    {QStringLiteral("&sfr;"), QString::fromUtf16(u"\xD835\xDD30")},
-    {QStringLiteral("&sfrown;"), QString::fromUtf16(u"\x2322")},
-    {QStringLiteral("&sharp;"), QString::fromUtf16(u"\x266F")},
-    {QStringLiteral("&shchcy;"), QString::fromUtf16(u"\x0449")},
-    {QStringLiteral("&shcy;"), QString::fromUtf16(u"\x0448")},
-    {QStringLiteral("&shortmid;"), QString::fromUtf16(u"\x2223")},
-    {QStringLiteral("&shortparallel;"), QString::fromUtf16(u"\x2225")},
-    {QStringLiteral("&shy"), QString::fromUtf16(u"\x00AD")},
-    {QStringLiteral("&shy;"), QString::fromUtf16(u"\x00AD")},
-    {QStringLiteral("&sigma;"), QString::fromUtf16(u"\x03C3")},
-    {QStringLiteral("&sigmaf;"), QString::fromUtf16(u"\x03C2")},
-    {QStringLiteral("&sigmav;"), QString::fromUtf16(u"\x03C2")},
-    {QStringLiteral("&sim;"), QString::fromUtf16(u"\x223C")},
-    {QStringLiteral("&simdot;"), QString::fromUtf16(u"\x2A6A")},
-    {QStringLiteral("&sime;"), QString::fromUtf16(u"\x2243")},
-    {QStringLiteral("&simeq;"), QString::fromUtf16(u"\x2243")},
-    {QStringLiteral("&simg;"), QString::fromUtf16(u"\x2A9E")},
-    {QStringLiteral("&simgE;"), QString::fromUtf16(u"\x2AA0")},
-    {QStringLiteral("&siml;"), QString::fromUtf16(u"\x2A9D")},
-    {QStringLiteral("&simlE;"), QString::fromUtf16(u"\x2A9F")},
-    {QStringLiteral("&simne;"), QString::fromUtf16(u"\x2246")},
-    {QStringLiteral("&simplus;"), QString::fromUtf16(u"\x2A24")},
-    {QStringLiteral("&simrarr;"), QString::fromUtf16(u"\x2972")},
-    {QStringLiteral("&slarr;"), QString::fromUtf16(u"\x2190")},
-    {QStringLiteral("&smallsetminus;"), QString::fromUtf16(u"\x2216")},
-    {QStringLiteral("&smashp;"), QString::fromUtf16(u"\x2A33")},
-    {QStringLiteral("&smeparsl;"), QString::fromUtf16(u"\x29E4")},
-    {QStringLiteral("&smid;"), QString::fromUtf16(u"\x2223")},
-    {QStringLiteral("&smile;"), QString::fromUtf16(u"\x2323")},
-    {QStringLiteral("&smt;"), QString::fromUtf16(u"\x2AAA")},
-    {QStringLiteral("&smte;"), QString::fromUtf16(u"\x2AAC")},
-    {QStringLiteral("&smtes;"), QString::fromUtf16(u"\x2AAC\xFE00")},
-    {QStringLiteral("&softcy;"), QString::fromUtf16(u"\x044C")},
-    {QStringLiteral("&sol;"), QString::fromUtf16(u"\x002F")},
-    {QStringLiteral("&solb;"), QString::fromUtf16(u"\x29C4")},
-    {QStringLiteral("&solbar;"), QString::fromUtf16(u"\x233F")},
-    {QStringLiteral("&sopf;"), QString::fromUtf16(u"\xD835\xDD64")},
-    {QStringLiteral("&spades;"), QString::fromUtf16(u"\x2660")},
-    {QStringLiteral("&spadesuit;"), QString::fromUtf16(u"\x2660")},
-    {QStringLiteral("&spar;"), QString::fromUtf16(u"\x2225")},
-    {QStringLiteral("&sqcap;"), QString::fromUtf16(u"\x2293")},
-    {QStringLiteral("&sqcaps;"), QString::fromUtf16(u"\x2293\xFE00")},
-    {QStringLiteral("&sqcup;"), QString::fromUtf16(u"\x2294")},
-    {QStringLiteral("&sqcups;"), QString::fromUtf16(u"\x2294\xFE00")},
-    {QStringLiteral("&sqsub;"), QString::fromUtf16(u"\x228F")},
-    {QStringLiteral("&sqsube;"), QString::fromUtf16(u"\x2291")},
-    {QStringLiteral("&sqsubset;"), QString::fromUtf16(u"\x228F")},
-    {QStringLiteral("&sqsubseteq;"), QString::fromUtf16(u"\x2291")},
-    {QStringLiteral("&sqsup;"), QString::fromUtf16(u"\x2290")},
-    {QStringLiteral("&sqsupe;"), QString::fromUtf16(u"\x2292")},
-    {QStringLiteral("&sqsupset;"), QString::fromUtf16(u"\x2290")},
-    {QStringLiteral("&sqsupseteq;"), QString::fromUtf16(u"\x2292")},
-    {QStringLiteral("&squ;"), QString::fromUtf16(u"\x25A1")},
-    {QStringLiteral("&square;"), QString::fromUtf16(u"\x25A1")},
-    {QStringLiteral("&squarf;"), QString::fromUtf16(u"\x25AA")},
-    {QStringLiteral("&squf;"), QString::fromUtf16(u"\x25AA")},
-    {QStringLiteral("&srarr;"), QString::fromUtf16(u"\x2192")},
-    {QStringLiteral("&sscr;"), QString::fromUtf16(u"\xD835\xDCC8")},
-    {QStringLiteral("&ssetmn;"), QString::fromUtf16(u"\x2216")},
-    {QStringLiteral("&ssmile;"), QString::fromUtf16(u"\x2323")},
-    {QStringLiteral("&sstarf;"), QString::fromUtf16(u"\x22C6")},
-    {QStringLiteral("&star;"), QString::fromUtf16(u"\x2606")},
-    {QStringLiteral("&starf;"), QString::fromUtf16(u"\x2605")},
-    {QStringLiteral("&straightepsilon;"), QString::fromUtf16(u"\x03F5")},
-    {QStringLiteral("&straightphi;"), QString::fromUtf16(u"\x03D5")},
-    {QStringLiteral("&strns;"), QString::fromUtf16(u"\x00AF")},
-    {QStringLiteral("&sub;"), QString::fromUtf16(u"\x2282")},
-    {QStringLiteral("&subE;"), QString::fromUtf16(u"\x2AC5")},
-    {QStringLiteral("&subdot;"), QString::fromUtf16(u"\x2ABD")},
-    {QStringLiteral("&sube;"), QString::fromUtf16(u"\x2286")},
-    {QStringLiteral("&subedot;"), QString::fromUtf16(u"\x2AC3")},
-    {QStringLiteral("&submult;"), QString::fromUtf16(u"\x2AC1")},
-    {QStringLiteral("&subnE;"), QString::fromUtf16(u"\x2ACB")},
-    {QStringLiteral("&subne;"), QString::fromUtf16(u"\x228A")},
-    {QStringLiteral("&subplus;"), QString::fromUtf16(u"\x2ABF")},
-    {QStringLiteral("&subrarr;"), QString::fromUtf16(u"\x2979")},
-    {QStringLiteral("&subset;"), QString::fromUtf16(u"\x2282")},
-    {QStringLiteral("&subseteq;"), QString::fromUtf16(u"\x2286")},
-    {QStringLiteral("&subseteqq;"), QString::fromUtf16(u"\x2AC5")},
-    {QStringLiteral("&subsetneq;"), QString::fromUtf16(u"\x228A")},
-    {QStringLiteral("&subsetneqq;"), QString::fromUtf16(u"\x2ACB")},
-    {QStringLiteral("&subsim;"), QString::fromUtf16(u"\x2AC7")},
-    {QStringLiteral("&subsub;"), QString::fromUtf16(u"\x2AD5")},
-    {QStringLiteral("&subsup;"), QString::fromUtf16(u"\x2AD3")},
-    {QStringLiteral("&succ;"), QString::fromUtf16(u"\x227B")},
-    {QStringLiteral("&succapprox;"), QString::fromUtf16(u"\x2AB8")},
-    {QStringLiteral("&succcurlyeq;"), QString::fromUtf16(u"\x227D")},
-    {QStringLiteral("&succeq;"), QString::fromUtf16(u"\x2AB0")},
-    {QStringLiteral("&succnapprox;"), QString::fromUtf16(u"\x2ABA")},
-    {QStringLiteral("&succneqq;"), QString::fromUtf16(u"\x2AB6")},
-    {QStringLiteral("&succnsim;"), QString::fromUtf16(u"\x22E9")},
-    {QStringLiteral("&succsim;"), QString::fromUtf16(u"\x227F")},
-    {QStringLiteral("&sum;"), QString::fromUtf16(u"\x2211")},
-    {QStringLiteral("&sung;"), QString::fromUtf16(u"\x266A")},
-    {QStringLiteral("&sup1"), QString::fromUtf16(u"\x00B9")},
-    {QStringLiteral("&sup1;"), QString::fromUtf16(u"\x00B9")},
-    {QStringLiteral("&sup2"), QString::fromUtf16(u"\x00B2")},
-    {QStringLiteral("&sup2;"), QString::fromUtf16(u"\x00B2")},
-    {QStringLiteral("&sup3"), QString::fromUtf16(u"\x00B3")},
-    {QStringLiteral("&sup3;"), QString::fromUtf16(u"\x00B3")},
-    {QStringLiteral("&sup;"), QString::fromUtf16(u"\x2283")},
-    {QStringLiteral("&supE;"), QString::fromUtf16(u"\x2AC6")},
-    {QStringLiteral("&supdot;"), QString::fromUtf16(u"\x2ABE")},
-    {QStringLiteral("&supdsub;"), QString::fromUtf16(u"\x2AD8")},
-    {QStringLiteral("&supe;"), QString::fromUtf16(u"\x2287")},
-    {QStringLiteral("&supedot;"), QString::fromUtf16(u"\x2AC4")},
-    {QStringLiteral("&suphsol;"), QString::fromUtf16(u"\x27C9")},
-    {QStringLiteral("&suphsub;"), QString::fromUtf16(u"\x2AD7")},
-    {QStringLiteral("&suplarr;"), QString::fromUtf16(u"\x297B")},
-    {QStringLiteral("&supmult;"), QString::fromUtf16(u"\x2AC2")},
-    {QStringLiteral("&supnE;"), QString::fromUtf16(u"\x2ACC")},
-    {QStringLiteral("&supne;"), QString::fromUtf16(u"\x228B")},
-    {QStringLiteral("&supplus;"), QString::fromUtf16(u"\x2AC0")},
-    {QStringLiteral("&supset;"), QString::fromUtf16(u"\x2283")},
-    {QStringLiteral("&supseteq;"), QString::fromUtf16(u"\x2287")},
-    {QStringLiteral("&supseteqq;"), QString::fromUtf16(u"\x2AC6")},
-    {QStringLiteral("&supsetneq;"), QString::fromUtf16(u"\x228B")},
-    {QStringLiteral("&supsetneqq;"), QString::fromUtf16(u"\x2ACC")},
-    {QStringLiteral("&supsim;"), QString::fromUtf16(u"\x2AC8")},
-    {QStringLiteral("&supsub;"), QString::fromUtf16(u"\x2AD4")},
-    {QStringLiteral("&supsup;"), QString::fromUtf16(u"\x2AD6")},
-    {QStringLiteral("&swArr;"), QString::fromUtf16(u"\x21D9")},
-    {QStringLiteral("&swarhk;"), QString::fromUtf16(u"\x2926")},
-    {QStringLiteral("&swarr;"), QString::fromUtf16(u"\x2199")},
-    {QStringLiteral("&swarrow;"), QString::fromUtf16(u"\x2199")},
-    {QStringLiteral("&swnwar;"), QString::fromUtf16(u"\x292A")},
-    {QStringLiteral("&szlig"), QString::fromUtf16(u"\x00DF")},
-    {QStringLiteral("&szlig;"), QString::fromUtf16(u"\x00DF")},
-    {QStringLiteral("&target;"), QString::fromUtf16(u"\x2316")},
-    {QStringLiteral("&tau;"), QString::fromUtf16(u"\x03C4")},
-    {QStringLiteral("&tbrk;"), QString::fromUtf16(u"\x23B4")},
-    {QStringLiteral("&tcaron;"), QString::fromUtf16(u"\x0165")},
-    {QStringLiteral("&tcedil;"), QString::fromUtf16(u"\x0163")},
-    {QStringLiteral("&tcy;"), QString::fromUtf16(u"\x0442")},
-    {QStringLiteral("&tdot;"), QString::fromUtf16(u"\x20DB")},
-    {QStringLiteral("&telrec;"), QString::fromUtf16(u"\x2315")},
-    {QStringLiteral("&tfr;"), QString::fromUtf16(u"\xD835\xDD31")},
-    {QStringLiteral("&there4;"), QString::fromUtf16(u"\x2234")},
-    {QStringLiteral("&therefore;"), QString::fromUtf16(u"\x2234")},
-    {QStringLiteral("&theta;"), QString::fromUtf16(u"\x03B8")},
-    {QStringLiteral("&thetasym;"), QString::fromUtf16(u"\x03D1")},
-    {QStringLiteral("&thetav;"), QString::fromUtf16(u"\x03D1")},
-    {QStringLiteral("&thickapprox;"), QString::fromUtf16(u"\x2248")},
-    {QStringLiteral("&thicksim;"), QString::fromUtf16(u"\x223C")},
-    {QStringLiteral("&thinsp;"), QString::fromUtf16(u"\x2009")},
-    {QStringLiteral("&thkap;"), QString::fromUtf16(u"\x2248")},
-    {QStringLiteral("&thksim;"), QString::fromUtf16(u"\x223C")},
-    {QStringLiteral("&thorn"), QString::fromUtf16(u"\x00FE")},
-    {QStringLiteral("&thorn;"), QString::fromUtf16(u"\x00FE")},
-    {QStringLiteral("&tilde;"), QString::fromUtf16(u"\x02DC")},
-    {QStringLiteral("&times"), QString::fromUtf16(u"\x00D7")},
-    {QStringLiteral("&times;"), QString::fromUtf16(u"\x00D7")},
-    {QStringLiteral("&timesb;"), QString::fromUtf16(u"\x22A0")},
-    {QStringLiteral("&timesbar;"), QString::fromUtf16(u"\x2A31")},
-    {QStringLiteral("&timesd;"), QString::fromUtf16(u"\x2A30")},
-    {QStringLiteral("&tint;"), QString::fromUtf16(u"\x222D")},
-    {QStringLiteral("&toea;"), QString::fromUtf16(u"\x2928")},
-    {QStringLiteral("&top;"), QString::fromUtf16(u"\x22A4")},
-    {QStringLiteral("&topbot;"), QString::fromUtf16(u"\x2336")},
-    {QStringLiteral("&topcir;"), QString::fromUtf16(u"\x2AF1")},
-    {QStringLiteral("&topf;"), QString::fromUtf16(u"\xD835\xDD65")},
-    {QStringLiteral("&topfork;"), QString::fromUtf16(u"\x2ADA")},
-    {QStringLiteral("&tosa;"), QString::fromUtf16(u"\x2929")},
-    {QStringLiteral("&tprime;"), QString::fromUtf16(u"\x2034")},
-    {QStringLiteral("&trade;"), QString::fromUtf16(u"\x2122")},
-    {QStringLiteral("&triangle;"), QString::fromUtf16(u"\x25B5")},
-    {QStringLiteral("&triangledown;"), QString::fromUtf16(u"\x25BF")},
-    {QStringLiteral("&triangleleft;"), QString::fromUtf16(u"\x25C3")},
-    {QStringLiteral("&trianglelefteq;"), QString::fromUtf16(u"\x22B4")},
-    {QStringLiteral("&triangleq;"), QString::fromUtf16(u"\x225C")},
-    {QStringLiteral("&triangleright;"), QString::fromUtf16(u"\x25B9")},
-    {QStringLiteral("&trianglerighteq;"), QString::fromUtf16(u"\x22B5")},
-    {QStringLiteral("&tridot;"), QString::fromUtf16(u"\x25EC")},
-    {QStringLiteral("&trie;"), QString::fromUtf16(u"\x225C")},
-    {QStringLiteral("&triminus;"), QString::fromUtf16(u"\x2A3A")},
-    {QStringLiteral("&triplus;"), QString::fromUtf16(u"\x2A39")},
-    {QStringLiteral("&trisb;"), QString::fromUtf16(u"\x29CD")},
-    {QStringLiteral("&tritime;"), QString::fromUtf16(u"\x2A3B")},
-    {QStringLiteral("&trpezium;"), QString::fromUtf16(u"\x23E2")},
-    {QStringLiteral("&tscr;"), QString::fromUtf16(u"\xD835\xDCC9")},
-    {QStringLiteral("&tscy;"), QString::fromUtf16(u"\x0446")},
-    {QStringLiteral("&tshcy;"), QString::fromUtf16(u"\x045B")},
-    {QStringLiteral("&tstrok;"), QString::fromUtf16(u"\x0167")},
-    {QStringLiteral("&twixt;"), QString::fromUtf16(u"\x226C")},
-    {QStringLiteral("&twoheadleftarrow;"), QString::fromUtf16(u"\x219E")},
-    {QStringLiteral("&twoheadrightarrow;"), QString::fromUtf16(u"\x21A0")},
-    {QStringLiteral("&uArr;"), QString::fromUtf16(u"\x21D1")},
-    {QStringLiteral("&uHar;"), QString::fromUtf16(u"\x2963")},
-    {QStringLiteral("&uacute"), QString::fromUtf16(u"\x00FA")},
-    {QStringLiteral("&uacute;"), QString::fromUtf16(u"\x00FA")},
-    {QStringLiteral("&uarr;"), QString::fromUtf16(u"\x2191")},
-    {QStringLiteral("&ubrcy;"), QString::fromUtf16(u"\x045E")},
-    {QStringLiteral("&ubreve;"), QString::fromUtf16(u"\x016D")},
-    {QStringLiteral("&ucirc"), QString::fromUtf16(u"\x00FB")},
-    {QStringLiteral("&ucirc;"), QString::fromUtf16(u"\x00FB")},
-    {QStringLiteral("&ucy;"), QString::fromUtf16(u"\x0443")},
-    {QStringLiteral("&udarr;"), QString::fromUtf16(u"\x21C5")},
-    {QStringLiteral("&udblac;"), QString::fromUtf16(u"\x0171")},
-    {QStringLiteral("&udhar;"), QString::fromUtf16(u"\x296E")},
-    {QStringLiteral("&ufisht;"), QString::fromUtf16(u"\x297E")},
-    {QStringLiteral("&ufr;"), QString::fromUtf16(u"\xD835\xDD32")},
-    {QStringLiteral("&ugrave"), QString::fromUtf16(u"\x00F9")},
-    {QStringLiteral("&ugrave;"), QString::fromUtf16(u"\x00F9")},
-    {QStringLiteral("&uharl;"), QString::fromUtf16(u"\x21BF")},
-    {QStringLiteral("&uharr;"), QString::fromUtf16(u"\x21BE")},
-    {QStringLiteral("&uhblk;"), QString::fromUtf16(u"\x2580")},
-    {QStringLiteral("&ulcorn;"), QString::fromUtf16(u"\x231C")},
-    {QStringLiteral("&ulcorner;"), QString::fromUtf16(u"\x231C")},
-    {QStringLiteral("&ulcrop;"), QString::fromUtf16(u"\x230F")},
-    {QStringLiteral("&ultri;"), QString::fromUtf16(u"\x25F8")},
-    {QStringLiteral("&umacr;"), QString::fromUtf16(u"\x016B")},
-    {QStringLiteral("&uml"), QString::fromUtf16(u"\x00A8")},
-    {QStringLiteral("&uml;"), QString::fromUtf16(u"\x00A8")},
-    {QStringLiteral("&uogon;"), QString::fromUtf16(u"\x0173")},
-    {QStringLiteral("&uopf;"), QString::fromUtf16(u"\xD835\xDD66")},
-    {QStringLiteral("&uparrow;"), QString::fromUtf16(u"\x2191")},
-    {QStringLiteral("&updownarrow;"), QString::fromUtf16(u"\x2195")},
-    {QStringLiteral("&upharpoonleft;"), QString::fromUtf16(u"\x21BF")},
-    {QStringLiteral("&upharpoonright;"), QString::fromUtf16(u"\x21BE")},
-    {QStringLiteral("&uplus;"), QString::fromUtf16(u"\x228E")},
-    {QStringLiteral("&upsi;"), QString::fromUtf16(u"\x03C5")},
-    {QStringLiteral("&upsih;"), QString::fromUtf16(u"\x03D2")},
-    {QStringLiteral("&upsilon;"), QString::fromUtf16(u"\x03C5")},
-    {QStringLiteral("&upuparrows;"), QString::fromUtf16(u"\x21C8")},
-    {QStringLiteral("&urcorn;"), QString::fromUtf16(u"\x231D")},
-    {QStringLiteral("&urcorner;"), QString::fromUtf16(u"\x231D")},
-    {QStringLiteral("&urcrop;"), QString::fromUtf16(u"\x230E")},
-    {QStringLiteral("&uring;"), QString::fromUtf16(u"\x016F")},
-    {QStringLiteral("&urtri;"), QString::fromUtf16(u"\x25F9")},
-    {QStringLiteral("&uscr;"), QString::fromUtf16(u"\xD835\xDCCA")},
-    {QStringLiteral("&utdot;"), QString::fromUtf16(u"\x22F0")},
-    {QStringLiteral("&utilde;"), QString::fromUtf16(u"\x0169")},
-    {QStringLiteral("&utri;"), QString::fromUtf16(u"\x25B5")},
-    {QStringLiteral("&utrif;"), QString::fromUtf16(u"\x25B4")},
-    {QStringLiteral("&uuarr;"), QString::fromUtf16(u"\x21C8")},
-    {QStringLiteral("&uuml"), QString::fromUtf16(u"\x00FC")},
-    {QStringLiteral("&uuml;"), QString::fromUtf16(u"\x00FC")},
-    {QStringLiteral("&uwangle;"), QString::fromUtf16(u"\x29A7")},
-    {QStringLiteral("&vArr;"), QString::fromUtf16(u"\x21D5")},
-    {QStringLiteral("&vBar;"), QString::fromUtf16(u"\x2AE8")},
-    {QStringLiteral("&vBarv;"), QString::fromUtf16(u"\x2AE9")},
-    {QStringLiteral("&vDash;"), QString::fromUtf16(u"\x22A8")},
-    {QStringLiteral("&vangrt;"), QString::fromUtf16(u"\x299C")},
-    {QStringLiteral("&varepsilon;"), QString::fromUtf16(u"\x03F5")},
-    {QStringLiteral("&varkappa;"), QString::fromUtf16(u"\x03F0")},
-    {QStringLiteral("&varnothing;"), QString::fromUtf16(u"\x2205")},
-    {QStringLiteral("&varphi;"), QString::fromUtf16(u"\x03D5")},
-    {QStringLiteral("&varpi;"), QString::fromUtf16(u"\x03D6")},
-    {QStringLiteral("&varpropto;"), QString::fromUtf16(u"\x221D")},
-    {QStringLiteral("&varr;"), QString::fromUtf16(u"\x2195")},
-    {QStringLiteral("&varrho;"), QString::fromUtf16(u"\x03F1")},
-    {QStringLiteral("&varsigma;"), QString::fromUtf16(u"\x03C2")},
-    {QStringLiteral("&varsubsetneq;"), QString::fromUtf16(u"\x228A\xFE00")},
-    {QStringLiteral("&varsubsetneqq;"), QString::fromUtf16(u"\x2ACB\xFE00")},
-    {QStringLiteral("&varsupsetneq;"), QString::fromUtf16(u"\x228B\xFE00")},
-    {QStringLiteral("&varsupsetneqq;"), QString::fromUtf16(u"\x2ACC\xFE00")},
-    {QStringLiteral("&vartheta;"), QString::fromUtf16(u"\x03D1")},
-    {QStringLiteral("&vartriangleleft;"), QString::fromUtf16(u"\x22B2")},
-    {QStringLiteral("&vartriangleright;"), QString::fromUtf16(u"\x22B3")},
-    {QStringLiteral("&vcy;"), QString::fromUtf16(u"\x0432")},
-    {QStringLiteral("&vdash;"), QString::fromUtf16(u"\x22A2")},
-    {QStringLiteral("&vee;"), QString::fromUtf16(u"\x2228")},
-    {QStringLiteral("&veebar;"), QString::fromUtf16(u"\x22BB")},
-    {QStringLiteral("&veeeq;"), QString::fromUtf16(u"\x225A")},
-    {QStringLiteral("&vellip;"), QString::fromUtf16(u"\x22EE")},
-    {QStringLiteral("&verbar;"), QString::fromUtf16(u"\x007C")},
-    {QStringLiteral("&vert;"), QString::fromUtf16(u"\x007C")},
-    {QStringLiteral("&vfr;"), QString::fromUtf16(u"\xD835\xDD33")},
-    {QStringLiteral("&vltri;"), QString::fromUtf16(u"\x22B2")},
-    {QStringLiteral("&vnsub;"), QString::fromUtf16(u"\x2282\x20D2")},
-    {QStringLiteral("&vnsup;"), QString::fromUtf16(u"\x2283\x20D2")},
-    {QStringLiteral("&vopf;"), QString::fromUtf16(u"\xD835\xDD67")},
-    {QStringLiteral("&vprop;"), QString::fromUtf16(u"\x221D")},
-    {QStringLiteral("&vrtri;"), QString::fromUtf16(u"\x22B3")},
-    {QStringLiteral("&vscr;"), QString::fromUtf16(u"\xD835\xDCCB")},
-    {QStringLiteral("&vsubnE;"), QString::fromUtf16(u"\x2ACB\xFE00")},
-    {QStringLiteral("&vsubne;"), QString::fromUtf16(u"\x228A\xFE00")},
-    {QStringLiteral("&vsupnE;"), QString::fromUtf16(u"\x2ACC\xFE00")},
-    {QStringLiteral("&vsupne;"), QString::fromUtf16(u"\x228B\xFE00")},
-    {QStringLiteral("&vzigzag;"), QString::fromUtf16(u"\x299A")},
-    {QStringLiteral("&wcirc;"), QString::fromUtf16(u"\x0175")},
-    {QStringLiteral("&wedbar;"), QString::fromUtf16(u"\x2A5F")},
-    {QStringLiteral("&wedge;"), QString::fromUtf16(u"\x2227")},
-    {QStringLiteral("&wedgeq;"), QString::fromUtf16(u"\x2259")},
-    {QStringLiteral("&weierp;"), QString::fromUtf16(u"\x2118")},
-    {QStringLiteral("&wfr;"), QString::fromUtf16(u"\xD835\xDD34")},
-    {QStringLiteral("&wopf;"), QString::fromUtf16(u"\xD835\xDD68")},
-    {QStringLiteral("&wp;"), QString::fromUtf16(u"\x2118")},
-    {QStringLiteral("&wr;"), QString::fromUtf16(u"\x2240")},
-    {QStringLiteral("&wreath;"), QString::fromUtf16(u"\x2240")},
-    {QStringLiteral("&wscr;"), QString::fromUtf16(u"\xD835\xDCCC")},
-    {QStringLiteral("&xcap;"), QString::fromUtf16(u"\x22C2")},
-    {QStringLiteral("&xcirc;"), QString::fromUtf16(u"\x25EF")},
-    {QStringLiteral("&xcup;"), QString::fromUtf16(u"\x22C3")},
-    {QStringLiteral("&xdtri;"), QString::fromUtf16(u"\x25BD")},
-    {QStringLiteral("&xfr;"), QString::fromUtf16(u"\xD835\xDD35")},
-    {QStringLiteral("&xhArr;"), QString::fromUtf16(u"\x27FA")},
-    {QStringLiteral("&xharr;"), QString::fromUtf16(u"\x27F7")},
-    {QStringLiteral("&xi;"), QString::fromUtf16(u"\x03BE")},
-    {QStringLiteral("&xlArr;"), QString::fromUtf16(u"\x27F8")},
-    {QStringLiteral("&xlarr;"), QString::fromUtf16(u"\x27F5")},
-    {QStringLiteral("&xmap;"), QString::fromUtf16(u"\x27FC")},
-    {QStringLiteral("&xnis;"), QString::fromUtf16(u"\x22FB")},
-    {QStringLiteral("&xodot;"), QString::fromUtf16(u"\x2A00")},
-    {QStringLiteral("&xopf;"), QString::fromUtf16(u"\xD835\xDD69")},
-    {QStringLiteral("&xoplus;"), QString::fromUtf16(u"\x2A01")},
-    {QStringLiteral("&xotime;"), QString::fromUtf16(u"\x2A02")},
-    {QStringLiteral("&xrArr;"), QString::fromUtf16(u"\x27F9")},
-    {QStringLiteral("&xrarr;"), QString::fromUtf16(u"\x27F6")},
-    {QStringLiteral("&xscr;"), QString::fromUtf16(u"\xD835\xDCCD")},
-    {QStringLiteral("&xsqcup;"), QString::fromUtf16(u"\x2A06")},
-    {QStringLiteral("&xuplus;"), QString::fromUtf16(u"\x2A04")},
-    {QStringLiteral("&xutri;"), QString::fromUtf16(u"\x25B3")},
-    {QStringLiteral("&xvee;"), QString::fromUtf16(u"\x22C1")},
-    {QStringLiteral("&xwedge;"), QString::fromUtf16(u"\x22C0")},
-    {QStringLiteral("&yacute"), QString::fromUtf16(u"\x00FD")},
-    {QStringLiteral("&yacute;"), QString::fromUtf16(u"\x00FD")},
-    {QStringLiteral("&yacy;"), QString::fromUtf16(u"\x044F")},
-    {QStringLiteral("&ycirc;"), QString::fromUtf16(u"\x0177")},
-    {QStringLiteral("&ycy;"), QString::fromUtf16(u"\x044B")},
-    {QStringLiteral("&yen"), QString::fromUtf16(u"\x00A5")},
-    {QStringLiteral("&yen;"), QString::fromUtf16(u"\x00A5")},
-    {QStringLiteral("&yfr;"), QString::fromUtf16(u"\xD835\xDD36")},
-    {QStringLiteral("&yicy;"), QString::fromUtf16(u"\x0457")},
-    {QStringLiteral("&yopf;"), QString::fromUtf16(u"\xD835\xDD6A")},
-    {QStringLiteral("&yscr;"), QString::fromUtf16(u"\xD835\xDCCE")},
-    {QStringLiteral("&yucy;"), QString::fromUtf16(u"\x044E")},
-    {QStringLiteral("&yuml"), QString::fromUtf16(u"\x00FF")},
-    {QStringLiteral("&yuml;"), QString::fromUtf16(u"\x00FF")},
-    {QStringLiteral("&zacute;"), QString::fromUtf16(u"\x017A")},
-    {QStringLiteral("&zcaron;"), QString::fromUtf16(u"\x017E")},
-    {QStringLiteral("&zcy;"), QString::fromUtf16(u"\x0437")},
-    {QStringLiteral("&zdot;"), QString::fromUtf16(u"\x017C")},
-    {QStringLiteral("&zeetrf;"), QString::fromUtf16(u"\x2128")},
-    {QStringLiteral("&zeta;"), QString::fromUtf16(u"\x03B6")},
-    {QStringLiteral("&zfr;"), QString::fromUtf16(u"\xD835\xDD37")},
-    {QStringLiteral("&zhcy;"), QString::fromUtf16(u"\x0436")},
-    {QStringLiteral("&zigrarr;"), QString::fromUtf16(u"\x21DD")},
-    {QStringLiteral("&zopf;"), QString::fromUtf16(u"\xD835\xDD6B")},
-    {QStringLiteral("&zscr;"), QString::fromUtf16(u"\xD835\xDCCF")},
-    {QStringLiteral("&zwj;"), QString::fromUtf16(u"\x200D")},
-    {QStringLiteral("&zwnj;"), QString::fromUtf16(u"\x200C")}};
+struct Entity {
+    const char16_t *m_name;
+    qsizetype m_nameLength;
+    const char16_t *m_value;
+    qsizetype m_valueLength;
+}; // struct Entity
+
+static constexpr qsizetype s_maxEntityLength = 31;
+
+static constexpr quint32 s_entityBucketsCount = 532;
+
+static constexpr quint32 s_entitySlotsCount = 4096;
+
+static constexpr Entity s_entities[] = {
+    {u"AElig", 5, u"\x00C6", 1},
+    {u"AMP", 3, u"\x0026", 1},
+    {u"Aacute", 6, u"\x00C1", 1},
+    {u"Abreve", 6, u"\x0102", 1},
+    {u"Acirc", 5, u"\x00C2", 1},
+    {u"Acy", 3, u"\x0410", 1},
+    {u"Afr", 3, u"\xD835\xDD04", 2},
+    {u"Agrave", 6, u"\x00C0", 1},
+    {u"Alpha", 5, u"\x0391", 1},
+    {u"Amacr", 5, u"\x0100", 1},
+    {u"And", 3, u"\x2A53", 1},
+    {u"Aogon", 5, u"\x0104", 1},
+    {u"Aopf", 4, u"\xD835\xDD38", 2},
+    {u"ApplyFunction", 13, u"\x2061", 1},
+    {u"Aring", 5, u"\x00C5", 1},
+    {u"Ascr", 4, u"\xD835\xDC9C", 2},
+    {u"Assign", 6, u"\x2254", 1},
+    {u"Atilde", 6, u"\x00C3", 1},
+    {u"Auml", 4, u"\x00C4", 1},
+    {u"Backslash", 9, u"\x2216", 1},
+    {u"Barv", 4, u"\x2AE7", 1},
+    {u"Barwed", 6, u"\x2306", 1},
+    {u"Bcy", 3, u"\x0411", 1},
+    {u"Because", 7, u"\x2235", 1},
+    {u"Bernoullis", 10, u"\x212C", 1},
+    {u"Beta", 4, u"\x0392", 1},
+    {u"Bfr", 3, u"\xD835\xDD05", 2},
+    {u"Bopf", 4, u"\xD835\xDD39", 2},
+    {u"Breve", 5, u"\x02D8", 1},
+    {u"Bscr", 4, u"\x212C", 1},
+    {u"Bumpeq", 6, u"\x224E", 1},
+    {u"CHcy", 4, u"\x0427", 1},
+    {u"COPY", 4, u"\x00A9", 1},
+    {u"Cacute", 6, u"\x0106", 1},
+    {u"Cap", 3, u"\x22D2", 1},
+    {u"CapitalDifferentialD", 20, u"\x2145", 1},
+    {u"Cayleys", 7, u"\x212D", 1},
+    {u"Ccaron", 6, u"\x010C", 1},
+    {u"Ccedil", 6, u"\x00C7", 1},
+    {u"Ccirc", 5, u"\x0108", 1},
+    {u"Cconint", 7, u"\x2230", 1},
+    {u"Cdot", 4, u"\x010A", 1},
+    {u"Cedilla", 7, u"\x00B8", 1},
+    {u"CenterDot", 9, u"\x00B7", 1},
+    {u"Cfr", 3, u"\x212D", 1},
+    {u"Chi", 3, u"\x03A7", 1},
+    {u"CircleDot", 9, u"\x2299", 1},
+    {u"CircleMinus", 11, u"\x2296", 1},
+    {u"CirclePlus", 10, u"\x2295", 1},
+    {u"CircleTimes", 11, u"\x2297", 1},
+    {u"ClockwiseContourIntegral", 24, u"\x2232", 1},
+    {u"CloseCurlyDoubleQuote", 21, u"\x201D", 1},
+    {u"CloseCurlyQuote", 15, u"\x2019", 1},
+    {u"Colon", 5, u"\x2237", 1},
+    {u"Colone", 6, u"\x2A74", 1},
+    {u"Congruent", 9, u"\x2261", 1},
+    {u"Conint", 6, u"\x222F", 1},
+    {u"ContourIntegral", 15, u"\x222E", 1},
+    {u"Copf", 4, u"\x2102", 1},
+    {u"Coproduct", 9, u"\x2210", 1},
+    {u"CounterClockwiseContourIntegral", 31, u"\x2233", 1},
+    {u"Cross", 5, u"\x2A2F", 1},
+    {u"Cscr", 4, u"\xD835\xDC9E", 2},
+    {u"Cup", 3, u"\x22D3", 1},
+    {u"CupCap", 6, u"\x224D", 1},
+    {u"DD", 2, u"\x2145", 1},
+    {u"DDotrahd", 8, u"\x2911", 1},
+    {u"DJcy", 4, u"\x0402", 1},
+    {u"DScy", 4, u"\x0405", 1},
+    {u"DZcy", 4, u"\x040F", 1},
+    {u"Dagger", 6, u"\x2021", 1},
+    {u"Darr", 4, u"\x21A1", 1},
+    {u"Dashv", 5, u"\x2AE4", 1},
+    {u"Dcaron", 6, u"\x010E", 1},
+    {u"Dcy", 3, u"\x0414", 1},
+    {u"Del", 3, u"\x2207", 1},
+    {u"Delta", 5, u"\x0394", 1},
+    {u"Dfr", 3, u"\xD835\xDD07", 2},
+    {u"DiacriticalAcute", 16, u"\x00B4", 1},
+    {u"DiacriticalDot", 14, u"\x02D9", 1},
+    {u"DiacriticalDoubleAcute", 22, u"\x02DD", 1},
+    {u"DiacriticalGrave", 16, u"\x0060", 1},
+    {u"DiacriticalTilde", 16, u"\x02DC", 1},
+    {u"Diamond", 7, u"\x22C4", 1},
+    {u"DifferentialD", 13, u"\x2146", 1},
+    {u"Dopf", 4, u"\xD835\xDD3B", 2},
+    {u"Dot", 3, u"\x00A8", 1},
+    {u"DotDot", 6, u"\x20DC", 1},
+    {u"DotEqual", 8, u"\x2250", 1},
+    {u"DoubleContourIntegral", 21, u"\x222F", 1},
+    {u"DoubleDot", 9, u"\x00A8", 1},
+    {u"DoubleDownArrow", 15, u"\x21D3", 1},
+    {u"DoubleLeftArrow", 15, u"\x21D0", 1},
+    {u"DoubleLeftRightArrow", 20, u"\x21D4", 1},
+    {u"DoubleLeftTee", 13, u"\x2AE4", 1},
+    {u"DoubleLongLeftArrow", 19, u"\x27F8", 1},
+    {u"DoubleLongLeftRightArrow", 24, u"\x27FA", 1},
+    {u"DoubleLongRightArrow", 20, u"\x27F9", 1},
+    {u"DoubleRightArrow", 16, u"\x21D2", 1},
+    {u"DoubleRightTee", 14, u"\x22A8", 1},
+    {u"DoubleUpArrow", 13, u"\x21D1", 1},
+    {u"DoubleUpDownArrow", 17, u"\x21D5", 1},
+    {u"DoubleVerticalBar", 17, u"\x2225", 1},
+    {u"DownArrow", 9, u"\x2193", 1},
+    {u"DownArrowBar", 12, u"\x2913", 1},
+    {u"DownArrowUpArrow", 16, u"\x21F5", 1},
+    {u"DownBreve", 9, u"\x0311", 1},
+    {u"DownLeftRightVector", 19, u"\x2950", 1},
+    {u"DownLeftTeeVector", 17, u"\x295E", 1},
+    {u"DownLeftVector", 14, u"\x21BD", 1},
+    {u"DownLeftVectorBar", 17, u"\x2956", 1},
+    {u"DownRightTeeVector", 18, u"\x295F", 1},
+    {u"DownRightVector", 15, u"\x21C1", 1},
+    {u"DownRightVectorBar", 18, u"\x2957", 1},
+    {u"DownTee", 7, u"\x22A4", 1},
+    {u"DownTeeArrow", 12, u"\x21A7", 1},
+    {u"Downarrow", 9, u"\x21D3", 1},
+    {u"Dscr", 4, u"\xD835\xDC9F", 2},
+    {u"Dstrok", 6, u"\x0110", 1},
+    {u"ENG", 3, u"\x014A", 1},
+    {u"ETH", 3, u"\x00D0", 1},
+    {u"Eacute", 6, u"\x00C9", 1},
+    {u"Ecaron", 6, u"\x011A", 1},
+    {u"Ecirc", 5, u"\x00CA", 1},
+    {u"Ecy", 3, u"\x042D", 1},
+    {u"Edot", 4, u"\x0116", 1},
+    {u"Efr", 3, u"\xD835\xDD08", 2},
+    {u"Egrave", 6, u"\x00C8", 1},
+    {u"Element", 7, u"\x2208", 1},
+    {u"Emacr", 5, u"\x0112", 1},
+    {u"EmptySmallSquare", 16, u"\x25FB", 1},
+    {u"EmptyVerySmallSquare", 20, u"\x25AB", 1},
+    {u"Eogon", 5, u"\x0118", 1},
+    {u"Eopf", 4, u"\xD835\xDD3C", 2},
+    {u"Epsilon", 7, u"\x0395", 1},
+    {u"Equal", 5, u"\x2A75", 1},
+    {u"EqualTilde", 10, u"\x2242", 1},
+    {u"Equilibrium", 11, u"\x21CC", 1},
+    {u"Escr", 4, u"\x2130", 1},
+    {u"Esim", 4, u"\x2A73", 1},
+    {u"Eta", 3, u"\x0397", 1},
+    {u"Euml", 4, u"\x00CB", 1},
+    {u"Exists", 6, u"\x2203", 1},
+    {u"ExponentialE", 12, u"\x2147", 1},
+    {u"Fcy", 3, u"\x0424", 1},
+    {u"Ffr", 3, u"\xD835\xDD09", 2},
+    {u"FilledSmallSquare", 17, u"\x25FC", 1},
+    {u"FilledVerySmallSquare", 21, u"\x25AA", 1},
+    {u"Fopf", 4, u"\xD835\xDD3D", 2},
+    {u"ForAll", 6, u"\x2200", 1},
+    {u"Fouriertrf", 10, u"\x2131", 1},
+    {u"Fscr", 4, u"\x2131", 1},
+    {u"GJcy", 4, u"\x0403", 1},
+    {u"GT", 2, u"\x003E", 1},
+    {u"Gamma", 5, u"\x0393", 1},
+    {u"Gammad", 6, u"\x03DC", 1},
+    {u"Gbreve", 6, u"\x011E", 1},
+    {u"Gcedil", 6, u"\x0122", 1},
+    {u"Gcirc", 5, u"\x011C", 1},
+    {u"Gcy", 3, u"\x0413", 1},
+    {u"Gdot", 4, u"\x0120", 1},
+    {u"Gfr", 3, u"\xD835\xDD0A", 2},
+    {u"Gg", 2, u"\x22D9", 1},
+    {u"Gopf", 4, u"\xD835\xDD3E", 2},
+    {u"GreaterEqual", 12, u"\x2265", 1},
+    {u"GreaterEqualLess", 16, u"\x22DB", 1},
+    {u"GreaterFullEqual", 16, u"\x2267", 1},
+    {u"GreaterGreater", 14, u"\x2AA2", 1},
+    {u"GreaterLess", 11, u"\x2277", 1},
+    {u"GreaterSlantEqual", 17, u"\x2A7E", 1},
+    {u"GreaterTilde", 12, u"\x2273", 1},
+    {u"Gscr", 4, u"\xD835\xDCA2", 2},
+    {u"Gt", 2, u"\x226B", 1},
+    {u"HARDcy", 6, u"\x042A", 1},
+    {u"Hacek", 5, u"\x02C7", 1},
+    {u"Hat", 3, u"\x005E", 1},
+    {u"Hcirc", 5, u"\x0124", 1},
+    {u"Hfr", 3, u"\x210C", 1},
+    {u"HilbertSpace", 12, u"\x210B", 1},
+    {u"Hopf", 4, u"\x210D", 1},
+    {u"HorizontalLine", 14, u"\x2500", 1},
+    {u"Hscr", 4, u"\x210B", 1},
+    {u"Hstrok", 6, u"\x0126", 1},
+    {u"HumpDownHump", 12, u"\x224E", 1},
+    {u"HumpEqual", 9, u"\x224F", 1},
+    {u"IEcy", 4, u"\x0415", 1},
+    {u"IJlig", 5, u"\x0132", 1},
+    {u"IOcy", 4, u"\x0401", 1},
+    {u"Iacute", 6, u"\x00CD", 1},
+    {u"Icirc", 5, u"\x00CE", 1},
+    {u"Icy", 3, u"\x0418", 1},
+    {u"Idot", 4, u"\x0130", 1},
+    {u"Ifr", 3, u"\x2111", 1},
+    {u"Igrave", 6, u"\x00CC", 1},
+    {u"Im", 2, u"\x2111", 1},
+    {u"Imacr", 5, u"\x012A", 1},
+    {u"ImaginaryI", 10, u"\x2148", 1},
+    {u"Implies", 7, u"\x21D2", 1},
+    {u"Int", 3, u"\x222C", 1},
+    {u"Integral", 8, u"\x222B", 1},
+    {u"Intersection", 12, u"\x22C2", 1},
+    {u"InvisibleComma", 14, u"\x2063", 1},
+    {u"InvisibleTimes", 14, u"\x2062", 1},
+    {u"Iogon", 5, u"\x012E", 1},
+    {u"Iopf", 4, u"\xD835\xDD40", 2},
+    {u"Iota", 4, u"\x0399", 1},
+    {u"Iscr", 4, u"\x2110", 1},
+    {u"Itilde", 6, u"\x0128", 1},
+    {u"Iukcy", 5, u"\x0406", 1},
+    {u"Iuml", 4, u"\x00CF", 1},
+    {u"Jcirc", 5, u"\x0134", 1},
+    {u"Jcy", 3, u"\x0419", 1},
+    {u"Jfr", 3, u"\xD835\xDD0D", 2},
+    {u"Jopf", 4, u"\xD835\xDD41", 2},
+    {u"Jscr", 4, u"\xD835\xDCA5", 2},
+    {u"Jsercy", 6, u"\x0408", 1},
+    {u"Jukcy", 5, u"\x0404", 1},
+    {u"KHcy", 4, u"\x0425", 1},
+    {u"KJcy", 4, u"\x040C", 1},
+    {u"Kappa", 5, u"\x039A", 1},
+    {u"Kcedil", 6, u"\x0136", 1},
+    {u"Kcy", 3, u"\x041A", 1},
+    {u"Kfr", 3, u"\xD835\xDD0E", 2},
+    {u"Kopf", 4, u"\xD835\xDD42", 2},
+    {u"Kscr", 4, u"\xD835\xDCA6", 2},
+    {u"LJcy", 4, u"\x0409", 1},
+    {u"LT", 2, u"\x003C", 1},
+    {u"Lacute", 6, u"\x0139", 1},
+    {u"Lambda", 6, u"\x039B", 1},
+    {u"Lang", 4, u"\x27EA", 1},
+    {u"Laplacetrf", 10, u"\x2112", 1},
+    {u"Larr", 4, u"\x219E", 1},
+    {u"Lcaron", 6, u"\x013D", 1},
+    {u"Lcedil", 6, u"\x013B", 1},
+    {u"Lcy", 3, u"\x041B", 1},
+    {u"LeftAngleBracket", 16, u"\x27E8", 1},
+    {u"LeftArrow", 9, u"\x2190", 1},
+    {u"LeftArrowBar", 12, u"\x21E4", 1},
+    {u"LeftArrowRightArrow", 19, u"\x21C6", 1},
+    {u"LeftCeiling", 11, u"\x2308", 1},
+    {u"LeftDoubleBracket", 17, u"\x27E6", 1},
+    {u"LeftDownTeeVector", 17, u"\x2961", 1},
+    {u"LeftDownVector", 14, u"\x21C3", 1},
+    {u"LeftDownVectorBar", 17, u"\x2959", 1},
+    {u"LeftFloor", 9, u"\x230A", 1},
+    {u"LeftRightArrow", 14, u"\x2194", 1},
+    {u"LeftRightVector", 15, u"\x294E", 1},
+    {u"LeftTee", 7, u"\x22A3", 1},
+    {u"LeftTeeArrow", 12, u"\x21A4", 1},
+    {u"LeftTeeVector", 13, u"\x295A", 1},
+    {u"LeftTriangle", 12, u"\x22B2", 1},
+    {u"LeftTriangleBar", 15, u"\x29CF", 1},
+    {u"LeftTriangleEqual", 17, u"\x22B4", 1},
+    {u"LeftUpDownVector", 16, u"\x2951", 1},
+    {u"LeftUpTeeVector", 15, u"\x2960", 1},
+    {u"LeftUpVector", 12, u"\x21BF", 1},
+    {u"LeftUpVectorBar", 15, u"\x2958", 1},
+    {u"LeftVector", 10, u"\x21BC", 1},
+    {u"LeftVectorBar", 13, u"\x2952", 1},
+    {u"Leftarrow", 9, u"\x21D0", 1},
+    {u"Leftrightarrow", 14, u"\x21D4", 1},
+    {u"LessEqualGreater", 16, u"\x22DA", 1},
+    {u"LessFullEqual", 13, u"\x2266", 1},
+    {u"LessGreater", 11, u"\x2276", 1},
+    {u"LessLess", 8, u"\x2AA1", 1},
+    {u"LessSlantEqual", 14, u"\x2A7D", 1},
+    {u"LessTilde", 9, u"\x2272", 1},
+    {u"Lfr", 3, u"\xD835\xDD0F", 2},
+    {u"Ll", 2, u"\x22D8", 1},
+    {u"Lleftarrow", 10, u"\x21DA", 1},
+    {u"Lmidot", 6, u"\x013F", 1},
+    {u"LongLeftArrow", 13, u"\x27F5", 1},
+    {u"LongLeftRightArrow", 18, u"\x27F7", 1},
+    {u"LongRightArrow", 14, u"\x27F6", 1},
+    {u"Longleftarrow", 13, u"\x27F8", 1},
+    {u"Longleftrightarrow", 18, u"\x27FA", 1},
+    {u"Longrightarrow", 14, u"\x27F9", 1},
+    {u"Lopf", 4, u"\xD835\xDD43", 2},
+    {u"LowerLeftArrow", 14, u"\x2199", 1},
+    {u"LowerRightArrow", 15, u"\x2198", 1},
+    {u"Lscr", 4, u"\x2112", 1},
+    {u"Lsh", 3, u"\x21B0", 1},
+    {u"Lstrok", 6, u"\x0141", 1},
+    {u"Lt", 2, u"\x226A", 1},
+    {u"Map", 3, u"\x2905", 1},
+    {u"Mcy", 3, u"\x041C", 1},
+    {u"MediumSpace", 11, u"\x205F", 1},
+    {u"Mellintrf", 9, u"\x2133", 1},
+    {u"Mfr", 3, u"\xD835\xDD10", 2},
+    {u"MinusPlus", 9, u"\x2213", 1},
+    {u"Mopf", 4, u"\xD835\xDD44", 2},
+    {u"Mscr", 4, u"\x2133", 1},
+    {u"Mu", 2, u"\x039C", 1},
+    {u"NJcy", 4, u"\x040A", 1},
+    {u"Nacute", 6, u"\x0143", 1},
+    {u"Ncaron", 6, u"\x0147", 1},
+    {u"Ncedil", 6, u"\x0145", 1},
+    {u"Ncy", 3, u"\x041D", 1},
+    {u"NegativeMediumSpace", 19, u"\x200B", 1},
+    {u"NegativeThickSpace", 18, u"\x200B", 1},
+    {u"NegativeThinSpace", 17, u"\x200B", 1},
+    {u"NegativeVeryThinSpace", 21, u"\x200B", 1},
+    {u"NestedGreaterGreater", 20, u"\x226B", 1},
+    {u"NestedLessLess", 14, u"\x226A", 1},
+    {u"NewLine", 7, u"\x000A", 1},
+    {u"Nfr", 3, u"\xD835\xDD11", 2},
+    {u"NoBreak", 7, u"\x2060", 1},
+    {u"NonBreakingSpace", 16, u"\x00A0", 1},
+    {u"Nopf", 4, u"\x2115", 1},
+    {u"Not", 3, u"\x2AEC", 1},
+    {u"NotCongruent", 12, u"\x2262", 1},
+    {u"NotCupCap", 9, u"\x226D", 1},
+    {u"NotDoubleVerticalBar", 20, u"\x2226", 1},
+    {u"NotElement", 10, u"\x2209", 1},
+    {u"NotEqual", 8, u"\x2260", 1},
+    {u"NotEqualTilde", 13, u"\x2242\x0338", 2},
+    {u"NotExists", 9, u"\x2204", 1},
+    {u"NotGreater", 10, u"\x226F", 1},
+    {u"NotGreaterEqual", 15, u"\x2271", 1},
+    {u"NotGreaterFullEqual", 19, u"\x2267\x0338", 2},
+    {u"NotGreaterGreater", 17, u"\x226B\x0338", 2},
+    {u"NotGreaterLess", 14, u"\x2279", 1},
+    {u"NotGreaterSlantEqual", 20, u"\x2A7E\x0338", 2},
+    {u"NotGreaterTilde", 15, u"\x2275", 1},
+    {u"NotHumpDownHump", 15, u"\x224E\x0338", 2},
+    {u"NotHumpEqual", 12, u"\x224F\x0338", 2},
+    {u"NotLeftTriangle", 15, u"\x22EA", 1},
+    {u"NotLeftTriangleBar", 18, u"\x29CF\x0338", 2},
+    {u"NotLeftTriangleEqual", 20, u"\x22EC", 1},
+    {u"NotLess", 7, u"\x226E", 1},
+    {u"NotLessEqual", 12, u"\x2270", 1},
+    {u"NotLessGreater", 14, u"\x2278", 1},
+    {u"NotLessLess", 11, u"\x226A\x0338", 2},
+    {u"NotLessSlantEqual", 17, u"\x2A7D\x0338", 2},
+    {u"NotLessTilde", 12, u"\x2274", 1},
+    {u"NotNestedGreaterGreater", 23, u"\x2AA2\x0338", 2},
+    {u"NotNestedLessLess", 17, u"\x2AA1\x0338", 2},
+    {u"NotPrecedes", 11, u"\x2280", 1},
+    {u"NotPrecedesEqual", 16, u"\x2AAF\x0338", 2},
+    {u"NotPrecedesSlantEqual", 21, u"\x22E0", 1},
+    {u"NotReverseElement", 17, u"\x220C", 1},
+    {u"NotRightTriangle", 16, u"\x22EB", 1},
+    {u"NotRightTriangleBar", 19, u"\x29D0\x0338", 2},
+    {u"NotRightTriangleEqual", 21, u"\x22ED", 1},
+    {u"NotSquareSubset", 15, u"\x228F\x0338", 2},
+    {u"NotSquareSubsetEqual", 20, u"\x22E2", 1},
+    {u"NotSquareSuperset", 17, u"\x2290\x0338", 2},
+    {u"NotSquareSupersetEqual", 22, u"\x22E3", 1},
+    {u"NotSubset", 9, u"\x2282\x20D2", 2},
+    {u"NotSubsetEqual", 14, u"\x2288", 1},
+    {u"NotSucceeds", 11, u"\x2281", 1},
+    {u"NotSucceedsEqual", 16, u"\x2AB0\x0338", 2},
+    {u"NotSucceedsSlantEqual", 21, u"\x22E1", 1},
+    {u"NotSucceedsTilde", 16, u"\x227F\x0338", 2},
+    {u"NotSuperset", 11, u"\x2283\x20D2", 2},
+    {u"NotSupersetEqual", 16, u"\x2289", 1},
+    {u"NotTilde", 8, u"\x2241", 1},
+    {u"NotTildeEqual", 13, u"\x2244", 1},
+    {u"NotTildeFullEqual", 17, u"\x2247", 1},
+    {u"NotTildeTilde", 13, u"\x2249", 1},
+    {u"NotVerticalBar", 14, u"\x2224", 1},
+    {u"Nscr", 4, u"\xD835\xDCA9", 2},
+    {u"Ntilde", 6, u"\x00D1", 1},
+    {u"Nu", 2, u"\x039D", 1},
+    {u"OElig", 5, u"\x0152", 1},
+    {u"Oacute", 6, u"\x00D3", 1},
+    {u"Ocirc", 5, u"\x00D4", 1},
+    {u"Ocy", 3, u"\x041E", 1},
+    {u"Odblac", 6, u"\x0150", 1},
+    {u"Ofr", 3, u"\xD835\xDD12", 2},
+    {u"Ograve", 6, u"\x00D2", 1},
+    {u"Omacr", 5, u"\x014C", 1},
+    {u"Omega", 5, u"\x03A9", 1},
+    {u"Omicron", 7, u"\x039F", 1},
+    {u"Oopf", 4, u"\xD835\xDD46", 2},
+    {u"OpenCurlyDoubleQuote", 20, u"\x201C", 1},
+    {u"OpenCurlyQuote", 14, u"\x2018", 1},
+    {u"Or", 2, u"\x2A54", 1},
+    {u"Oscr", 4, u"\xD835\xDCAA", 2},
+    {u"Oslash", 6, u"\x00D8", 1},
+    {u"Otilde", 6, u"\x00D5", 1},
+    {u"Otimes", 6, u"\x2A37", 1},
+    {u"Ouml", 4, u"\x00D6", 1},
+    {u"OverBar", 7, u"\x203E", 1},
+    {u"OverBrace", 9, u"\x23DE", 1},
+    {u"OverBracket", 11, u"\x23B4", 1},
+    {u"OverParenthesis", 15, u"\x23DC", 1},
+    {u"PartialD", 8, u"\x2202", 1},
+    {u"Pcy", 3, u"\x041F", 1},
+    {u"Pfr", 3, u"\xD835\xDD13", 2},
+    {u"Phi", 3, u"\x03A6", 1},
+    {u"Pi", 2, u"\x03A0", 1},
+    {u"PlusMinus", 9, u"\x00B1", 1},
+    {u"Poincareplane", 13, u"\x210C", 1},
+    {u"Popf", 4, u"\x2119", 1},
+    {u"Pr", 2, u"\x2ABB", 1},
+    {u"Precedes", 8, u"\x227A", 1},
+    {u"PrecedesEqual", 13, u"\x2AAF", 1},
+    {u"PrecedesSlantEqual", 18, u"\x227C", 1},
+    {u"PrecedesTilde", 13, u"\x227E", 1},
+    {u"Prime", 5, u"\x2033", 1},
+    {u"Product", 7, u"\x220F", 1},
+    {u"Proportion", 10, u"\x2237", 1},
+    {u"Proportional", 12, u"\x221D", 1},
+    {u"Pscr", 4, u"\xD835\xDCAB", 2},
+    {u"Psi", 3, u"\x03A8", 1},
+    {u"QUOT", 4, u"\x0022", 1},
+    {u"Qfr", 3, u"\xD835\xDD14", 2},
+    {u"Qopf", 4, u"\x211A", 1},
+    {u"Qscr", 4, u"\xD835\xDCAC", 2},
+    {u"RBarr", 5, u"\x2910", 1},
+    {u"REG", 3, u"\x00AE", 1},
+    {u"Racute", 6, u"\x0154", 1},
+    {u"Rang", 4, u"\x27EB", 1},
+    {u"Rarr", 4, u"\x21A0", 1},
+    {u"Rarrtl", 6, u"\x2916", 1},
+    {u"Rcaron", 6, u"\x0158", 1},
+    {u"Rcedil", 6, u"\x0156", 1},
+    {u"Rcy", 3, u"\x0420", 1},
+    {u"Re", 2, u"\x211C", 1},
+    {u"ReverseElement", 14, u"\x220B", 1},
+    {u"ReverseEquilibrium", 18, u"\x21CB", 1},
+    {u"ReverseUpEquilibrium", 20, u"\x296F", 1},
+    {u"Rfr", 3, u"\x211C", 1},
+    {u"Rho", 3, u"\x03A1", 1},
+    {u"RightAngleBracket", 17, u"\x27E9", 1},
+    {u"RightArrow", 10, u"\x2192", 1},
+    {u"RightArrowBar", 13, u"\x21E5", 1},
+    {u"RightArrowLeftArrow", 19, u"\x21C4", 1},
+    {u"RightCeiling", 12, u"\x2309", 1},
+    {u"RightDoubleBracket", 18, u"\x27E7", 1},
+    {u"RightDownTeeVector", 18, u"\x295D", 1},
+    {u"RightDownVector", 15, u"\x21C2", 1},
+    {u"RightDownVectorBar", 18, u"\x2955", 1},
+    {u"RightFloor", 10, u"\x230B", 1},
+    {u"RightTee", 8, u"\x22A2", 1},
+    {u"RightTeeArrow", 13, u"\x21A6", 1},
+    {u"RightTeeVector", 14, u"\x295B", 1},
+    {u"RightTriangle", 13, u"\x22B3", 1},
+    {u"RightTriangleBar", 16, u"\x29D0", 1},
+    {u"RightTriangleEqual", 18, u"\x22B5", 1},
+    {u"RightUpDownVector", 17, u"\x294F", 1},
+    {u"RightUpTeeVector", 16, u"\x295C", 1},
+    {u"RightUpVector", 13, u"\x21BE", 1},
+    {u"RightUpVectorBar", 16, u"\x2954", 1},
+    {u"RightVector", 11, u"\x21C0", 1},
+    {u"RightVectorBar", 14, u"\x2953", 1},
+    {u"Rightarrow", 10, u"\x21D2", 1},
+    {u"Ropf", 4, u"\x211D", 1},
+    {u"RoundImplies", 12, u"\x2970", 1},
+    {u"Rrightarrow", 11, u"\x21DB", 1},
+    {u"Rscr", 4, u"\x211B", 1},
+    {u"Rsh", 3, u"\x21B1", 1},
+    {u"RuleDelayed", 11, u"\x29F4", 1},
+    {u"SHCHcy", 6, u"\x0429", 1},
+    {u"SHcy", 4, u"\x0428", 1},
+    {u"SOFTcy", 6, u"\x042C", 1},
+    {u"Sacute", 6, u"\x015A", 1},
+    {u"Sc", 2, u"\x2ABC", 1},
+    {u"Scaron", 6, u"\x0160", 1},
+    {u"Scedil", 6, u"\x015E", 1},
+    {u"Scirc", 5, u"\x015C", 1},
+    {u"Scy", 3, u"\x0421", 1},
+    {u"Sfr", 3, u"\xD835\xDD16", 2},
+    {u"ShortDownArrow", 14, u"\x2193", 1},
+    {u"ShortLeftArrow", 14, u"\x2190", 1},
+    {u"ShortRightArrow", 15, u"\x2192", 1},
+    {u"ShortUpArrow", 12, u"\x2191", 1},
+    {u"Sigma", 5, u"\x03A3", 1},
+    {u"SmallCircle", 11, u"\x2218", 1},
+    {u"Sopf", 4, u"\xD835\xDD4A", 2},
+    {u"Sqrt", 4, u"\x221A", 1},
+    {u"Square", 6, u"\x25A1", 1},
+    {u"SquareIntersection", 18, u"\x2293", 1},
+    {u"SquareSubset", 12, u"\x228F", 1},
+    {u"SquareSubsetEqual", 17, u"\x2291", 1},
+    {u"SquareSuperset", 14, u"\x2290", 1},
+    {u"SquareSupersetEqual", 19, u"\x2292", 1},
+    {u"SquareUnion", 11, u"\x2294", 1},
+    {u"Sscr", 4, u"\xD835\xDCAE", 2},
+    {u"Star", 4, u"\x22C6", 1},
+    {u"Sub", 3, u"\x22D0", 1},
+    {u"Subset", 6, u"\x22D0", 1},
+    {u"SubsetEqual", 11, u"\x2286", 1},
+    {u"Succeeds", 8, u"\x227B", 1},
+    {u"SucceedsEqual", 13, u"\x2AB0", 1},
+    {u"SucceedsSlantEqual", 18, u"\x227D", 1},
+    {u"SucceedsTilde", 13, u"\x227F", 1},
+    {u"SuchThat", 8, u"\x220B", 1},
+    {u"Sum", 3, u"\x2211", 1},
+    {u"Sup", 3, u"\x22D1", 1},
+    {u"Superset", 8, u"\x2283", 1},
+    {u"SupersetEqual", 13, u"\x2287", 1},
+    {u"Supset", 6, u"\x22D1", 1},
+    {u"THORN", 5, u"\x00DE", 1},
+    {u"TRADE", 5, u"\x2122", 1},
+    {u"TSHcy", 5, u"\x040B", 1},
+    {u"TScy", 4, u"\x0426", 1},
+    {u"Tab", 3, u"\x0009", 1},
+    {u"Tau", 3, u"\x03A4", 1},
+    {u"Tcaron", 6, u"\x0164", 1},
+    {u"Tcedil", 6, u"\x0162", 1},
+    {u"Tcy", 3, u"\x0422", 1},
+    {u"Tfr", 3, u"\xD835\xDD17", 2},
+    {u"Therefore", 9, u"\x2234", 1},
+    {u"Theta", 5, u"\x0398", 1},
+    {u"ThickSpace", 10, u"\x205F\x200A", 2},
+    {u"ThinSpace", 9, u"\x2009", 1},
+    {u"Tilde", 5, u"\x223C", 1},
+    {u"TildeEqual", 10, u"\x2243", 1},
+    {u"TildeFullEqual", 14, u"\x2245", 1},
+    {u"TildeTilde", 10, u"\x2248", 1},
+    {u"Topf", 4, u"\xD835\xDD4B", 2},
+    {u"TripleDot", 9, u"\x20DB", 1},
+    {u"Tscr", 4, u"\xD835\xDCAF", 2},
+    {u"Tstrok", 6, u"\x0166", 1},
+    {u"Uacute", 6, u"\x00DA", 1},
+    {u"Uarr", 4, u"\x219F", 1},
+    {u"Uarrocir", 8, u"\x2949", 1},
+    {u"Ubrcy", 5, u"\x040E", 1},
+    {u"Ubreve", 6, u"\x016C", 1},
+    {u"Ucirc", 5, u"\x00DB", 1},
+    {u"Ucy", 3, u"\x0423", 1},
+    {u"Udblac", 6, u"\x0170", 1},
+    {u"Ufr", 3, u"\xD835\xDD18", 2},
+    {u"Ugrave", 6, u"\x00D9", 1},
+    {u"Umacr", 5, u"\x016A", 1},
+    {u"UnderBar", 8, u"\x005F", 1},
+    {u"UnderBrace", 10, u"\x23DF", 1},
+    {u"UnderBracket", 12, u"\x23B5", 1},
+    {u"UnderParenthesis", 16, u"\x23DD", 1},
+    {u"Union", 5, u"\x22C3", 1},
+    {u"UnionPlus", 9, u"\x228E", 1},
+    {u"Uogon", 5, u"\x0172", 1},
+    {u"Uopf", 4, u"\xD835\xDD4C", 2},
+    {u"UpArrow", 7, u"\x2191", 1},
+    {u"UpArrowBar", 10, u"\x2912", 1},
+    {u"UpArrowDownArrow", 16, u"\x21C5", 1},
+    {u"UpDownArrow", 11, u"\x2195", 1},
+    {u"UpEquilibrium", 13, u"\x296E", 1},
+    {u"UpTee", 5, u"\x22A5", 1},
+    {u"UpTeeArrow", 10, u"\x21A5", 1},
+    {u"Uparrow", 7, u"\x21D1", 1},
+    {u"Updownarrow", 11, u"\x21D5", 1},
+    {u"UpperLeftArrow", 14, u"\x2196", 1},
+    {u"UpperRightArrow", 15, u"\x2197", 1},
+    {u"Upsi", 4, u"\x03D2", 1},
+    {u"Upsilon", 7, u"\x03A5", 1},
+    {u"Uring", 5, u"\x016E", 1},
+    {u"Uscr", 4, u"\xD835\xDCB0", 2},
+    {u"Utilde", 6, u"\x0168", 1},
+    {u"Uuml", 4, u"\x00DC", 1},
+    {u"VDash", 5, u"\x22AB", 1},
+    {u"Vbar", 4, u"\x2AEB", 1},
+    {u"Vcy", 3, u"\x0412", 1},
+    {u"Vdash", 5, u"\x22A9", 1},
+    {u"Vdashl", 6, u"\x2AE6", 1},
+    {u"Vee", 3, u"\x22C1", 1},
+    {u"Verbar", 6, u"\x2016", 1},
+    {u"Vert", 4, u"\x2016", 1},
+    {u"VerticalBar", 11, u"\x2223", 1},
+    {u"VerticalLine", 12, u"\x007C", 1},
+    {u"VerticalSeparator", 17, u"\x2758", 1},
+    {u"VerticalTilde", 13, u"\x2240", 1},
+    {u"VeryThinSpace", 13, u"\x200A", 1},
+    {u"Vfr", 3, u"\xD835\xDD19", 2},
+    {u"Vopf", 4, u"\xD835\xDD4D", 2},
+    {u"Vscr", 4, u"\xD835\xDCB1", 2},
+    {u"Vvdash", 6, u"\x22AA", 1},
+    {u"Wcirc", 5, u"\x0174", 1},
+    {u"Wedge", 5, u"\x22C0", 1},
+    {u"Wfr", 3, u"\xD835\xDD1A", 2},
+    {u"Wopf", 4, u"\xD835\xDD4E", 2},
+    {u"Wscr", 4, u"\xD835\xDCB2", 2},
+    {u"Xfr", 3, u"\xD835\xDD1B", 2},
+    {u"Xi", 2, u"\x039E", 1},
+    {u"Xopf", 4, u"\xD835\xDD4F", 2},
+    {u"Xscr", 4, u"\xD835\xDCB3", 2},
+    {u"YAcy", 4, u"\x042F", 1},
+    {u"YIcy", 4, u"\x0407", 1},
+    {u"YUcy", 4, u"\x042E", 1},
+    {u"Yacute", 6, u"\x00DD", 1},
+    {u"Ycirc", 5, u"\x0176", 1},
+    {u"Ycy", 3, u"\x042B", 1},
+    {u"Yfr", 3, u"\xD835\xDD1C", 2},
+    {u"Yopf", 4, u"\xD835\xDD50", 2},
+    {u"Yscr", 4, u"\xD835\xDCB4", 2},
+    {u"Yuml", 4, u"\x0178", 1},
+    {u"ZHcy", 4, u"\x0416", 1},
+    {u"Zacute", 6, u"\x0179", 1},
+    {u"Zcaron", 6, u"\x017D", 1},
+    {u"Zcy", 3, u"\x0417", 1},
+    {u"Zdot", 4, u"\x017B", 1},
+    {u"ZeroWidthSpace", 14, u"\x200B", 1},
+    {u"Zeta", 4, u"\x0396", 1},
+    {u"Zfr", 3, u"\x2128", 1},
+    {u"Zopf", 4, u"\x2124", 1},
+    {u"Zscr", 4, u"\xD835\xDCB5", 2},
+    {u"aacute", 6, u"\x00E1", 1},
+    {u"abreve", 6, u"\x0103", 1},
+    {u"ac", 2, u"\x223E", 1},
+    {u"acE", 3, u"\x223E\x0333", 2},
+    {u"acd", 3, u"\x223F", 1},
+    {u"acirc", 5, u"\x00E2", 1},
+    {u"acute", 5, u"\x00B4", 1},
+    {u"acy", 3, u"\x0430", 1},
+    {u"aelig", 5, u"\x00E6", 1},
+    {u"af", 2, u"\x2061", 1},
+    {u"afr", 3, u"\xD835\xDD1E", 2},
+    {u"agrave", 6, u"\x00E0", 1},
+    {u"alefsym", 7, u"\x2135", 1},
+    {u"aleph", 5, u"\x2135", 1},
+    {u"alpha", 5, u"\x03B1", 1},
+    {u"amacr", 5, u"\x0101", 1},
+    {u"amalg", 5, u"\x2A3F", 1},
+    {u"amp", 3, u"\x0026", 1},
+    {u"and", 3, u"\x2227", 1},
+    {u"andand", 6, u"\x2A55", 1},
+    {u"andd", 4, u"\x2A5C", 1},
+    {u"andslope", 8, u"\x2A58", 1},
+    {u"andv", 4, u"\x2A5A", 1},
+    {u"ang", 3, u"\x2220", 1},
+    {u"ange", 4, u"\x29A4", 1},
+    {u"angle", 5, u"\x2220", 1},
+    {u"angmsd", 6, u"\x2221", 1},
+    {u"angmsdaa", 8, u"\x29A8", 1},
+    {u"angmsdab", 8, u"\x29A9", 1},
+    {u"angmsdac", 8, u"\x29AA", 1},
+    {u"angmsdad", 8, u"\x29AB", 1},
+    {u"angmsdae", 8, u"\x29AC", 1},
+    {u"angmsdaf", 8, u"\x29AD", 1},
+    {u"angmsdag", 8, u"\x29AE", 1},
+    {u"angmsdah", 8, u"\x29AF", 1},
+    {u"angrt", 5, u"\x221F", 1},
+    {u"angrtvb", 7, u"\x22BE", 1},
+    {u"angrtvbd", 8, u"\x299D", 1},
+    {u"angsph", 6, u"\x2222", 1},
+    {u"angst", 5, u"\x00C5", 1},
+    {u"angzarr", 7, u"\x237C", 1},
+    {u"aogon", 5, u"\x0105", 1},
+    {u"aopf", 4, u"\xD835\xDD52", 2},
+    {u"ap", 2, u"\x2248", 1},
+    {u"apE", 3, u"\x2A70", 1},
+    {u"apacir", 6, u"\x2A6F", 1},
+    {u"ape", 3, u"\x224A", 1},
+    {u"apid", 4, u"\x224B", 1},
+    {u"apos", 4, u"\x0027", 1},
+    {u"approx", 6, u"\x2248", 1},
+    {u"approxeq", 8, u"\x224A", 1},
+    {u"aring", 5, u"\x00E5", 1},
+    {u"ascr", 4, u"\xD835\xDCB6", 2},
+    {u"ast", 3, u"\x002A", 1},
+    {u"asymp", 5, u"\x2248", 1},
+    {u"asympeq", 7, u"\x224D", 1},
+    {u"atilde", 6, u"\x00E3", 1},
+    {u"auml", 4, u"\x00E4", 1},
+    {u"awconint", 8, u"\x2233", 1},
+    {u"awint", 5, u"\x2A11", 1},
+    {u"bNot", 4, u"\x2AED", 1},
+    {u"backcong", 8, u"\x224C", 1},
+    {u"backepsilon", 11, u"\x03F6", 1},
+    {u"backprime", 9, u"\x2035", 1},
+    {u"backsim", 7, u"\x223D", 1},
+    {u"backsimeq", 9, u"\x22CD", 1},
+    {u"barvee", 6, u"\x22BD", 1},
+    {u"barwed", 6, u"\x2305", 1},
+    {u"barwedge", 8, u"\x2305", 1},
+    {u"bbrk", 4, u"\x23B5", 1},
+    {u"bbrktbrk", 8, u"\x23B6", 1},
+    {u"bcong", 5, u"\x224C", 1},
+    {u"bcy", 3, u"\x0431", 1},
+    {u"bdquo", 5, u"\x201E", 1},
+    {u"becaus", 6, u"\x2235", 1},
+    {u"because", 7, u"\x2235", 1},
+    {u"bemptyv", 7, u"\x29B0", 1},
+    {u"bepsi", 5, u"\x03F6", 1},
+    {u"bernou", 6, u"\x212C", 1},
+    {u"beta", 4, u"\x03B2", 1},
+    {u"beth", 4, u"\x2136", 1},
+    {u"between", 7, u"\x226C", 1},
+    {u"bfr", 3, u"\xD835\xDD1F", 2},
+    {u"bigcap", 6, u"\x22C2", 1},
+    {u"bigcirc", 7, u"\x25EF", 1},
+    {u"bigcup", 6, u"\x22C3", 1},
+    {u"bigodot", 7, u"\x2A00", 1},
+    {u"bigoplus", 8, u"\x2A01", 1},
+    {u"bigotimes", 9, u"\x2A02", 1},
+    {u"bigsqcup", 8, u"\x2A06", 1},
+    {u"bigstar", 7, u"\x2605", 1},
+    {u"bigtriangledown", 15, u"\x25BD", 1},
+    {u"bigtriangleup", 13, u"\x25B3", 1},
+    {u"biguplus", 8, u"\x2A04", 1},
+    {u"bigvee", 6, u"\x22C1", 1},
+    {u"bigwedge", 8, u"\x22C0", 1},
+    {u"bkarow", 6, u"\x290D", 1},
+    {u"blacklozenge", 12, u"\x29EB", 1},
+    {u"blacksquare", 11, u"\x25AA", 1},
+    {u"blacktriangle", 13, u"\x25B4", 1},
+    {u"blacktriangledown", 17, u"\x25BE", 1},
+    {u"blacktriangleleft", 17, u"\x25C2", 1},
+    {u"blacktriangleright", 18, u"\x25B8", 1},
+    {u"blank", 5, u"\x2423", 1},
+    {u"blk12", 5, u"\x2592", 1},
+    {u"blk14", 5, u"\x2591", 1},
+    {u"blk34", 5, u"\x2593", 1},
+    {u"block", 5, u"\x2588", 1},
+    {u"bne", 3, u"\x003D\x20E5", 2},
+    {u"bnequiv", 7, u"\x2261\x20E5", 2},
+    {u"bnot", 4, u"\x2310", 1},
+    {u"bopf", 4, u"\xD835\xDD53", 2},
+    {u"bot", 3, u"\x22A5", 1},
+    {u"bottom", 6, u"\x22A5", 1},
+    {u"bowtie", 6, u"\x22C8", 1},
+    {u"boxDL", 5, u"\x2557", 1},
+    {u"boxDR", 5, u"\x2554", 1},
+    {u"boxDl", 5, u"\x2556", 1},
+    {u"boxDr", 5, u"\x2553", 1},
+    {u"boxH", 4, u"\x2550", 1},
+    {u"boxHD", 5, u"\x2566", 1},
+    {u"boxHU", 5, u"\x2569", 1},
+    {u"boxHd", 5, u"\x2564", 1},
+    {u"boxHu", 5, u"\x2567", 1},
+    {u"boxUL", 5, u"\x255D", 1},
+    {u"boxUR", 5, u"\x255A", 1},
+    {u"boxUl", 5, u"\x255C", 1},
+    {u"boxUr", 5, u"\x2559", 1},
+    {u"boxV", 4, u"\x2551", 1},
+    {u"boxVH", 5, u"\x256C", 1},
+    {u"boxVL", 5, u"\x2563", 1},
+    {u"boxVR", 5, u"\x2560", 1},
+    {u"boxVh", 5, u"\x256B", 1},
+    {u"boxVl", 5, u"\x2562", 1},
+    {u"boxVr", 5, u"\x255F", 1},
+    {u"boxbox", 6, u"\x29C9", 1},
+    {u"boxdL", 5, u"\x2555", 1},
+    {u"boxdR", 5, u"\x2552", 1},
+    {u"boxdl", 5, u"\x2510", 1},
+    {u"boxdr", 5, u"\x250C", 1},
+    {u"boxh", 4, u"\x2500", 1},
+    {u"boxhD", 5, u"\x2565", 1},
+    {u"boxhU", 5, u"\x2568", 1},
+    {u"boxhd", 5, u"\x252C", 1},
+    {u"boxhu", 5, u"\x2534", 1},
+    {u"boxminus", 8, u"\x229F", 1},
+    {u"boxplus", 7, u"\x229E", 1},
+    {u"boxtimes", 8, u"\x22A0", 1},
+    {u"boxuL", 5, u"\x255B", 1},
+    {u"boxuR", 5, u"\x2558", 1},
+    {u"boxul", 5, u"\x2518", 1},
+    {u"boxur", 5, u"\x2514", 1},
+    {u"boxv", 4, u"\x2502", 1},
+    {u"boxvH", 5, u"\x256A", 1},
+    {u"boxvL", 5, u"\x2561", 1},
+    {u"boxvR", 5, u"\x255E", 1},
+    {u"boxvh", 5, u"\x253C", 1},
+    {u"boxvl", 5, u"\x2524", 1},
+    {u"boxvr", 5, u"\x251C", 1},
+    {u"bprime", 6, u"\x2035", 1},
+    {u"breve", 5, u"\x02D8", 1},
+    {u"brvbar", 6, u"\x00A6", 1},
+    {u"bscr", 4, u"\xD835\xDCB7", 2},
+    {u"bsemi", 5, u"\x204F", 1},
+    {u"bsim", 4, u"\x223D", 1},
+    {u"bsime", 5, u"\x22CD", 1},
+    {u"bsol", 4, u"\x005C", 1},
+    {u"bsolb", 5, u"\x29C5", 1},
+    {u"bsolhsub", 8, u"\x27C8", 1},
+    {u"bull", 4, u"\x2022", 1},
+    {u"bullet", 6, u"\x2022", 1},
+    {u"bump", 4, u"\x224E", 1},
+    {u"bumpE", 5, u"\x2AAE", 1},
+    {u"bumpe", 5, u"\x224F", 1},
+    {u"bumpeq", 6, u"\x224F", 1},
+    {u"cacute", 6, u"\x0107", 1},
+    {u"cap", 3, u"\x2229", 1},
+    {u"capand", 6, u"\x2A44", 1},
+    {u"capbrcup", 8, u"\x2A49", 1},
+    {u"capcap", 6, u"\x2A4B", 1},
+    {u"capcup", 6, u"\x2A47", 1},
+    {u"capdot", 6, u"\x2A40", 1},
+    {u"caps", 4, u"\x2229\xFE00", 2},
+    {u"caret", 5, u"\x2041", 1},
+    {u"caron", 5, u"\x02C7", 1},
+    {u"ccaps", 5, u"\x2A4D", 1},
+    {u"ccaron", 6, u"\x010D", 1},
+    {u"ccedil", 6, u"\x00E7", 1},
+    {u"ccirc", 5, u"\x0109", 1},
+    {u"ccups", 5, u"\x2A4C", 1},
+    {u"ccupssm", 7, u"\x2A50", 1},
+    {u"cdot", 4, u"\x010B", 1},
+    {u"cedil", 5, u"\x00B8", 1},
+    {u"cemptyv", 7, u"\x29B2", 1},
+    {u"cent", 4, u"\x00A2", 1},
+    {u"centerdot", 9, u"\x00B7", 1},
+    {u"cfr", 3, u"\xD835\xDD20", 2},
+    {u"chcy", 4, u"\x0447", 1},
+    {u"check", 5, u"\x2713", 1},
+    {u"checkmark", 9, u"\x2713", 1},
+    {u"chi", 3, u"\x03C7", 1},
+    {u"cir", 3, u"\x25CB", 1},
+    {u"cirE", 4, u"\x29C3", 1},
+    {u"circ", 4, u"\x02C6", 1},
+    {u"circeq", 6, u"\x2257", 1},
+    {u"circlearrowleft", 15, u"\x21BA", 1},
+    {u"circlearrowright", 16, u"\x21BB", 1},
+    {u"circledR", 8, u"\x00AE", 1},
+    {u"circledS", 8, u"\x24C8", 1},
+    {u"circledast", 10, u"\x229B", 1},
+    {u"circledcirc", 11, u"\x229A", 1},
+    {u"circleddash", 11, u"\x229D", 1},
+    {u"cire", 4, u"\x2257", 1},
+    {u"cirfnint", 8, u"\x2A10", 1},
+    {u"cirmid", 6, u"\x2AEF", 1},
+    {u"cirscir", 7, u"\x29C2", 1},
+    {u"clubs", 5, u"\x2663", 1},
+    {u"clubsuit", 8, u"\x2663", 1},
+    {u"colon", 5, u"\x003A", 1},
+    {u"colone", 6, u"\x2254", 1},
+    {u"coloneq", 7, u"\x2254", 1},
+    {u"comma", 5, u"\x002C", 1},
+    {u"commat", 6, u"\x0040", 1},
+    {u"comp", 4, u"\x2201", 1},
+    {u"compfn", 6, u"\x2218", 1},
+    {u"complement", 10, u"\x2201", 1},
+    {u"complexes", 9, u"\x2102", 1},
+    {u"cong", 4, u"\x2245", 1},
+    {u"congdot", 7, u"\x2A6D", 1},
+    {u"conint", 6, u"\x222E", 1},
+    {u"copf", 4, u"\xD835\xDD54", 2},
+    {u"coprod", 6, u"\x2210", 1},
+    {u"copy", 4, u"\x00A9", 1},
+    {u"copysr", 6, u"\x2117", 1},
+    {u"crarr", 5, u"\x21B5", 1},
+    {u"cross", 5, u"\x2717", 1},
+    {u"cscr", 4, u"\xD835\xDCB8", 2},
+    {u"csub", 4, u"\x2ACF", 1},
+    {u"csube", 5, u"\x2AD1", 1},
+    {u"csup", 4, u"\x2AD0", 1},
+    {u"csupe", 5, u"\x2AD2", 1},
+    {u"ctdot", 5, u"\x22EF", 1},
+    {u"cudarrl", 7, u"\x2938", 1},
+    {u"cudarrr", 7, u"\x2935", 1},
+    {u"cuepr", 5, u"\x22DE", 1},
+    {u"cuesc", 5, u"\x22DF", 1},
+    {u"cularr", 6, u"\x21B6", 1},
+    {u"cularrp", 7, u"\x293D", 1},
+    {u"cup", 3, u"\x222A", 1},
+    {u"cupbrcap", 8, u"\x2A48", 1},
+    {u"cupcap", 6, u"\x2A46", 1},
+    {u"cupcup", 6, u"\x2A4A", 1},
+    {u"cupdot", 6, u"\x228D", 1},
+    {u"cupor", 5, u"\x2A45", 1},
+    {u"cups", 4, u"\x222A\xFE00", 2},
+    {u"curarr", 6, u"\x21B7", 1},
+    {u"curarrm", 7, u"\x293C", 1},
+    {u"curlyeqprec", 11, u"\x22DE", 1},
+    {u"curlyeqsucc", 11, u"\x22DF", 1},
+    {u"curlyvee", 8, u"\x22CE", 1},
+    {u"curlywedge", 10, u"\x22CF", 1},
+    {u"curren", 6, u"\x00A4", 1},
+    {u"curvearrowleft", 14, u"\x21B6", 1},
+    {u"curvearrowright", 15, u"\x21B7", 1},
+    {u"cuvee", 5, u"\x22CE", 1},
+    {u"cuwed", 5, u"\x22CF", 1},
+    {u"cwconint", 8, u"\x2232", 1},
+    {u"cwint", 5, u"\x2231", 1},
+    {u"cylcty", 6, u"\x232D", 1},
+    {u"dArr", 4, u"\x21D3", 1},
+    {u"dHar", 4, u"\x2965", 1},
+    {u"dagger", 6, u"\x2020", 1},
+    {u"daleth", 6, u"\x2138", 1},
+    {u"darr", 4, u"\x2193", 1},
+    {u"dash", 4, u"\x2010", 1},
+    {u"dashv", 5, u"\x22A3", 1},
+    {u"dbkarow", 7, u"\x290F", 1},
+    {u"dblac", 5, u"\x02DD", 1},
+    {u"dcaron", 6, u"\x010F", 1},
+    {u"dcy", 3, u"\x0434", 1},
+    {u"dd", 2, u"\x2146", 1},
+    {u"ddagger", 7, u"\x2021", 1},
+    {u"ddarr", 5, u"\x21CA", 1},
+    {u"ddotseq", 7, u"\x2A77", 1},
+    {u"deg", 3, u"\x00B0", 1},
+    {u"delta", 5, u"\x03B4", 1},
+    {u"demptyv", 7, u"\x29B1", 1},
+    {u"dfisht", 6, u"\x297F", 1},
+    {u"dfr", 3, u"\xD835\xDD21", 2},
+    {u"dharl", 5, u"\x21C3", 1},
+    {u"dharr", 5, u"\x21C2", 1},
+    {u"diam", 4, u"\x22C4", 1},
+    {u"diamond", 7, u"\x22C4", 1},
+    {u"diamondsuit", 11, u"\x2666", 1},
+    {u"diams", 5, u"\x2666", 1},
+    {u"die", 3, u"\x00A8", 1},
+    {u"digamma", 7, u"\x03DD", 1},
+    {u"disin", 5, u"\x22F2", 1},
+    {u"div", 3, u"\x00F7", 1},
+    {u"divide", 6, u"\x00F7", 1},
+    {u"divideontimes", 13, u"\x22C7", 1},
+    {u"divonx", 6, u"\x22C7", 1},
+    {u"djcy", 4, u"\x0452", 1},
+    {u"dlcorn", 6, u"\x231E", 1},
+    {u"dlcrop", 6, u"\x230D", 1},
+    {u"dollar", 6, u"\x0024", 1},
+    {u"dopf", 4, u"\xD835\xDD55", 2},
+    {u"dot", 3, u"\x02D9", 1},
+    {u"doteq", 5, u"\x2250", 1},
+    {u"doteqdot", 8, u"\x2251", 1},
+    {u"dotminus", 8, u"\x2238", 1},
+    {u"dotplus", 7, u"\x2214", 1},
+    {u"dotsquare", 9, u"\x22A1", 1},
+    {u"doublebarwedge", 14, u"\x2306", 1},
+    {u"downarrow", 9, u"\x2193", 1},
+    {u"downdownarrows", 14, u"\x21CA", 1},
+    {u"downharpoonleft", 15, u"\x21C3", 1},
+    {u"downharpoonright", 16, u"\x21C2", 1},
+    {u"drbkarow", 8, u"\x2910", 1},
+    {u"drcorn", 6, u"\x231F", 1},
+    {u"drcrop", 6, u"\x230C", 1},
+    {u"dscr", 4, u"\xD835\xDCB9", 2},
+    {u"dscy", 4, u"\x0455", 1},
+    {u"dsol", 4, u"\x29F6", 1},
+    {u"dstrok", 6, u"\x0111", 1},
+    {u"dtdot", 5, u"\x22F1", 1},
+    {u"dtri", 4, u"\x25BF", 1},
+    {u"dtrif", 5, u"\x25BE", 1},
+    {u"duarr", 5, u"\x21F5", 1},
+    {u"duhar", 5, u"\x296F", 1},
+    {u"dwangle", 7, u"\x29A6", 1},
+    {u"dzcy", 4, u"\x045F", 1},
+    {u"dzigrarr", 8, u"\x27FF", 1},
+    {u"eDDot", 5, u"\x2A77", 1},
+    {u"eDot", 4, u"\x2251", 1},
+    {u"eacute", 6, u"\x00E9", 1},
+    {u"easter", 6, u"\x2A6E", 1},
+    {u"ecaron", 6, u"\x011B", 1},
+    {u"ecir", 4, u"\x2256", 1},
+    {u"ecirc", 5, u"\x00EA", 1},
+    {u"ecolon", 6, u"\x2255", 1},
+    {u"ecy", 3, u"\x044D", 1},
+    {u"edot", 4, u"\x0117", 1},
+    {u"ee", 2, u"\x2147", 1},
+    {u"efDot", 5, u"\x2252", 1},
+    {u"efr", 3, u"\xD835\xDD22", 2},
+    {u"eg", 2, u"\x2A9A", 1},
+    {u"egrave", 6, u"\x00E8", 1},
+    {u"egs", 3, u"\x2A96", 1},
+    {u"egsdot", 6, u"\x2A98", 1},
+    {u"el", 2, u"\x2A99", 1},
+    {u"elinters", 8, u"\x23E7", 1},
+    {u"ell", 3, u"\x2113", 1},
+    {u"els", 3, u"\x2A95", 1},
+    {u"elsdot", 6, u"\x2A97", 1},
+    {u"emacr", 5, u"\x0113", 1},
+    {u"empty", 5, u"\x2205", 1},
+    {u"emptyset", 8, u"\x2205", 1},
+    {u"emptyv", 6, u"\x2205", 1},
+    {u"emsp13", 6, u"\x2004", 1},
+    {u"emsp14", 6, u"\x2005", 1},
+    {u"emsp", 4, u"\x2003", 1},
+    {u"eng", 3, u"\x014B", 1},
+    {u"ensp", 4, u"\x2002", 1},
+    {u"eogon", 5, u"\x0119", 1},
+    {u"eopf", 4, u"\xD835\xDD56", 2},
+    {u"epar", 4, u"\x22D5", 1},
+    {u"eparsl", 6, u"\x29E3", 1},
+    {u"eplus", 5, u"\x2A71", 1},
+    {u"epsi", 4, u"\x03B5", 1},
+    {u"epsilon", 7, u"\x03B5", 1},
+    {u"epsiv", 5, u"\x03F5", 1},
+    {u"eqcirc", 6, u"\x2256", 1},
+    {u"eqcolon", 7, u"\x2255", 1},
+    {u"eqsim", 5, u"\x2242", 1},
+    {u"eqslantgtr", 10, u"\x2A96", 1},
+    {u"eqslantless", 11, u"\x2A95", 1},
+    {u"equals", 6, u"\x003D", 1},
+    {u"equest", 6, u"\x225F", 1},
+    {u"equiv", 5, u"\x2261", 1},
+    {u"equivDD", 7, u"\x2A78", 1},
+    {u"eqvparsl", 8, u"\x29E5", 1},
+    {u"erDot", 5, u"\x2253", 1},
+    {u"erarr", 5, u"\x2971", 1},
+    {u"escr", 4, u"\x212F", 1},
+    {u"esdot", 5, u"\x2250", 1},
+    {u"esim", 4, u"\x2242", 1},
+    {u"eta", 3, u"\x03B7", 1},
+    {u"eth", 3, u"\x00F0", 1},
+    {u"euml", 4, u"\x00EB", 1},
+    {u"euro", 4, u"\x20AC", 1},
+    {u"excl", 4, u"\x0021", 1},
+    {u"exist", 5, u"\x2203", 1},
+    {u"expectation", 11, u"\x2130", 1},
+    {u"exponentiale", 12, u"\x2147", 1},
+    {u"fallingdotseq", 13, u"\x2252", 1},
+    {u"fcy", 3, u"\x0444", 1},
+    {u"female", 6, u"\x2640", 1},
+    {u"ffilig", 6, u"\xFB03", 1},
+    {u"fflig", 5, u"\xFB00", 1},
+    {u"ffllig", 6, u"\xFB04", 1},
+    {u"ffr", 3, u"\xD835\xDD23", 2},
+    {u"filig", 5, u"\xFB01", 1},
+    {u"fjlig", 5, u"\x0066\x006A", 2},
+    {u"flat", 4, u"\x266D", 1},
+    {u"fllig", 5, u"\xFB02", 1},
+    {u"fltns", 5, u"\x25B1", 1},
+    {u"fnof", 4, u"\x0192", 1},
+    {u"fopf", 4, u"\xD835\xDD57", 2},
+    {u"forall", 6, u"\x2200", 1},
+    {u"fork", 4, u"\x22D4", 1},
+    {u"forkv", 5, u"\x2AD9", 1},
+    {u"fpartint", 8, u"\x2A0D", 1},
+    {u"frac12", 6, u"\x00BD", 1},
+    {u"frac13", 6, u"\x2153", 1},
+    {u"frac14", 6, u"\x00BC", 1},
+    {u"frac15", 6, u"\x2155", 1},
+    {u"frac16", 6, u"\x2159", 1},
+    {u"frac18", 6, u"\x215B", 1},
+    {u"frac23", 6, u"\x2154", 1},
+    {u"frac25", 6, u"\x2156", 1},
+    {u"frac34", 6, u"\x00BE", 1},
+    {u"frac35", 6, u"\x2157", 1},
+    {u"frac38", 6, u"\x215C", 1},
+    {u"frac45", 6, u"\x2158", 1},
+    {u"frac56", 6, u"\x215A", 1},
+    {u"frac58", 6, u"\x215D", 1},
+    {u"frac78", 6, u"\x215E", 1},
+    {u"frasl", 5, u"\x2044", 1},
+    {u"frown", 5, u"\x2322", 1},
+    {u"fscr", 4, u"\xD835\xDCBB", 2},
+    {u"gE", 2, u"\x2267", 1},
+    {u"gEl", 3, u"\x2A8C", 1},
+    {u"gacute", 6, u"\x01F5", 1},
+    {u"gamma", 5, u"\x03B3", 1},
+    {u"gammad", 6, u"\x03DD", 1},
+    {u"gap", 3, u"\x2A86", 1},
+    {u"gbreve", 6, u"\x011F", 1},
+    {u"gcirc", 5, u"\x011D", 1},
+    {u"gcy", 3, u"\x0433", 1},
+    {u"gdot", 4, u"\x0121", 1},
+    {u"ge", 2, u"\x2265", 1},
+    {u"gel", 3, u"\x22DB", 1},
+    {u"geq", 3, u"\x2265", 1},
+    {u"geqq", 4, u"\x2267", 1},
+    {u"geqslant", 8, u"\x2A7E", 1},
+    {u"ges", 3, u"\x2A7E", 1},
+    {u"gescc", 5, u"\x2AA9", 1},
+    {u"gesdot", 6, u"\x2A80", 1},
+    {u"gesdoto", 7, u"\x2A82", 1},
+    {u"gesdotol", 8, u"\x2A84", 1},
+    {u"gesl", 4, u"\x22DB\xFE00", 2},
+    {u"gesles", 6, u"\x2A94", 1},
+    {u"gfr", 3, u"\xD835\xDD24", 2},
+    {u"gg", 2, u"\x226B", 1},
+    {u"ggg", 3, u"\x22D9", 1},
+    {u"gimel", 5, u"\x2137", 1},
+    {u"gjcy", 4, u"\x0453", 1},
+    {u"gl", 2, u"\x2277", 1},
+    {u"glE", 3, u"\x2A92", 1},
+    {u"gla", 3, u"\x2AA5", 1},
+    {u"glj", 3, u"\x2AA4", 1},
+    {u"gnE", 3, u"\x2269", 1},
+    {u"gnap", 4, u"\x2A8A", 1},
+    {u"gnapprox", 8, u"\x2A8A", 1},
+    {u"gne", 3, u"\x2A88", 1},
+    {u"gneq", 4, u"\x2A88", 1},
+    {u"gneqq", 5, u"\x2269", 1},
+    {u"gnsim", 5, u"\x22E7", 1},
+    {u"gopf", 4, u"\xD835\xDD58", 2},
+    {u"grave", 5, u"\x0060", 1},
+    {u"gscr", 4, u"\x210A", 1},
+    {u"gsim", 4, u"\x2273", 1},
+    {u"gsime", 5, u"\x2A8E", 1},
+    {u"gsiml", 5, u"\x2A90", 1},
+    {u"gt", 2, u"\x003E", 1},
+    {u"gtcc", 4, u"\x2AA7", 1},
+    {u"gtcir", 5, u"\x2A7A", 1},
+    {u"gtdot", 5, u"\x22D7", 1},
+    {u"gtlPar", 6, u"\x2995", 1},
+    {u"gtquest", 7, u"\x2A7C", 1},
+    {u"gtrapprox", 9, u"\x2A86", 1},
+    {u"gtrarr", 6, u"\x2978", 1},
+    {u"gtrdot", 6, u"\x22D7", 1},
+    {u"gtreqless", 9, u"\x22DB", 1},
+    {u"gtreqqless", 10, u"\x2A8C", 1},
+    {u"gtrless", 7, u"\x2277", 1},
+    {u"gtrsim", 6, u"\x2273", 1},
+    {u"gvertneqq", 9, u"\x2269\xFE00", 2},
+    {u"gvnE", 4, u"\x2269\xFE00", 2},
+    {u"hArr", 4, u"\x21D4", 1},
+    {u"hairsp", 6, u"\x200A", 1},
+    {u"half", 4, u"\x00BD", 1},
+    {u"hamilt", 6, u"\x210B", 1},
+    {u"hardcy", 6, u"\x044A", 1},
+    {u"harr", 4, u"\x2194", 1},
+    {u"harrcir", 7, u"\x2948", 1},
+    {u"harrw", 5, u"\x21AD", 1},
+    {u"hbar", 4, u"\x210F", 1},
+    {u"hcirc", 5, u"\x0125", 1},
+    {u"hearts", 6, u"\x2665", 1},
+    {u"heartsuit", 9, u"\x2665", 1},
+    {u"hellip", 6, u"\x2026", 1},
+    {u"hercon", 6, u"\x22B9", 1},
+    {u"hfr", 3, u"\xD835\xDD25", 2},
+    {u"hksearow", 8, u"\x2925", 1},
+    {u"hkswarow", 8, u"\x2926", 1},
+    {u"hoarr", 5, u"\x21FF", 1},
+    {u"homtht", 6, u"\x223B", 1},
+    {u"hookleftarrow", 13, u"\x21A9", 1},
+    {u"hookrightarrow", 14, u"\x21AA", 1},
+    {u"hopf", 4, u"\xD835\xDD59", 2},
+    {u"horbar", 6, u"\x2015", 1},
+    {u"hscr", 4, u"\xD835\xDCBD", 2},
+    {u"hslash", 6, u"\x210F", 1},
+    {u"hstrok", 6, u"\x0127", 1},
+    {u"hybull", 6, u"\x2043", 1},
+    {u"hyphen", 6, u"\x2010", 1},
+    {u"iacute", 6, u"\x00ED", 1},
+    {u"ic", 2, u"\x2063", 1},
+    {u"icirc", 5, u"\x00EE", 1},
+    {u"icy", 3, u"\x0438", 1},
+    {u"iecy", 4, u"\x0435", 1},
+    {u"iexcl", 5, u"\x00A1", 1},
+    {u"iff", 3, u"\x21D4", 1},
+    {u"ifr", 3, u"\xD835\xDD26", 2},
+    {u"igrave", 6, u"\x00EC", 1},
+    {u"ii", 2, u"\x2148", 1},
+    {u"iiiint", 6, u"\x2A0C", 1},
+    {u"iiint", 5, u"\x222D", 1},
+    {u"iinfin", 6, u"\x29DC", 1},
+    {u"iiota", 5, u"\x2129", 1},
+    {u"ijlig", 5, u"\x0133", 1},
+    {u"imacr", 5, u"\x012B", 1},
+    {u"image", 5, u"\x2111", 1},
+    {u"imagline", 8, u"\x2110", 1},
+    {u"imagpart", 8, u"\x2111", 1},
+    {u"imath", 5, u"\x0131", 1},
+    {u"imof", 4, u"\x22B7", 1},
+    {u"imped", 5, u"\x01B5", 1},
+    {u"in", 2, u"\x2208", 1},
+    {u"incare", 6, u"\x2105", 1},
+    {u"infin", 5, u"\x221E", 1},
+    {u"infintie", 8, u"\x29DD", 1},
+    {u"inodot", 6, u"\x0131", 1},
+    {u"int", 3, u"\x222B", 1},
+    {u"intcal", 6, u"\x22BA", 1},
+    {u"integers", 8, u"\x2124", 1},
+    {u"intercal", 8, u"\x22BA", 1},
+    {u"intlarhk", 8, u"\x2A17", 1},
+    {u"intprod", 7, u"\x2A3C", 1},
+    {u"iocy", 4, u"\x0451", 1},
+    {u"iogon", 5, u"\x012F", 1},
+    {u"iopf", 4, u"\xD835\xDD5A", 2},
+    {u"iota", 4, u"\x03B9", 1},
+    {u"iprod", 5, u"\x2A3C", 1},
+    {u"iquest", 6, u"\x00BF", 1},
+    {u"iscr", 4, u"\xD835\xDCBE", 2},
+    {u"isin", 4, u"\x2208", 1},
+    {u"isinE", 5, u"\x22F9", 1},
+    {u"isindot", 7, u"\x22F5", 1},
+    {u"isins", 5, u"\x22F4", 1},
+    {u"isinsv", 6, u"\x22F3", 1},
+    {u"isinv", 5, u"\x2208", 1},
+    {u"it", 2, u"\x2062", 1},
+    {u"itilde", 6, u"\x0129", 1},
+    {u"iukcy", 5, u"\x0456", 1},
+    {u"iuml", 4, u"\x00EF", 1},
+    {u"jcirc", 5, u"\x0135", 1},
+    {u"jcy", 3, u"\x0439", 1},
+    {u"jfr", 3, u"\xD835\xDD27", 2},
+    {u"jmath", 5, u"\x0237", 1},
+    {u"jopf", 4, u"\xD835\xDD5B", 2},
+    {u"jscr", 4, u"\xD835\xDCBF", 2},
+    {u"jsercy", 6, u"\x0458", 1},
+    {u"jukcy", 5, u"\x0454", 1},
+    {u"kappa", 5, u"\x03BA", 1},
+    {u"kappav", 6, u"\x03F0", 1},
+    {u"kcedil", 6, u"\x0137", 1},
+    {u"kcy", 3, u"\x043A", 1},
+    {u"kfr", 3, u"\xD835\xDD28", 2},
+    {u"kgreen", 6, u"\x0138", 1},
+    {u"khcy", 4, u"\x0445", 1},
+    {u"kjcy", 4, u"\x045C", 1},
+    {u"kopf", 4, u"\xD835\xDD5C", 2},
+    {u"kscr", 4, u"\xD835\xDCC0", 2},
+    {u"lAarr", 5, u"\x21DA", 1},
+    {u"lArr", 4, u"\x21D0", 1},
+    {u"lAtail", 6, u"\x291B", 1},
+    {u"lBarr", 5, u"\x290E", 1},
+    {u"lE", 2, u"\x2266", 1},
+    {u"lEg", 3, u"\x2A8B", 1},
+    {u"lHar", 4, u"\x2962", 1},
+    {u"lacute", 6, u"\x013A", 1},
+    {u"laemptyv", 8, u"\x29B4", 1},
+    {u"lagran", 6, u"\x2112", 1},
+    {u"lambda", 6, u"\x03BB", 1},
+    {u"lang", 4, u"\x27E8", 1},
+    {u"langd", 5, u"\x2991", 1},
+    {u"langle", 6, u"\x27E8", 1},
+    {u"lap", 3, u"\x2A85", 1},
+    {u"laquo", 5, u"\x00AB", 1},
+    {u"larr", 4, u"\x2190", 1},
+    {u"larrb", 5, u"\x21E4", 1},
+    {u"larrbfs", 7, u"\x291F", 1},
+    {u"larrfs", 6, u"\x291D", 1},
+    {u"larrhk", 6, u"\x21A9", 1},
+    {u"larrlp", 6, u"\x21AB", 1},
+    {u"larrpl", 6, u"\x2939", 1},
+    {u"larrsim", 7, u"\x2973", 1},
+    {u"larrtl", 6, u"\x21A2", 1},
+    {u"lat", 3, u"\x2AAB", 1},
+    {u"latail", 6, u"\x2919", 1},
+    {u"late", 4, u"\x2AAD", 1},
+    {u"lates", 5, u"\x2AAD\xFE00", 2},
+    {u"lbarr", 5, u"\x290C", 1},
+    {u"lbbrk", 5, u"\x2772", 1},
+    {u"lbrace", 6, u"\x007B", 1},
+    {u"lbrack", 6, u"\x005B", 1},
+    {u"lbrke", 5, u"\x298B", 1},
+    {u"lbrksld", 7, u"\x298F", 1},
+    {u"lbrkslu", 7, u"\x298D", 1},
+    {u"lcaron", 6, u"\x013E", 1},
+    {u"lcedil", 6, u"\x013C", 1},
+    {u"lceil", 5, u"\x2308", 1},
+    {u"lcub", 4, u"\x007B", 1},
+    {u"lcy", 3, u"\x043B", 1},
+    {u"ldca", 4, u"\x2936", 1},
+    {u"ldquo", 5, u"\x201C", 1},
+    {u"ldquor", 6, u"\x201E", 1},
+    {u"ldrdhar", 7, u"\x2967", 1},
+    {u"ldrushar", 8, u"\x294B", 1},
+    {u"ldsh", 4, u"\x21B2", 1},
+    {u"le", 2, u"\x2264", 1},
+    {u"leftarrow", 9, u"\x2190", 1},
+    {u"leftarrowtail", 13, u"\x21A2", 1},
+    {u"leftharpoondown", 15, u"\x21BD", 1},
+    {u"leftharpoonup", 13, u"\x21BC", 1},
+    {u"leftleftarrows", 14, u"\x21C7", 1},
+    {u"leftrightarrow", 14, u"\x2194", 1},
+    {u"leftrightarrows", 15, u"\x21C6", 1},
+    {u"leftrightharpoons", 17, u"\x21CB", 1},
+    {u"leftrightsquigarrow", 19, u"\x21AD", 1},
+    {u"leftthreetimes", 14, u"\x22CB", 1},
+    {u"leg", 3, u"\x22DA", 1},
+    {u"leq", 3, u"\x2264", 1},
+    {u"leqq", 4, u"\x2266", 1},
+    {u"leqslant", 8, u"\x2A7D", 1},
+    {u"les", 3, u"\x2A7D", 1},
+    {u"lescc", 5, u"\x2AA8", 1},
+    {u"lesdot", 6, u"\x2A7F", 1},
+    {u"lesdoto", 7, u"\x2A81", 1},
+    {u"lesdotor", 8, u"\x2A83", 1},
+    {u"lesg", 4, u"\x22DA\xFE00", 2},
+    {u"lesges", 6, u"\x2A93", 1},
+    {u"lessapprox", 10, u"\x2A85", 1},
+    {u"lessdot", 7, u"\x22D6", 1},
+    {u"lesseqgtr", 9, u"\x22DA", 1},
+    {u"lesseqqgtr", 10, u"\x2A8B", 1},
+    {u"lessgtr", 7, u"\x2276", 1},
+    {u"lesssim", 7, u"\x2272", 1},
+    {u"lfisht", 6, u"\x297C", 1},
+    {u"lfloor", 6, u"\x230A", 1},
+    {u"lfr", 3, u"\xD835\xDD29", 2},
+    {u"lg", 2, u"\x2276", 1},
+    {u"lgE", 3, u"\x2A91", 1},
+    {u"lhard", 5, u"\x21BD", 1},
+    {u"lharu", 5, u"\x21BC", 1},
+    {u"lharul", 6, u"\x296A", 1},
+    {u"lhblk", 5, u"\x2584", 1},
+    {u"ljcy", 4, u"\x0459", 1},
+    {u"ll", 2, u"\x226A", 1},
+    {u"llarr", 5, u"\x21C7", 1},
+    {u"llcorner", 8, u"\x231E", 1},
+    {u"llhard", 6, u"\x296B", 1},
+    {u"lltri", 5, u"\x25FA", 1},
+    {u"lmidot", 6, u"\x0140", 1},
+    {u"lmoust", 6, u"\x23B0", 1},
+    {u"lmoustache", 10, u"\x23B0", 1},
+    {u"lnE", 3, u"\x2268", 1},
+    {u"lnap", 4, u"\x2A89", 1},
+    {u"lnapprox", 8, u"\x2A89", 1},
+    {u"lne", 3, u"\x2A87", 1},
+    {u"lneq", 4, u"\x2A87", 1},
+    {u"lneqq", 5, u"\x2268", 1},
+    {u"lnsim", 5, u"\x22E6", 1},
+    {u"loang", 5, u"\x27EC", 1},
+    {u"loarr", 5, u"\x21FD", 1},
+    {u"lobrk", 5, u"\x27E6", 1},
+    {u"longleftarrow", 13, u"\x27F5", 1},
+    {u"longleftrightarrow", 18, u"\x27F7", 1},
+    {u"longmapsto", 10, u"\x27FC", 1},
+    {u"longrightarrow", 14, u"\x27F6", 1},
+    {u"looparrowleft", 13, u"\x21AB", 1},
+    {u"looparrowright", 14, u"\x21AC", 1},
+    {u"lopar", 5, u"\x2985", 1},
+    {u"lopf", 4, u"\xD835\xDD5D", 2},
+    {u"loplus", 6, u"\x2A2D", 1},
+    {u"lotimes", 7, u"\x2A34", 1},
+    {u"lowast", 6, u"\x2217", 1},
+    {u"lowbar", 6, u"\x005F", 1},
+    {u"loz", 3, u"\x25CA", 1},
+    {u"lozenge", 7, u"\x25CA", 1},
+    {u"lozf", 4, u"\x29EB", 1},
+    {u"lpar", 4, u"\x0028", 1},
+    {u"lparlt", 6, u"\x2993", 1},
+    {u"lrarr", 5, u"\x21C6", 1},
+    {u"lrcorner", 8, u"\x231F", 1},
+    {u"lrhar", 5, u"\x21CB", 1},
+    {u"lrhard", 6, u"\x296D", 1},
+    {u"lrm", 3, u"\x200E", 1},
+    {u"lrtri", 5, u"\x22BF", 1},
+    {u"lsaquo", 6, u"\x2039", 1},
+    {u"lscr", 4, u"\xD835\xDCC1", 2},
+    {u"lsh", 3, u"\x21B0", 1},
+    {u"lsim", 4, u"\x2272", 1},
+    {u"lsime", 5, u"\x2A8D", 1},
+    {u"lsimg", 5, u"\x2A8F", 1},
+    {u"lsqb", 4, u"\x005B", 1},
+    {u"lsquo", 5, u"\x2018", 1},
+    {u"lsquor", 6, u"\x201A", 1},
+    {u"lstrok", 6, u"\x0142", 1},
+    {u"lt", 2, u"\x003C", 1},
+    {u"ltcc", 4, u"\x2AA6", 1},
+    {u"ltcir", 5, u"\x2A79", 1},
+    {u"ltdot", 5, u"\x22D6", 1},
+    {u"lthree", 6, u"\x22CB", 1},
+    {u"ltimes", 6, u"\x22C9", 1},
+    {u"ltlarr", 6, u"\x2976", 1},
+    {u"ltquest", 7, u"\x2A7B", 1},
+    {u"ltrPar", 6, u"\x2996", 1},
+    {u"ltri", 4, u"\x25C3", 1},
+    {u"ltrie", 5, u"\x22B4", 1},
+    {u"ltrif", 5, u"\x25C2", 1},
+    {u"lurdshar", 8, u"\x294A", 1},
+    {u"luruhar", 7, u"\x2966", 1},
+    {u"lvertneqq", 9, u"\x2268\xFE00", 2},
+    {u"lvnE", 4, u"\x2268\xFE00", 2},
+    {u"mDDot", 5, u"\x223A", 1},
+    {u"macr", 4, u"\x00AF", 1},
+    {u"male", 4, u"\x2642", 1},
+    {u"malt", 4, u"\x2720", 1},
+    {u"maltese", 7, u"\x2720", 1},
+    {u"map", 3, u"\x21A6", 1},
+    {u"mapsto", 6, u"\x21A6", 1},
+    {u"mapstodown", 10, u"\x21A7", 1},
+    {u"mapstoleft", 10, u"\x21A4", 1},
+    {u"mapstoup", 8, u"\x21A5", 1},
+    {u"marker", 6, u"\x25AE", 1},
+    {u"mcomma", 6, u"\x2A29", 1},
+    {u"mcy", 3, u"\x043C", 1},
+    {u"mdash", 5, u"\x2014", 1},
+    {u"measuredangle", 13, u"\x2221", 1},
+    {u"mfr", 3, u"\xD835\xDD2A", 2},
+    {u"mho", 3, u"\x2127", 1},
+    {u"micro", 5, u"\x00B5", 1},
+    {u"mid", 3, u"\x2223", 1},
+    {u"midast", 6, u"\x002A", 1},
+    {u"midcir", 6, u"\x2AF0", 1},
+    {u"middot", 6, u"\x00B7", 1},
+    {u"minus", 5, u"\x2212", 1},
+    {u"minusb", 6, u"\x229F", 1},
+    {u"minusd", 6, u"\x2238", 1},
+    {u"minusdu", 7, u"\x2A2A", 1},
+    {u"mlcp", 4, u"\x2ADB", 1},
+    {u"mldr", 4, u"\x2026", 1},
+    {u"mnplus", 6, u"\x2213", 1},
+    {u"models", 6, u"\x22A7", 1},
+    {u"mopf", 4, u"\xD835\xDD5E", 2},
+    {u"mp", 2, u"\x2213", 1},
+    {u"mscr", 4, u"\xD835\xDCC2", 2},
+    {u"mstpos", 6, u"\x223E", 1},
+    {u"mu", 2, u"\x03BC", 1},
+    {u"multimap", 8, u"\x22B8", 1},
+    {u"mumap", 5, u"\x22B8", 1},
+    {u"nGg", 3, u"\x22D9\x0338", 2},
+    {u"nGt", 3, u"\x226B\x20D2", 2},
+    {u"nGtv", 4, u"\x226B\x0338", 2},
+    {u"nLeftarrow", 10, u"\x21CD", 1},
+    {u"nLeftrightarrow", 15, u"\x21CE", 1},
+    {u"nLl", 3, u"\x22D8\x0338", 2},
+    {u"nLt", 3, u"\x226A\x20D2", 2},
+    {u"nLtv", 4, u"\x226A\x0338", 2},
+    {u"nRightarrow", 11, u"\x21CF", 1},
+    {u"nVDash", 6, u"\x22AF", 1},
+    {u"nVdash", 6, u"\x22AE", 1},
+    {u"nabla", 5, u"\x2207", 1},
+    {u"nacute", 6, u"\x0144", 1},
+    {u"nang", 4, u"\x2220\x20D2", 2},
+    {u"nap", 3, u"\x2249", 1},
+    {u"napE", 4, u"\x2A70\x0338", 2},
+    {u"napid", 5, u"\x224B\x0338", 2},
+    {u"napos", 5, u"\x0149", 1},
+    {u"napprox", 7, u"\x2249", 1},
+    {u"natur", 5, u"\x266E", 1},
+    {u"natural", 7, u"\x266E", 1},
+    {u"naturals", 8, u"\x2115", 1},
+    {u"nbsp", 4, u"\x00A0", 1},
+    {u"nbump", 5, u"\x224E\x0338", 2},
+    {u"nbumpe", 6, u"\x224F\x0338", 2},
+    {u"ncap", 4, u"\x2A43", 1},
+    {u"ncaron", 6, u"\x0148", 1},
+    {u"ncedil", 6, u"\x0146", 1},
+    {u"ncong", 5, u"\x2247", 1},
+    {u"ncongdot", 8, u"\x2A6D\x0338", 2},
+    {u"ncup", 4, u"\x2A42", 1},
+    {u"ncy", 3, u"\x043D", 1},
+    {u"ndash", 5, u"\x2013", 1},
+    {u"ne", 2, u"\x2260", 1},
+    {u"neArr", 5, u"\x21D7", 1},
+    {u"nearhk", 6, u"\x2924", 1},
+    {u"nearr", 5, u"\x2197", 1},
+    {u"nearrow", 7, u"\x2197", 1},
+    {u"nedot", 5, u"\x2250\x0338", 2},
+    {u"nequiv", 6, u"\x2262", 1},
+    {u"nesear", 6, u"\x2928", 1},
+    {u"nesim", 5, u"\x2242\x0338", 2},
+    {u"nexist", 6, u"\x2204", 1},
+    {u"nexists", 7, u"\x2204", 1},
+    {u"nfr", 3, u"\xD835\xDD2B", 2},
+    {u"ngE", 3, u"\x2267\x0338", 2},
+    {u"nge", 3, u"\x2271", 1},
+    {u"ngeq", 4, u"\x2271", 1},
+    {u"ngeqq", 5, u"\x2267\x0338", 2},
+    {u"ngeqslant", 9, u"\x2A7E\x0338", 2},
+    {u"nges", 4, u"\x2A7E\x0338", 2},
+    {u"ngsim", 5, u"\x2275", 1},
+    {u"ngt", 3, u"\x226F", 1},
+    {u"ngtr", 4, u"\x226F", 1},
+    {u"nhArr", 5, u"\x21CE", 1},
+    {u"nharr", 5, u"\x21AE", 1},
+    {u"nhpar", 5, u"\x2AF2", 1},
+    {u"ni", 2, u"\x220B", 1},
+    {u"nis", 3, u"\x22FC", 1},
+    {u"nisd", 4, u"\x22FA", 1},
+    {u"niv", 3, u"\x220B", 1},
+    {u"njcy", 4, u"\x045A", 1},
+    {u"nlArr", 5, u"\x21CD", 1},
+    {u"nlE", 3, u"\x2266\x0338", 2},
+    {u"nlarr", 5, u"\x219A", 1},
+    {u"nldr", 4, u"\x2025", 1},
+    {u"nle", 3, u"\x2270", 1},
+    {u"nleftarrow", 10, u"\x219A", 1},
+    {u"nleftrightarrow", 15, u"\x21AE", 1},
+    {u"nleq", 4, u"\x2270", 1},
+    {u"nleqq", 5, u"\x2266\x0338", 2},
+    {u"nleqslant", 9, u"\x2A7D\x0338", 2},
+    {u"nles", 4, u"\x2A7D\x0338", 2},
+    {u"nless", 5, u"\x226E", 1},
+    {u"nlsim", 5, u"\x2274", 1},
+    {u"nlt", 3, u"\x226E", 1},
+    {u"nltri", 5, u"\x22EA", 1},
+    {u"nltrie", 6, u"\x22EC", 1},
+    {u"nmid", 4, u"\x2224", 1},
+    {u"nopf", 4, u"\xD835\xDD5F", 2},
+    {u"not", 3, u"\x00AC", 1},
+    {u"notin", 5, u"\x2209", 1},
+    {u"notinE", 6, u"\x22F9\x0338", 2},
+    {u"notindot", 8, u"\x22F5\x0338", 2},
+    {u"notinva", 7, u"\x2209", 1},
+    {u"notinvb", 7, u"\x22F7", 1},
+    {u"notinvc", 7, u"\x22F6", 1},
+    {u"notni", 5, u"\x220C", 1},
+    {u"notniva", 7, u"\x220C", 1},
+    {u"notnivb", 7, u"\x22FE", 1},
+    {u"notnivc", 7, u"\x22FD", 1},
+    {u"npar", 4, u"\x2226", 1},
+    {u"nparallel", 9, u"\x2226", 1},
+    {u"nparsl", 6, u"\x2AFD\x20E5", 2},
+    {u"npart", 5, u"\x2202\x0338", 2},
+    {u"npolint", 7, u"\x2A14", 1},
+    {u"npr", 3, u"\x2280", 1},
+    {u"nprcue", 6, u"\x22E0", 1},
+    {u"npre", 4, u"\x2AAF\x0338", 2},
+    {u"nprec", 5, u"\x2280", 1},
+    {u"npreceq", 7, u"\x2AAF\x0338", 2},
+    {u"nrArr", 5, u"\x21CF", 1},
+    {u"nrarr", 5, u"\x219B", 1},
+    {u"nrarrc", 6, u"\x2933\x0338", 2},
+    {u"nrarrw", 6, u"\x219D\x0338", 2},
+    {u"nrightarrow", 11, u"\x219B", 1},
+    {u"nrtri", 5, u"\x22EB", 1},
+    {u"nrtrie", 6, u"\x22ED", 1},
+    {u"nsc", 3, u"\x2281", 1},
+    {u"nsccue", 6, u"\x22E1", 1},
+    {u"nsce", 4, u"\x2AB0\x0338", 2},
+    {u"nscr", 4, u"\xD835\xDCC3", 2},
+    {u"nshortmid", 9, u"\x2224", 1},
+    {u"nshortparallel", 14, u"\x2226", 1},
+    {u"nsim", 4, u"\x2241", 1},
+    {u"nsime", 5, u"\x2244", 1},
+    {u"nsimeq", 6, u"\x2244", 1},
+    {u"nsmid", 5, u"\x2224", 1},
+    {u"nspar", 5, u"\x2226", 1},
+    {u"nsqsube", 7, u"\x22E2", 1},
+    {u"nsqsupe", 7, u"\x22E3", 1},
+    {u"nsub", 4, u"\x2284", 1},
+    {u"nsubE", 5, u"\x2AC5\x0338", 2},
+    {u"nsube", 5, u"\x2288", 1},
+    {u"nsubset", 7, u"\x2282\x20D2", 2},
+    {u"nsubseteq", 9, u"\x2288", 1},
+    {u"nsubseteqq", 10, u"\x2AC5\x0338", 2},
+    {u"nsucc", 5, u"\x2281", 1},
+    {u"nsucceq", 7, u"\x2AB0\x0338", 2},
+    {u"nsup", 4, u"\x2285", 1},
+    {u"nsupE", 5, u"\x2AC6\x0338", 2},
+    {u"nsupe", 5, u"\x2289", 1},
+    {u"nsupset", 7, u"\x2283\x20D2", 2},
+    {u"nsupseteq", 9, u"\x2289", 1},
+    {u"nsupseteqq", 10, u"\x2AC6\x0338", 2},
+    {u"ntgl", 4, u"\x2279", 1},
+    {u"ntilde", 6, u"\x00F1", 1},
+    {u"ntlg", 4, u"\x2278", 1},
+    {u"ntriangleleft", 13, u"\x22EA", 1},
+    {u"ntrianglelefteq", 15, u"\x22EC", 1},
+    {u"ntriangleright", 14, u"\x22EB", 1},
+    {u"ntrianglerighteq", 16, u"\x22ED", 1},
+    {u"nu", 2, u"\x03BD", 1},
+    {u"num", 3, u"\x0023", 1},
+    {u"numero", 6, u"\x2116", 1},
+    {u"numsp", 5, u"\x2007", 1},
+    {u"nvDash", 6, u"\x22AD", 1},
+    {u"nvHarr", 6, u"\x2904", 1},
+    {u"nvap", 4, u"\x224D\x20D2", 2},
+    {u"nvdash", 6, u"\x22AC", 1},
+    {u"nvge", 4, u"\x2265\x20D2", 2},
+    {u"nvgt", 4, u"\x003E\x20D2", 2},
+    {u"nvinfin", 7, u"\x29DE", 1},
+    {u"nvlArr", 6, u"\x2902", 1},
+    {u"nvle", 4, u"\x2264\x20D2", 2},
+    {u"nvlt", 4, u"\x003C\x20D2", 2},
+    {u"nvltrie", 7, u"\x22B4\x20D2", 2},
+    {u"nvrArr", 6, u"\x2903", 1},
+    {u"nvrtrie", 7, u"\x22B5\x20D2", 2},
+    {u"nvsim", 5, u"\x223C\x20D2", 2},
+    {u"nwArr", 5, u"\x21D6", 1},
+    {u"nwarhk", 6, u"\x2923", 1},
+    {u"nwarr", 5, u"\x2196", 1},
+    {u"nwarrow", 7, u"\x2196", 1},
+    {u"nwnear", 6, u"\x2927", 1},
+    {u"oS", 2, u"\x24C8", 1},
+    {u"oacute", 6, u"\x00F3", 1},
+    {u"oast", 4, u"\x229B", 1},
+    {u"ocir", 4, u"\x229A", 1},
+    {u"ocirc", 5, u"\x00F4", 1},
+    {u"ocy", 3, u"\x043E", 1},
+    {u"odash", 5, u"\x229D", 1},
+    {u"odblac", 6, u"\x0151", 1},
+    {u"odiv", 4, u"\x2A38", 1},
+    {u"odot", 4, u"\x2299", 1},
+    {u"odsold", 6, u"\x29BC", 1},
+    {u"oelig", 5, u"\x0153", 1},
+    {u"ofcir", 5, u"\x29BF", 1},
+    {u"ofr", 3, u"\xD835\xDD2C", 2},
+    {u"ogon", 4, u"\x02DB", 1},
+    {u"ograve", 6, u"\x00F2", 1},
+    {u"ogt", 3, u"\x29C1", 1},
+    {u"ohbar", 5, u"\x29B5", 1},
+    {u"ohm", 3, u"\x03A9", 1},
+    {u"oint", 4, u"\x222E", 1},
+    {u"olarr", 5, u"\x21BA", 1},
+    {u"olcir", 5, u"\x29BE", 1},
+    {u"olcross", 7, u"\x29BB", 1},
+    {u"oline", 5, u"\x203E", 1},
+    {u"olt", 3, u"\x29C0", 1},
+    {u"omacr", 5, u"\x014D", 1},
+    {u"omega", 5, u"\x03C9", 1},
+    {u"omicron", 7, u"\x03BF", 1},
+    {u"omid", 4, u"\x29B6", 1},
+    {u"ominus", 6, u"\x2296", 1},
+    {u"oopf", 4, u"\xD835\xDD60", 2},
+    {u"opar", 4, u"\x29B7", 1},
+    {u"operp", 5, u"\x29B9", 1},
+    {u"oplus", 5, u"\x2295", 1},
+    {u"or", 2, u"\x2228", 1},
+    {u"orarr", 5, u"\x21BB", 1},
+    {u"ord", 3, u"\x2A5D", 1},
+    {u"order", 5, u"\x2134", 1},
+    {u"orderof", 7, u"\x2134", 1},
+    {u"ordf", 4, u"\x00AA", 1},
+    {u"ordm", 4, u"\x00BA", 1},
+    {u"origof", 6, u"\x22B6", 1},
+    {u"oror", 4, u"\x2A56", 1},
+    {u"orslope", 7, u"\x2A57", 1},
+    {u"orv", 3, u"\x2A5B", 1},
+    {u"oscr", 4, u"\x2134", 1},
+    {u"oslash", 6, u"\x00F8", 1},
+    {u"osol", 4, u"\x2298", 1},
+    {u"otilde", 6, u"\x00F5", 1},
+    {u"otimes", 6, u"\x2297", 1},
+    {u"otimesas", 8, u"\x2A36", 1},
+    {u"ouml", 4, u"\x00F6", 1},
+    {u"ovbar", 5, u"\x233D", 1},
+    {u"par", 3, u"\x2225", 1},
+    {u"para", 4, u"\x00B6", 1},
+    {u"parallel", 8, u"\x2225", 1},
+    {u"parsim", 6, u"\x2AF3", 1},
+    {u"parsl", 5, u"\x2AFD", 1},
+    {u"part", 4, u"\x2202", 1},
+    {u"pcy", 3, u"\x043F", 1},
+    {u"percnt", 6, u"\x0025", 1},
+    {u"period", 6, u"\x002E", 1},
+    {u"permil", 6, u"\x2030", 1},
+    {u"perp", 4, u"\x22A5", 1},
+    {u"pertenk", 7, u"\x2031", 1},
+    {u"pfr", 3, u"\xD835\xDD2D", 2},
+    {u"phi", 3, u"\x03C6", 1},
+    {u"phiv", 4, u"\x03D5", 1},
+    {u"phmmat", 6, u"\x2133", 1},
+    {u"phone", 5, u"\x260E", 1},
+    {u"pi", 2, u"\x03C0", 1},
+    {u"pitchfork", 9, u"\x22D4", 1},
+    {u"piv", 3, u"\x03D6", 1},
+    {u"planck", 6, u"\x210F", 1},
+    {u"planckh", 7, u"\x210E", 1},
+    {u"plankv", 6, u"\x210F", 1},
+    {u"plus", 4, u"\x002B", 1},
+    {u"plusacir", 8, u"\x2A23", 1},
+    {u"plusb", 5, u"\x229E", 1},
+    {u"pluscir", 7, u"\x2A22", 1},
+    {u"plusdo", 6, u"\x2214", 1},
+    {u"plusdu", 6, u"\x2A25", 1},
+    {u"pluse", 5, u"\x2A72", 1},
+    {u"plusmn", 6, u"\x00B1", 1},
+    {u"plussim", 7, u"\x2A26", 1},
+    {u"plustwo", 7, u"\x2A27", 1},
+    {u"pm", 2, u"\x00B1", 1},
+    {u"pointint", 8, u"\x2A15", 1},
+    {u"popf", 4, u"\xD835\xDD61", 2},
+    {u"pound", 5, u"\x00A3", 1},
+    {u"pr", 2, u"\x227A", 1},
+    {u"prE", 3, u"\x2AB3", 1},
+    {u"prap", 4, u"\x2AB7", 1},
+    {u"prcue", 5, u"\x227C", 1},
+    {u"pre", 3, u"\x2AAF", 1},
+    {u"prec", 4, u"\x227A", 1},
+    {u"precapprox", 10, u"\x2AB7", 1},
+    {u"preccurlyeq", 11, u"\x227C", 1},
+    {u"preceq", 6, u"\x2AAF", 1},
+    {u"precnapprox", 11, u"\x2AB9", 1},
+    {u"precneqq", 8, u"\x2AB5", 1},
+    {u"precnsim", 8, u"\x22E8", 1},
+    {u"precsim", 7, u"\x227E", 1},
+    {u"prime", 5, u"\x2032", 1},
+    {u"primes", 6, u"\x2119", 1},
+    {u"prnE", 4, u"\x2AB5", 1},
+    {u"prnap", 5, u"\x2AB9", 1},
+    {u"prnsim", 6, u"\x22E8", 1},
+    {u"prod", 4, u"\x220F", 1},
+    {u"profalar", 8, u"\x232E", 1},
+    {u"profline", 8, u"\x2312", 1},
+    {u"profsurf", 8, u"\x2313", 1},
+    {u"prop", 4, u"\x221D", 1},
+    {u"propto", 6, u"\x221D", 1},
+    {u"prsim", 5, u"\x227E", 1},
+    {u"prurel", 6, u"\x22B0", 1},
+    {u"pscr", 4, u"\xD835\xDCC5", 2},
+    {u"psi", 3, u"\x03C8", 1},
+    {u"puncsp", 6, u"\x2008", 1},
+    {u"qfr", 3, u"\xD835\xDD2E", 2},
+    {u"qint", 4, u"\x2A0C", 1},
+    {u"qopf", 4, u"\xD835\xDD62", 2},
+    {u"qprime", 6, u"\x2057", 1},
+    {u"qscr", 4, u"\xD835\xDCC6", 2},
+    {u"quaternions", 11, u"\x210D", 1},
+    {u"quatint", 7, u"\x2A16", 1},
+    {u"quest", 5, u"\x003F", 1},
+    {u"questeq", 7, u"\x225F", 1},
+    {u"quot", 4, u"\x0022", 1},
+    {u"rAarr", 5, u"\x21DB", 1},
+    {u"rArr", 4, u"\x21D2", 1},
+    {u"rAtail", 6, u"\x291C", 1},
+    {u"rBarr", 5, u"\x290F", 1},
+    {u"rHar", 4, u"\x2964", 1},
+    {u"race", 4, u"\x223D\x0331", 2},
+    {u"racute", 6, u"\x0155", 1},
+    {u"radic", 5, u"\x221A", 1},
+    {u"raemptyv", 8, u"\x29B3", 1},
+    {u"rang", 4, u"\x27E9", 1},
+    {u"rangd", 5, u"\x2992", 1},
+    {u"range", 5, u"\x29A5", 1},
+    {u"rangle", 6, u"\x27E9", 1},
+    {u"raquo", 5, u"\x00BB", 1},
+    {u"rarr", 4, u"\x2192", 1},
+    {u"rarrap", 6, u"\x2975", 1},
+    {u"rarrb", 5, u"\x21E5", 1},
+    {u"rarrbfs", 7, u"\x2920", 1},
+    {u"rarrc", 5, u"\x2933", 1},
+    {u"rarrfs", 6, u"\x291E", 1},
+    {u"rarrhk", 6, u"\x21AA", 1},
+    {u"rarrlp", 6, u"\x21AC", 1},
+    {u"rarrpl", 6, u"\x2945", 1},
+    {u"rarrsim", 7, u"\x2974", 1},
+    {u"rarrtl", 6, u"\x21A3", 1},
+    {u"rarrw", 5, u"\x219D", 1},
+    {u"ratail", 6, u"\x291A", 1},
+    {u"ratio", 5, u"\x2236", 1},
+    {u"rationals", 9, u"\x211A", 1},
+    {u"rbarr", 5, u"\x290D", 1},
+    {u"rbbrk", 5, u"\x2773", 1},
+    {u"rbrace", 6, u"\x007D", 1},
+    {u"rbrack", 6, u"\x005D", 1},
+    {u"rbrke", 5, u"\x298C", 1},
+    {u"rbrksld", 7, u"\x298E", 1},
+    {u"rbrkslu", 7, u"\x2990", 1},
+    {u"rcaron", 6, u"\x0159", 1},
+    {u"rcedil", 6, u"\x0157", 1},
+    {u"rceil", 5, u"\x2309", 1},
+    {u"rcub", 4, u"\x007D", 1},
+    {u"rcy", 3, u"\x0440", 1},
+    {u"rdca", 4, u"\x2937", 1},
+    {u"rdldhar", 7, u"\x2969", 1},
+    {u"rdquo", 5, u"\x201D", 1},
+    {u"rdquor", 6, u"\x201D", 1},
+    {u"rdsh", 4, u"\x21B3", 1},
+    {u"real", 4, u"\x211C", 1},
+    {u"realine", 7, u"\x211B", 1},
+    {u"realpart", 8, u"\x211C", 1},
+    {u"reals", 5, u"\x211D", 1},
+    {u"rect", 4, u"\x25AD", 1},
+    {u"reg", 3, u"\x00AE", 1},
+    {u"rfisht", 6, u"\x297D", 1},
+    {u"rfloor", 6, u"\x230B", 1},
+    {u"rfr", 3, u"\xD835\xDD2F", 2},
+    {u"rhard", 5, u"\x21C1", 1},
+    {u"rharu", 5, u"\x21C0", 1},
+    {u"rharul", 6, u"\x296C", 1},
+    {u"rho", 3, u"\x03C1", 1},
+    {u"rhov", 4, u"\x03F1", 1},
+    {u"rightarrow", 10, u"\x2192", 1},
+    {u"rightarrowtail", 14, u"\x21A3", 1},
+    {u"rightharpoondown", 16, u"\x21C1", 1},
+    {u"rightharpoonup", 14, u"\x21C0", 1},
+    {u"rightleftarrows", 15, u"\x21C4", 1},
+    {u"rightleftharpoons", 17, u"\x21CC", 1},
+    {u"rightrightarrows", 16, u"\x21C9", 1},
+    {u"rightsquigarrow", 15, u"\x219D", 1},
+    {u"rightthreetimes", 15, u"\x22CC", 1},
+    {u"ring", 4, u"\x02DA", 1},
+    {u"risingdotseq", 12, u"\x2253", 1},
+    {u"rlarr", 5, u"\x21C4", 1},
+    {u"rlhar", 5, u"\x21CC", 1},
+    {u"rlm", 3, u"\x200F", 1},
+    {u"rmoust", 6, u"\x23B1", 1},
+    {u"rmoustache", 10, u"\x23B1", 1},
+    {u"rnmid", 5, u"\x2AEE", 1},
+    {u"roang", 5, u"\x27ED", 1},
+    {u"roarr", 5, u"\x21FE", 1},
+    {u"robrk", 5, u"\x27E7", 1},
+    {u"ropar", 5, u"\x2986", 1},
+    {u"ropf", 4, u"\xD835\xDD63", 2},
+    {u"roplus", 6, u"\x2A2E", 1},
+    {u"rotimes", 7, u"\x2A35", 1},
+    {u"rpar", 4, u"\x0029", 1},
+    {u"rpargt", 6, u"\x2994", 1},
+    {u"rppolint", 8, u"\x2A12", 1},
+    {u"rrarr", 5, u"\x21C9", 1},
+    {u"rsaquo", 6, u"\x203A", 1},
+    {u"rscr", 4, u"\xD835\xDCC7", 2},
+    {u"rsh", 3, u"\x21B1", 1},
+    {u"rsqb", 4, u"\x005D", 1},
+    {u"rsquo", 5, u"\x2019", 1},
+    {u"rsquor", 6, u"\x2019", 1},
+    {u"rthree", 6, u"\x22CC", 1},
+    {u"rtimes", 6, u"\x22CA", 1},
+    {u"rtri", 4, u"\x25B9", 1},
+    {u"rtrie", 5, u"\x22B5", 1},
+    {u"rtrif", 5, u"\x25B8", 1},
+    {u"rtriltri", 8, u"\x29CE", 1},
+    {u"ruluhar", 7, u"\x2968", 1},
+    {u"rx", 2, u"\x211E", 1},
+    {u"sacute", 6, u"\x015B", 1},
+    {u"sbquo", 5, u"\x201A", 1},
+    {u"sc", 2, u"\x227B", 1},
+    {u"scE", 3, u"\x2AB4", 1},
+    {u"scap", 4, u"\x2AB8", 1},
+    {u"scaron", 6, u"\x0161", 1},
+    {u"sccue", 5, u"\x227D", 1},
+    {u"sce", 3, u"\x2AB0", 1},
+    {u"scedil", 6, u"\x015F", 1},
+    {u"scirc", 5, u"\x015D", 1},
+    {u"scnE", 4, u"\x2AB6", 1},
+    {u"scnap", 5, u"\x2ABA", 1},
+    {u"scnsim", 6, u"\x22E9", 1},
+    {u"scpolint", 8, u"\x2A13", 1},
+    {u"scsim", 5, u"\x227F", 1},
+    {u"scy", 3, u"\x0441", 1},
+    {u"sdot", 4, u"\x22C5", 1},
+    {u"sdotb", 5, u"\x22A1", 1},
+    {u"sdote", 5, u"\x2A66", 1},
+    {u"seArr", 5, u"\x21D8", 1},
+    {u"searhk", 6, u"\x2925", 1},
+    {u"searr", 5, u"\x2198", 1},
+    {u"searrow", 7, u"\x2198", 1},
+    {u"sect", 4, u"\x00A7", 1},
+    {u"semi", 4, u"\x003B", 1},
+    {u"seswar", 6, u"\x2929", 1},
+    {u"setminus", 8, u"\x2216", 1},
+    {u"setmn", 5, u"\x2216", 1},
+    {u"sext", 4, u"\x2736", 1},
+    {u"sfr", 3, u"\xD835\xDD30", 2},
+    {u"sfrown", 6, u"\x2322", 1},
+    {u"sharp", 5, u"\x266F", 1},
+    {u"shchcy", 6, u"\x0449", 1},
+    {u"shcy", 4, u"\x0448", 1},
+    {u"shortmid", 8, u"\x2223", 1},
+    {u"shortparallel", 13, u"\x2225", 1},
+    {u"shy", 3, u"\x00AD", 1},
+    {u"sigma", 5, u"\x03C3", 1},
+    {u"sigmaf", 6, u"\x03C2", 1},
+    {u"sigmav", 6, u"\x03C2", 1},
+    {u"sim", 3, u"\x223C", 1},
+    {u"simdot", 6, u"\x2A6A", 1},
+    {u"sime", 4, u"\x2243", 1},
+    {u"simeq", 5, u"\x2243", 1},
+    {u"simg", 4, u"\x2A9E", 1},
+    {u"simgE", 5, u"\x2AA0", 1},
+    {u"siml", 4, u"\x2A9D", 1},
+    {u"simlE", 5, u"\x2A9F", 1},
+    {u"simne", 5, u"\x2246", 1},
+    {u"simplus", 7, u"\x2A24", 1},
+    {u"simrarr", 7, u"\x2972", 1},
+    {u"slarr", 5, u"\x2190", 1},
+    {u"smallsetminus", 13, u"\x2216", 1},
+    {u"smashp", 6, u"\x2A33", 1},
+    {u"smeparsl", 8, u"\x29E4", 1},
+    {u"smid", 4, u"\x2223", 1},
+    {u"smile", 5, u"\x2323", 1},
+    {u"smt", 3, u"\x2AAA", 1},
+    {u"smte", 4, u"\x2AAC", 1},
+    {u"smtes", 5, u"\x2AAC\xFE00", 2},
+    {u"softcy", 6, u"\x044C", 1},
+    {u"sol", 3, u"\x002F", 1},
+    {u"solb", 4, u"\x29C4", 1},
+    {u"solbar", 6, u"\x233F", 1},
+    {u"sopf", 4, u"\xD835\xDD64", 2},
+    {u"spades", 6, u"\x2660", 1},
+    {u"spadesuit", 9, u"\x2660", 1},
+    {u"spar", 4, u"\x2225", 1},
+    {u"sqcap", 5, u"\x2293", 1},
+    {u"sqcaps", 6, u"\x2293\xFE00", 2},
+    {u"sqcup", 5, u"\x2294", 1},
+    {u"sqcups", 6, u"\x2294\xFE00", 2},
+    {u"sqsub", 5, u"\x228F", 1},
+    {u"sqsube", 6, u"\x2291", 1},
+    {u"sqsubset", 8, u"\x228F", 1},
+    {u"sqsubseteq", 10, u"\x2291", 1},
+    {u"sqsup", 5, u"\x2290", 1},
+    {u"sqsupe", 6, u"\x2292", 1},
+    {u"sqsupset", 8, u"\x2290", 1},
+    {u"sqsupseteq", 10, u"\x2292", 1},
+    {u"squ", 3, u"\x25A1", 1},
+    {u"square", 6, u"\x25A1", 1},
+    {u"squarf", 6, u"\x25AA", 1},
+    {u"squf", 4, u"\x25AA", 1},
+    {u"srarr", 5, u"\x2192", 1},
+    {u"sscr", 4, u"\xD835\xDCC8", 2},
+    {u"ssetmn", 6, u"\x2216", 1},
+    {u"ssmile", 6, u"\x2323", 1},
+    {u"sstarf", 6, u"\x22C6", 1},
+    {u"star", 4, u"\x2606", 1},
+    {u"starf", 5, u"\x2605", 1},
+    {u"straightepsilon", 15, u"\x03F5", 1},
+    {u"straightphi", 11, u"\x03D5", 1},
+    {u"strns", 5, u"\x00AF", 1},
+    {u"sub", 3, u"\x2282", 1},
+    {u"subE", 4, u"\x2AC5", 1},
+    {u"subdot", 6, u"\x2ABD", 1},
+    {u"sube", 4, u"\x2286", 1},
+    {u"subedot", 7, u"\x2AC3", 1},
+    {u"submult", 7, u"\x2AC1", 1},
+    {u"subnE", 5, u"\x2ACB", 1},
+    {u"subne", 5, u"\x228A", 1},
+    {u"subplus", 7, u"\x2ABF", 1},
+    {u"subrarr", 7, u"\x2979", 1},
+    {u"subset", 6, u"\x2282", 1},
+    {u"subseteq", 8, u"\x2286", 1},
+    {u"subseteqq", 9, u"\x2AC5", 1},
+    {u"subsetneq", 9, u"\x228A", 1},
+    {u"subsetneqq", 10, u"\x2ACB", 1},
+    {u"subsim", 6, u"\x2AC7", 1},
+    {u"subsub", 6, u"\x2AD5", 1},
+    {u"subsup", 6, u"\x2AD3", 1},
+    {u"succ", 4, u"\x227B", 1},
+    {u"succapprox", 10, u"\x2AB8", 1},
+    {u"succcurlyeq", 11, u"\x227D", 1},
+    {u"succeq", 6, u"\x2AB0", 1},
+    {u"succnapprox", 11, u"\x2ABA", 1},
+    {u"succneqq", 8, u"\x2AB6", 1},
+    {u"succnsim", 8, u"\x22E9", 1},
+    {u"succsim", 7, u"\x227F", 1},
+    {u"sum", 3, u"\x2211", 1},
+    {u"sung", 4, u"\x266A", 1},
+    {u"sup1", 4, u"\x00B9", 1},
+    {u"sup2", 4, u"\x00B2", 1},
+    {u"sup3", 4, u"\x00B3", 1},
+    {u"sup", 3, u"\x2283", 1},
+    {u"supE", 4, u"\x2AC6", 1},
+    {u"supdot", 6, u"\x2ABE", 1},
+    {u"supdsub", 7, u"\x2AD8", 1},
+    {u"supe", 4, u"\x2287", 1},
+    {u"supedot", 7, u"\x2AC4", 1},
+    {u"suphsol", 7, u"\x27C9", 1},
+    {u"suphsub", 7, u"\x2AD7", 1},
+    {u"suplarr", 7, u"\x297B", 1},
+    {u"supmult", 7, u"\x2AC2", 1},
+    {u"supnE", 5, u"\x2ACC", 1},
+    {u"supne", 5, u"\x228B", 1},
+    {u"supplus", 7, u"\x2AC0", 1},
+    {u"supset", 6, u"\x2283", 1},
+    {u"supseteq", 8, u"\x2287", 1},
+    {u"supseteqq", 9, u"\x2AC6", 1},
+    {u"supsetneq", 9, u"\x228B", 1},
+    {u"supsetneqq", 10, u"\x2ACC", 1},
+    {u"supsim", 6, u"\x2AC8", 1},
+    {u"supsub", 6, u"\x2AD4", 1},
+    {u"supsup", 6, u"\x2AD6", 1},
+    {u"swArr", 5, u"\x21D9", 1},
+    {u"swarhk", 6, u"\x2926", 1},
+    {u"swarr", 5, u"\x2199", 1},
+    {u"swarrow", 7, u"\x2199", 1},
+    {u"swnwar", 6, u"\x292A", 1},
+    {u"szlig", 5, u"\x00DF", 1},
+    {u"target", 6, u"\x2316", 1},
+    {u"tau", 3, u"\x03C4", 1},
+    {u"tbrk", 4, u"\x23B4", 1},
+    {u"tcaron", 6, u"\x0165", 1},
+    {u"tcedil", 6, u"\x0163", 1},
+    {u"tcy", 3, u"\x0442", 1},
+    {u"tdot", 4, u"\x20DB", 1},
+    {u"telrec", 6, u"\x2315", 1},
+    {u"tfr", 3, u"\xD835\xDD31", 2},
+    {u"there4", 6, u"\x2234", 1},
+    {u"therefore", 9, u"\x2234", 1},
+    {u"theta", 5, u"\x03B8", 1},
+    {u"thetasym", 8, u"\x03D1", 1},
+    {u"thetav", 6, u"\x03D1", 1},
+    {u"thickapprox", 11, u"\x2248", 1},
+    {u"thicksim", 8, u"\x223C", 1},
+    {u"thinsp", 6, u"\x2009", 1},
+    {u"thkap", 5, u"\x2248", 1},
+    {u"thksim", 6, u"\x223C", 1},
+    {u"thorn", 5, u"\x00FE", 1},
+    {u"tilde", 5, u"\x02DC", 1},
+    {u"times", 5, u"\x00D7", 1},
+    {u"timesb", 6, u"\x22A0", 1},
+    {u"timesbar", 8, u"\x2A31", 1},
+    {u"timesd", 6, u"\x2A30", 1},
+    {u"tint", 4, u"\x222D", 1},
+    {u"toea", 4, u"\x2928", 1},
+    {u"top", 3, u"\x22A4", 1},
+    {u"topbot", 6, u"\x2336", 1},
+    {u"topcir", 6, u"\x2AF1", 1},
+    {u"topf", 4, u"\xD835\xDD65", 2},
+    {u"topfork", 7, u"\x2ADA", 1},
+    {u"tosa", 4, u"\x2929", 1},
+    {u"tprime", 6, u"\x2034", 1},
+    {u"trade", 5, u"\x2122", 1},
+    {u"triangle", 8, u"\x25B5", 1},
+    {u"triangledown", 12, u"\x25BF", 1},
+    {u"triangleleft", 12, u"\x25C3", 1},
+    {u"trianglelefteq", 14, u"\x22B4", 1},
+    {u"triangleq", 9, u"\x225C", 1},
+    {u"triangleright", 13, u"\x25B9", 1},
+    {u"trianglerighteq", 15, u"\x22B5", 1},
+    {u"tridot", 6, u"\x25EC", 1},
+    {u"trie", 4, u"\x225C", 1},
+    {u"triminus", 8, u"\x2A3A", 1},
+    {u"triplus", 7, u"\x2A39", 1},
+    {u"trisb", 5, u"\x29CD", 1},
+    {u"tritime", 7, u"\x2A3B", 1},
+    {u"trpezium", 8, u"\x23E2", 1},
+    {u"tscr", 4, u"\xD835\xDCC9", 2},
+    {u"tscy", 4, u"\x0446", 1},
+    {u"tshcy", 5, u"\x045B", 1},
+    {u"tstrok", 6, u"\x0167", 1},
+    {u"twixt", 5, u"\x226C", 1},
+    {u"twoheadleftarrow", 16, u"\x219E", 1},
+    {u"twoheadrightarrow", 17, u"\x21A0", 1},
+    {u"uArr", 4, u"\x21D1", 1},
+    {u"uHar", 4, u"\x2963", 1},
+    {u"uacute", 6, u"\x00FA", 1},
+    {u"uarr", 4, u"\x2191", 1},
+    {u"ubrcy", 5, u"\x045E", 1},
+    {u"ubreve", 6, u"\x016D", 1},
+    {u"ucirc", 5, u"\x00FB", 1},
+    {u"ucy", 3, u"\x0443", 1},
+    {u"udarr", 5, u"\x21C5", 1},
+    {u"udblac", 6, u"\x0171", 1},
+    {u"udhar", 5, u"\x296E", 1},
+    {u"ufisht", 6, u"\x297E", 1},
+    {u"ufr", 3, u"\xD835\xDD32", 2},
+    {u"ugrave", 6, u"\x00F9", 1},
+    {u"uharl", 5, u"\x21BF", 1},
+    {u"uharr", 5, u"\x21BE", 1},
+    {u"uhblk", 5, u"\x2580", 1},
+    {u"ulcorn", 6, u"\x231C", 1},
+    {u"ulcorner", 8, u"\x231C", 1},
+    {u"ulcrop", 6, u"\x230F", 1},
+    {u"ultri", 5, u"\x25F8", 1},
+    {u"umacr", 5, u"\x016B", 1},
+    {u"uml", 3, u"\x00A8", 1},
+    {u"uogon", 5, u"\x0173", 1},
+    {u"uopf", 4, u"\xD835\xDD66", 2},
+    {u"uparrow", 7, u"\x2191", 1},
+    {u"updownarrow", 11, u"\x2195", 1},
+    {u"upharpoonleft", 13, u"\x21BF", 1},
+    {u"upharpoonright", 14, u"\x21BE", 1},
+    {u"uplus", 5, u"\x228E", 1},
+    {u"upsi", 4, u"\x03C5", 1},
+    {u"upsih", 5, u"\x03D2", 1},
+    {u"upsilon", 7, u"\x03C5", 1},
+    {u"upuparrows", 10, u"\x21C8", 1},
+    {u"urcorn", 6, u"\x231D", 1},
+    {u"urcorner", 8, u"\x231D", 1},
+    {u"urcrop", 6, u"\x230E", 1},
+    {u"uring", 5, u"\x016F", 1},
+    {u"urtri", 5, u"\x25F9", 1},
+    {u"uscr", 4, u"\xD835\xDCCA", 2},
+    {u"utdot", 5, u"\x22F0", 1},
+    {u"utilde", 6, u"\x0169", 1},
+    {u"utri", 4, u"\x25B5", 1},
+    {u"utrif", 5, u"\x25B4", 1},
+    {u"uuarr", 5, u"\x21C8", 1},
+    {u"uuml", 4, u"\x00FC", 1},
+    {u"uwangle", 7, u"\x29A7", 1},
+    {u"vArr", 4, u"\x21D5", 1},
+    {u"vBar", 4, u"\x2AE8", 1},
+    {u"vBarv", 5, u"\x2AE9", 1},
+    {u"vDash", 5, u"\x22A8", 1},
+    {u"vangrt", 6, u"\x299C", 1},
+    {u"varepsilon", 10, u"\x03F5", 1},
+    {u"varkappa", 8, u"\x03F0", 1},
+    {u"varnothing", 10, u"\x2205", 1},
+    {u"varphi", 6, u"\x03D5", 1},
+    {u"varpi", 5, u"\x03D6", 1},
+    {u"varpropto", 9, u"\x221D", 1},
+    {u"varr", 4, u"\x2195", 1},
+    {u"varrho", 6, u"\x03F1", 1},
+    {u"varsigma", 8, u"\x03C2", 1},
+    {u"varsubsetneq", 12, u"\x228A\xFE00", 2},
+    {u"varsubsetneqq", 13, u"\x2ACB\xFE00", 2},
+    {u"varsupsetneq", 12, u"\x228B\xFE00", 2},
+    {u"varsupsetneqq", 13, u"\x2ACC\xFE00", 2},
+    {u"vartheta", 8, u"\x03D1", 1},
+    {u"vartriangleleft", 15, u"\x22B2", 1},
+    {u"vartriangleright", 16, u"\x22B3", 1},
+    {u"vcy", 3, u"\x0432", 1},
+    {u"vdash", 5, u"\x22A2", 1},
+    {u"vee", 3, u"\x2228", 1},
+    {u"veebar", 6, u"\x22BB", 1},
+    {u"veeeq", 5, u"\x225A", 1},
+    {u"vellip", 6, u"\x22EE", 1},
+    {u"verbar", 6, u"\x007C", 1},
+    {u"vert", 4, u"\x007C", 1},
+    {u"vfr", 3, u"\xD835\xDD33", 2},
+    {u"vltri", 5, u"\x22B2", 1},
+    {u"vnsub", 5, u"\x2282\x20D2", 2},
+    {u"vnsup", 5, u"\x2283\x20D2", 2},
+    {u"vopf", 4, u"\xD835\xDD67", 2},
+    {u"vprop", 5, u"\x221D", 1},
+    {u"vrtri", 5, u"\x22B3", 1},
+    {u"vscr", 4, u"\xD835\xDCCB", 2},
+    {u"vsubnE", 6, u"\x2ACB\xFE00", 2},
+    {u"vsubne", 6, u"\x228A\xFE00", 2},
+    {u"vsupnE", 6, u"\x2ACC\xFE00", 2},
+    {u"vsupne", 6, u"\x228B\xFE00", 2},
+    {u"vzigzag", 7, u"\x299A", 1},
+    {u"wcirc", 5, u"\x0175", 1},
+    {u"wedbar", 6, u"\x2A5F", 1},
+    {u"wedge", 5, u"\x2227", 1},
+    {u"wedgeq", 6, u"\x2259", 1},
+    {u"weierp", 6, u"\x2118", 1},
+    {u"wfr", 3, u"\xD835\xDD34", 2},
+    {u"wopf", 4, u"\xD835\xDD68", 2},
+    {u"wp", 2, u"\x2118", 1},
+    {u"wr", 2, u"\x2240", 1},
+    {u"wreath", 6, u"\x2240", 1},
+    {u"wscr", 4, u"\xD835\xDCCC", 2},
+    {u"xcap", 4, u"\x22C2", 1},
+    {u"xcirc", 5, u"\x25EF", 1},
+    {u"xcup", 4, u"\x22C3", 1},
+    {u"xdtri", 5, u"\x25BD", 1},
+    {u"xfr", 3, u"\xD835\xDD35", 2},
+    {u"xhArr", 5, u"\x27FA", 1},
+    {u"xharr", 5, u"\x27F7", 1},
+    {u"xi", 2, u"\x03BE", 1},
+    {u"xlArr", 5, u"\x27F8", 1},
+    {u"xlarr", 5, u"\x27F5", 1},
+    {u"xmap", 4, u"\x27FC", 1},
+    {u"xnis", 4, u"\x22FB", 1},
+    {u"xodot", 5, u"\x2A00", 1},
+    {u"xopf", 4, u"\xD835\xDD69", 2},
+    {u"xoplus", 6, u"\x2A01", 1},
+    {u"xotime", 6, u"\x2A02", 1},
+    {u"xrArr", 5, u"\x27F9", 1},
+    {u"xrarr", 5, u"\x27F6", 1},
+    {u"xscr", 4, u"\xD835\xDCCD", 2},
+    {u"xsqcup", 6, u"\x2A06", 1},
+    {u"xuplus", 6, u"\x2A04", 1},
+    {u"xutri", 5, u"\x25B3", 1},
+    {u"xvee", 4, u"\x22C1", 1},
+    {u"xwedge", 6, u"\x22C0", 1},
+    {u"yacute", 6, u"\x00FD", 1},
+    {u"yacy", 4, u"\x044F", 1},
+    {u"ycirc", 5, u"\x0177", 1},
+    {u"ycy", 3, u"\x044B", 1},
+    {u"yen", 3, u"\x00A5", 1},
+    {u"yfr", 3, u"\xD835\xDD36", 2},
+    {u"yicy", 4, u"\x0457", 1},
+    {u"yopf", 4, u"\xD835\xDD6A", 2},
+    {u"yscr", 4, u"\xD835\xDCCE", 2},
+    {u"yucy", 4, u"\x044E", 1},
+    {u"yuml", 4, u"\x00FF", 1},
+    {u"zacute", 6, u"\x017A", 1},
+    {u"zcaron", 6, u"\x017E", 1},
+    {u"zcy", 3, u"\x0437", 1},
+    {u"zdot", 4, u"\x017C", 1},
+    {u"zeetrf", 6, u"\x2128", 1},
+    {u"zeta", 4, u"\x03B6", 1},
+    {u"zfr", 3, u"\xD835\xDD37", 2},
+    {u"zhcy", 4, u"\x0436", 1},
+    {u"zigrarr", 7, u"\x21DD", 1},
+    {u"zopf", 4, u"\xD835\xDD6B", 2},
+    {u"zscr", 4, u"\xD835\xDCCF", 2},
+    {u"zwj", 3, u"\x200D", 1},
+    {u"zwnj", 4, u"\x200C", 1}};
+
+// Displacements of buckets.
+static constexpr quint16 s_entityDisplacements[] = {
+    4, 4, 0, 7, 7, 0, 2, 7, 1, 2, 3, 6, 0, 6, 0, 0,
+    0, 1, 1, 10, 2, 0, 1, 1, 0, 1, 1, 7, 1, 0, 3, 0,
+    2, 2, 0, 6, 1, 4, 2, 0, 0, 0, 0, 3, 2, 1, 0, 1,
+    3, 2, 4, 8, 0, 2, 2, 1, 1, 3, 0, 5, 5, 3, 4, 6,
+    5, 6, 5, 4, 0, 0, 0, 0, 0, 4, 8, 2, 3, 0, 0, 4,
+    1, 1, 0, 0, 0, 6, 4, 5, 0, 2, 2, 1, 5, 0, 2, 2,
+    0, 0, 1, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 4, 6, 2,
+    6, 11, 4, 1, 15, 0, 0, 1, 3, 0, 5, 2, 1, 0, 3, 0,
+    0, 4, 3, 0, 1, 0, 4, 3, 7, 4, 5, 0, 4, 1, 2, 1,
+    8, 2, 1, 0, 1, 8, 4, 1, 1, 8, 2, 1, 1, 6, 1, 1,
+    0, 5, 3, 8, 4, 3, 3, 2, 4, 0, 0, 0, 0, 1, 17, 2,
+    1, 0, 1, 3, 11, 7, 2, 12, 12, 0, 0, 2, 2, 10, 0, 19,
+    2, 0, 12, 0, 1, 8, 1, 4, 0, 0, 2, 0, 1, 0, 0, 1,
+    0, 11, 14, 0, 3, 3, 1, 0, 10, 3, 0, 2, 1, 0, 1, 1,
+    18, 0, 3, 2, 2, 6, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0,
+    1, 7, 3, 1, 0, 0, 8, 2, 7, 0, 4, 5, 0, 17, 1, 2,
+    21, 6, 1, 0, 1, 0, 2, 1, 1, 1, 0, 6, 1, 1, 3, 3,
+    1, 0, 1, 9, 0, 0, 0, 0, 10, 3, 2, 0, 2, 6, 4, 3,
+    5, 2, 8, 7, 0, 1, 1, 5, 0, 0, 7, 1, 1, 5, 1, 2,
+    1, 0, 0, 1, 0, 1, 1, 2, 12, 0, 1, 0, 3, 1, 0, 3,
+    1, 3, 0, 19, 11, 0, 0, 0, 1, 0, 1, 2, 3, 0, 5, 5,
+    3, 0, 0, 0, 3, 4, 2, 2, 0, 0, 1, 4, 5, 0, 0, 16,
+    10, 0, 10, 4, 6, 1, 2, 3, 3, 0, 4, 0, 5, 0, 20, 8,
+    0, 1, 5, 0, 0, 0, 9, 1, 1, 0, 1, 0, 6, 1, 1, 1,
+    9, 0, 12, 0, 2, 3, 0, 0, 1, 2, 1, 9, 3, 8, 0, 1,
+    7, 8, 2, 1, 0, 0, 3, 7, 2, 0, 2, 7, 0, 2, 0, 0,
+    10, 1, 4, 0, 4, 0, 1, 9, 5, 3, 0, 3, 7, 1, 0, 2,
+    5, 1, 34, 2, 4, 2, 4, 1, 13, 10, 1, 3, 0, 7, 7, 3,
+    7, 1, 0, 0, 1, 3, 3, 0, 13, 9, 13, 0, 9, 4, 2, 4,
+    12, 0, 0, 18, 1, 1, 10, 19, 1, 20, 0, 8, 0, 14, 2, 1,
+    6, 2, 5, 4, 7, 0, 0, 4, 6, 2, 3, 13, 5, 0, 3, 1,
+    7, 11, 6, 2, 10, 1, 1, 20, 4, 7, 2, 0, 15, 0, 4, 15,
+    0, 17, 0, 3, 7, 5, 6, 0, 0, 7, 0, 0, 4, 2, 0, 2,
+    0, 7, 10, 2};
+
+// Indexes of entities plus one, zero is an empty slot.
+static constexpr quint16 s_entitySlots[] = {
+    154, 0, 0, 0, 1727, 0, 0, 1077, 1692, 2017, 0, 2048, 121, 1451, 960, 0,
+    980, 0, 2026, 0, 0, 0, 574, 0, 0, 1105, 606, 0, 466, 1187, 644, 0,
+    1653, 0, 873, 0, 0, 510, 589, 1222, 0, 0, 0, 0, 0, 1333, 0, 0,
+    1497, 662, 2101, 1360, 342, 0, 1303, 418, 0, 0, 0, 0, 459, 1634, 809, 1277,
+    0, 0, 0, 0, 0, 1296, 0, 0, 584, 823, 1272, 0, 1169, 0, 0, 2051,
+    0, 0, 180, 859, 563, 0, 0, 54, 1007, 0, 0, 0, 2085, 0, 1985, 0,
+    0, 0, 0, 0, 0, 0, 861, 0, 1787, 0, 0, 1875, 0, 177, 1561, 1163,
+    1120, 0, 0, 1291, 0, 1092, 0, 1725, 0, 0, 0, 0, 1263, 0, 0, 789,
+    0, 0, 201, 1607, 1160, 0, 923, 1649, 1054, 1917, 0, 1882, 416, 0, 1186, 0,
+    1145, 0, 1829, 135, 1465, 0, 1149, 0, 795, 870, 1794, 0, 0, 1675, 0, 0,
+    0, 1081, 1091, 0, 0, 840, 421, 0, 0, 1683, 0, 0, 0, 1604, 475, 0,
+    0, 0, 346, 0, 655, 0, 0, 119, 0, 1981, 931, 1625, 0, 293, 0, 1703,
+    2016, 1966, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0, 915,
+    0, 0, 0, 0, 0, 740, 1319, 0, 1721, 1927, 776, 41, 1047, 0, 1841, 958,
+    1246, 0, 1831, 913, 0, 0, 1140, 0, 0, 0, 0, 0, 132, 1731, 0, 138,
+    0, 778, 538, 712, 1547, 0, 1666, 0, 0, 0, 0, 2079, 1579, 0, 461, 0,
+    140, 1851, 387, 939, 0, 0, 969, 1768, 1500, 1090, 1022, 536, 1422, 0, 1304, 1531,
+    1094, 22, 0, 0, 1633, 1595, 0, 1167, 0, 375, 0, 1965, 2035, 1061, 1925, 1870,
+    0, 148, 0, 1992, 0, 497, 0, 0, 1764, 0, 1751, 0, 1766, 0, 1986, 1249,
+    1739, 0, 0, 0, 0, 0, 376, 0, 0, 1879, 0, 1388, 1322, 0, 0, 1745,
+    0, 1715, 179, 0, 0, 252, 697, 0, 259, 0, 1063, 1553, 1338, 0, 0, 2020,
+    0, 1400, 0, 0, 304, 1587, 0, 0, 0, 1716, 1315, 0, 0, 709, 1901, 245,
+    0, 0, 0, 1621, 0, 0, 397, 0, 1441, 0, 0, 156, 2068, 1913, 1424, 611,
+    1668, 0, 1255, 0, 1158, 0, 0, 0, 2000, 1947, 161, 238, 1043, 1930, 542, 0,
+    0, 0, 1840, 1411, 810, 0, 1033, 0, 0, 0, 1528, 0, 1373, 0, 0, 692,
+    0, 205, 0, 0, 352, 0, 0, 0, 0, 1711, 1002, 1447, 0, 0, 0, 2033,
+    0, 0, 2029, 8, 377, 1243, 215, 0, 1184, 711, 1442, 0, 1073, 0, 1654, 0,
+    1710, 0, 0, 1402, 0, 1672, 0, 0, 282, 0, 0, 120, 0, 0, 0, 0,
+    1997, 477, 0, 784, 2012, 856, 1635, 0, 2046, 374, 1707, 874, 836, 0, 0, 391,
+    2069, 0, 0, 1577, 549, 256, 749, 1914, 1327, 349, 0, 0, 1226, 1993, 820, 1099,
+    1770, 107, 0, 0, 0, 2005, 241, 0, 0, 0, 0, 294, 803, 0, 0, 962,
+    1865, 0, 0, 21, 0, 262, 819, 0, 1967, 2049, 1162, 0, 1921, 0, 0, 1470,
+    1377, 45, 0, 330, 0, 961, 0, 0, 2117, 770, 841, 0, 0, 0, 0, 791,
+    0, 0, 0, 77, 2031, 0, 0, 1891, 0, 0, 0, 1723, 295, 0, 1589, 0,
+    904, 1753, 1354, 0, 877, 0, 793, 438, 0, 381, 0, 388, 0, 1418, 0, 0,
+    0, 0, 0, 0, 0, 1440, 1676, 942, 1597, 1446, 1468, 0, 1964, 0, 0, 39,
+    0, 815, 0, 985, 1137, 0, 862, 0, 2032, 1944, 0, 857, 0, 178, 0, 134,
+    720, 1785, 1855, 0, 0, 0, 0, 695, 1848, 1974, 243, 0, 0, 0, 0, 0,
+    1136, 137, 0, 400, 0, 0, 480, 1489, 116, 247, 794, 0, 0, 0, 0, 1795,
+    700, 0, 708, 817, 1771, 0, 0, 826, 1541, 1652, 2024, 0, 1212, 311, 0, 0,
+    0, 0, 0, 636, 0, 1984, 0, 725, 560, 0, 1224, 1941, 1613, 0, 947, 1426,
+    0, 0, 0, 0, 1390, 0, 0, 1089, 0, 1735, 615, 0, 0, 0, 1506, 2116,
+    2037, 0, 518, 0, 2100, 0, 0, 0, 0, 0, 415, 0, 0, 1039, 1201, 0,
+    828, 1685, 1632, 1911, 0, 0, 0, 1487, 0, 0, 0, 472, 0, 1293, 0, 292,
+    2122, 0, 0, 0, 1809, 1217, 0, 0, 0, 1313, 1214, 1488, 0, 0, 1789, 0,
+    0, 0, 1102, 0, 1030, 0, 0, 0, 0, 521, 772, 0, 0, 0, 420, 0,
+    801, 0, 713, 2123, 190, 1601, 1110, 0, 0, 0, 0, 56, 0, 0, 0, 0,
+    412, 502, 0, 1836, 0, 105, 0, 0, 899, 0, 0, 0, 0, 1857, 0, 0,
+    1185, 0, 0, 0, 853, 1781, 1976, 496, 0, 1307, 222, 775, 747, 0, 1112, 730,
+    0, 162, 197, 0, 1365, 0, 2091, 1978, 0, 0, 1247, 1572, 0, 0, 0, 0,
+    0, 380, 0, 1700, 0, 0, 654, 0, 0, 0, 1144, 0, 0, 0, 1663, 1949,
+    1096, 1940, 0, 0, 0, 0, 0, 517, 957, 0, 67, 1842, 738, 0, 0, 0,
+    0, 1011, 0, 0, 685, 0, 1413, 702, 668, 437, 0, 0, 0, 576, 0, 0,
+    0, 0, 0, 1588, 366, 0, 0, 1639, 952, 0, 0, 0, 364, 0, 1514, 168,
+    410, 1235, 0, 0, 313, 0, 0, 0, 0, 0, 0, 830, 0, 0, 1170, 805,
+    1972, 1655, 0, 0, 0, 642, 0, 1880, 864, 1631, 0, 0, 0, 0, 0, 219,
+    227, 372, 0, 1832, 512, 838, 1548, 1154, 0, 0, 1740, 0, 1530, 0, 1554, 0,
+    1332, 0, 1210, 1288, 451, 1982, 1962, 1146, 0, 0, 1021, 0, 0, 1793, 1183, 1429,
+    0, 0, 145, 0, 0, 25, 0, 953, 0, 0, 0, 0, 2040, 0, 0, 1138,
+    1286, 1052, 0, 580, 0, 0, 471, 0, 0, 0, 0, 0, 0, 1119, 0, 131,
+    452, 0, 0, 1204, 645, 0, 226, 0, 0, 0, 1393, 1029, 1314, 443, 0, 0,
+    1271, 0, 0, 1086, 239, 0, 0, 0, 0, 0, 1584, 0, 605, 2124, 569, 460,
+    37, 0, 425, 0, 0, 663, 879, 0, 0, 667, 0, 1049, 0, 0, 0, 590,
+    0, 0, 1791, 520, 278, 1903, 1816, 269, 0, 1065, 1807, 1817, 98, 0, 1471, 0,
+    1542, 0, 355, 1368, 0, 0, 0, 0, 0, 1064, 0, 422, 0, 0, 101, 398,
+    1850, 1241, 0, 768, 1533, 0, 0, 1372, 601, 0, 0, 1636, 799, 1200, 0, 275,
+    0, 0, 936, 0, 505, 1072, 0, 1536, 1600, 1046, 0, 479, 0, 1097, 159, 202,
+    0, 344, 0, 0, 181, 0, 1407, 0, 1899, 1614, 855, 0, 1273, 0, 0, 379,
+    0, 1156, 0, 0, 1166, 719, 998, 979, 0, 617, 0, 687, 113, 0, 592, 146,
+    453, 0, 1312, 482, 169, 2063, 1939, 1419, 743, 0, 1722, 0, 0, 0, 1975, 0,
+    1874, 1057, 0, 0, 1457, 1177, 0, 0, 585, 1070, 0, 0, 0, 919, 0, 75,
+    483, 1696, 1414, 263, 1342, 491, 0, 550, 0, 0, 0, 1001, 1438, 0, 0, 473,
+    1346, 0, 1495, 200, 0, 829, 1398, 0, 1599, 0, 531, 0, 0, 1926, 172, 0,
+    0, 1107, 1367, 0, 1756, 96, 0, 0, 1015, 52, 2087, 0, 0, 0, 0, 0,
+    0, 0, 1669, 1436, 0, 0, 1075, 1359, 0, 0, 0, 0, 0, 586, 562, 1571,
+    643, 0, 867, 0, 1473, 0, 1175, 1702, 0, 1552, 0, 1045, 0, 0, 559, 1492,
+    0, 0, 0, 1285, 173, 0, 0, 1384, 650, 0, 2064, 0, 0, 0, 548, 0,
+    883, 1566, 0, 788, 34, 0, 0, 1171, 0, 2103, 0, 0, 0, 390, 1867, 1251,
+    591, 0, 1910, 1560, 0, 299, 1928, 1630, 941, 0, 1958, 1963, 1959, 1017, 1797, 1684,
+    937, 0, 458, 2023, 100, 0, 530, 0, 0, 2027, 0, 0, 0, 1155, 0, 546,
+    914, 0, 0, 0, 0, 251, 541, 1417, 0, 0, 0, 1453, 1000, 0, 852, 0,
+    0, 901, 0, 0, 0, 0, 0, 0, 1454, 63, 0, 0, 1805, 0, 1292, 0,
+    0, 999, 1565, 1686, 0, 0, 0, 0, 55, 0, 0, 0, 112, 1317, 0, 0,
+    0, 0, 1605, 0, 2056, 147, 731, 0, 0, 1889, 0, 0, 1977, 0, 637, 1461,
+    972, 47, 1825, 0, 0, 16, 1260, 1237, 0, 2084, 706, 1014, 0, 1116, 0, 2083,
+    1421, 369, 0, 0, 694, 1852, 0, 322, 1432, 0, 0, 1790, 0, 26, 0, 0,
+    446, 0, 0, 2095, 0, 1151, 0, 118, 0, 0, 0, 0, 1792, 0, 0, 0,
+    1428, 0, 1647, 633, 0, 450, 0, 0, 715, 1474, 94, 0, 0, 1824, 1643, 1835,
+    918, 0, 1337, 1869, 224, 0, 954, 225, 543, 0, 0, 0, 1267, 1540, 0, 445,
+    503, 0, 1520, 1416, 1822, 0, 1677, 2, 149, 0, 476, 0, 0, 188, 60, 0,
+    0, 1929, 0, 1462, 868, 0, 1353, 0, 1543, 1305, 0, 787, 0, 347, 0, 0,
+    1918, 157, 210, 93, 660, 2071, 0, 232, 523, 1480, 0, 0, 0, 0, 822, 1691,
+    89, 1345, 1811, 0, 0, 608, 0, 2082, 0, 1611, 411, 0, 1558, 748, 0, 769,
+    701, 0, 0, 623, 71, 995, 930, 1493, 0, 0, 273, 0, 0, 0, 0, 0,
+    0, 192, 103, 1117, 0, 1340, 1724, 72, 0, 321, 0, 0, 0, 309, 465, 0,
+    1048, 1642, 658, 0, 0, 0, 79, 1078, 0, 406, 0, 0, 2121, 1524, 1667, 0,
+    628, 0, 441, 0, 813, 0, 0, 882, 0, 0, 0, 0, 1749, 0, 0, 0,
+    0, 746, 0, 0, 0, 0, 1846, 529, 0, 199, 0, 339, 78, 1168, 575, 0,
+    0, 0, 1564, 0, 0, 646, 0, 934, 0, 0, 0, 0, 0, 0, 682, 1012,
+    0, 0, 997, 831, 889, 46, 0, 0, 0, 0, 1284, 0, 65, 0, 108, 0,
+    0, 0, 0, 213, 0, 1688, 1878, 0, 1010, 228, 0, 1484, 2086, 337, 762, 0,
+    0, 0, 0, 0, 0, 0, 0, 1197, 1020, 1130, 1866, 1512, 790, 0, 442, 1887,
+    206, 1827, 0, 1778, 2060, 0, 1895, 1517, 0, 0, 1055, 0, 0, 0, 1282, 890,
+    0, 1837, 0, 82, 0, 95, 887, 0, 0, 0, 1567, 66, 0, 0, 0, 0,
+    1387, 155, 0, 1665, 1450, 0, 5, 0, 1627, 0, 1779, 0, 255, 1651, 0, 302,
+    975, 0, 0, 0, 0, 2114, 0, 0, 0, 0, 2066, 0, 426, 0, 70, 1274,
+    0, 0, 0, 0, 0, 827, 1821, 1774, 0, 0, 81, 1114, 1799, 1467, 1847, 0,
+    0, 0, 1088, 902, 0, 0, 1864, 0, 0, 35, 1396, 0, 0, 0, 1323, 102,
+    0, 0, 0, 0, 0, 1394, 0, 427, 0, 0, 2014, 925, 1018, 298, 0, 0,
+    10, 0, 0, 0, 0, 0, 881, 0, 977, 1748, 2054, 551, 1343, 1717, 721, 0,
+    0, 2077, 750, 910, 1297, 888, 0, 1142, 0, 1115, 1510, 1477, 270, 0, 0, 0,
+    0, 1265, 0, 431, 1125, 0, 0, 1143, 558, 0, 1127, 0, 0, 782, 1769, 315,
+    1042, 2041, 320, 0, 1736, 2118, 1211, 0, 204, 1356, 1179, 0, 917, 0, 950, 0,
+    0, 0, 1693, 0, 0, 527, 0, 842, 0, 571, 333, 0, 0, 1746, 0, 0,
+    64, 0, 0, 1380, 0, 677, 1280, 160, 0, 1998, 652, 0, 0, 1207, 1252, 516,
+    1658, 691, 779, 696, 1223, 0, 0, 0, 0, 1344, 0, 2072, 0, 1747, 1576, 1486,
+    678, 0, 392, 0, 1828, 1189, 1481, 1326, 1478, 1173, 0, 673, 0, 0, 2036, 1350,
+    0, 0, 0, 0, 1591, 42, 0, 2042, 0, 0, 0, 1499, 1575, 0, 675, 0,
+    1006, 1191, 276, 1616, 627, 0, 0, 0, 1924, 2022, 659, 1025, 1515, 638, 1777, 359,
+    0, 2070, 616, 499, 0, 0, 2110, 1067, 23, 0, 0, 1229, 1339, 0, 2010, 0,
+    0, 235, 0, 1302, 0, 0, 310, 434, 234, 994, 1445, 777, 0, 0, 0, 821,
+    1458, 1031, 0, 903, 0, 922, 0, 0, 959, 0, 0, 1279, 1316, 744, 0, 0,
+    0, 1194, 1872, 0, 632, 0, 884, 0, 1694, 0, 1139, 1942, 0, 1858, 444, 0,
+    649, 2034, 2061, 414, 125, 875, 0, 0, 1783, 104, 0, 1656, 0, 0, 328, 610,
+    0, 1405, 0, 0, 0, 0, 1945, 0, 508, 0, 1126, 92, 0, 194, 0, 2065,
+    0, 0, 0, 921, 0, 1983, 2044, 0, 1581, 760, 1619, 0, 0, 0, 1306, 0,
+    323, 329, 1174, 258, 1401, 0, 1153, 435, 0, 0, 1504, 0, 0, 462, 1430, 1490,
+    1311, 0, 0, 0, 1814, 1854, 1259, 534, 384, 58, 603, 2021, 860, 0, 1641, 1180,
+    0, 0, 0, 1449, 0, 408, 1657, 0, 1079, 0, 0, 1830, 286, 0, 619, 218,
+    314, 0, 189, 1606, 0, 48, 0, 142, 0, 2006, 1283, 0, 0, 1645, 0, 547,
+    2003, 1219, 0, 916, 0, 0, 0, 0, 0, 0, 1786, 0, 0, 266, 978, 1448,
+    935, 1095, 1269, 0, 0, 553, 0, 216, 307, 0, 1041, 0, 898, 0, 847, 0,
+    1199, 661, 669, 0, 151, 1623, 0, 0, 869, 0, 812, 2053, 0, 0, 920, 1868,
+    244, 635, 0, 1502, 0, 0, 0, 1800, 1933, 0, 264, 0, 0, 1754, 742, 0,
+    1920, 1347, 85, 59, 1732, 1680, 1951, 0, 0, 0, 0, 61, 0, 1264, 0, 951,
+    1860, 0, 1818, 1996, 0, 0, 0, 171, 0, 0, 671, 907, 1254, 353, 0, 0,
+    1336, 0, 1300, 0, 1294, 1028, 0, 1371, 535, 2030, 0, 1898, 1628, 1066, 0, 0,
+    1988, 0, 0, 409, 0, 0, 417, 1881, 0, 1526, 1859, 1532, 0, 554, 0, 1463,
+    486, 229, 797, 0, 745, 1435, 0, 0, 1240, 593, 11, 0, 0, 40, 1425, 0,
+    0, 767, 0, 0, 1946, 1188, 0, 0, 386, 0, 1361, 0, 0, 0, 0, 373,
+    1608, 170, 0, 0, 1845, 489, 0, 0, 0, 927, 1141, 846, 0, 261, 0, 490,
+    501, 336, 214, 0, 0, 771, 0, 484, 0, 0, 0, 0, 0, 0, 0, 2090,
+    0, 0, 672, 0, 1071, 0, 0, 519, 0, 1050, 1225, 0, 312, 0, 734, 0,
+    0, 1330, 1687, 0, 984, 647, 0, 296, 0, 0, 0, 0, 773, 0, 0, 0,
+    587, 0, 726, 288, 0, 1955, 0, 1248, 0, 761, 73, 0, 0, 0, 1615, 1409,
+    2096, 0, 1849, 833, 0, 956, 0, 1804, 221, 648, 0, 0, 0, 0, 0, 0,
+    124, 906, 1559, 1427, 111, 1720, 0, 634, 0, 704, 0, 1389, 2089, 759, 1909, 0,
+    3, 0, 798, 1912, 756, 110, 429, 0, 208, 0, 0, 1084, 220, 2108, 905, 0,
+    0, 568, 399, 1521, 1281, 0, 43, 0, 0, 0, 0, 242, 0, 1181, 0, 1203,
+    393, 338, 0, 0, 0, 0, 271, 449, 0, 1074, 2067, 0, 0, 0, 990, 1234,
+    428, 164, 0, 0, 0, 165, 0, 724, 0, 850, 114, 0, 0, 0, 0, 1877,
+    362, 1301, 1750, 1068, 2078, 1734, 0, 0, 14, 1113, 582, 0, 0, 896, 624, 343,
+    468, 1538, 0, 0, 396, 0, 1704, 0, 0, 1622, 0, 0, 493, 0, 0, 0,
+    0, 1762, 0, 1620, 0, 0, 845, 0, 0, 572, 0, 209, 141, 0, 0, 607,
+    487, 848, 0, 0, 158, 1215, 1738, 2018, 0, 2052, 1381, 254, 0, 24, 0, 196,
+    1245, 0, 0, 1844, 0, 1358, 0, 0, 354, 0, 0, 639, 0, 494, 0, 248,
+    0, 122, 0, 0, 283, 1399, 537, 0, 0, 993, 7, 0, 989, 0, 0, 419,
+    0, 0, 0, 0, 0, 1100, 0, 679, 0, 1995, 0, 0, 0, 1833, 583, 0,
+    2058, 0, 1671, 1979, 0, 0, 1690, 577, 1741, 0, 0, 578, 0, 0, 0, 0,
+    0, 1796, 133, 0, 2105, 389, 0, 1743, 946, 0, 0, 274, 280, 1239, 0, 0,
+    1862, 0, 545, 2002, 0, 1534, 0, 0, 0, 0, 0, 15, 0, 2028, 0, 430,
+    1826, 1956, 0, 0, 325, 0, 1318, 0, 0, 1670, 0, 0, 0, 433, 657, 0,
+    1385, 1759, 0, 0, 0, 260, 0, 13, 0, 598, 467, 0, 0, 0, 182, 0,
+    2043, 1574, 0, 0, 0, 500, 20, 0, 1596, 0, 1617, 0, 909, 664, 91, 0,
+    0, 1990, 0, 1032, 514, 1885, 0, 1150, 87, 0, 513, 0, 1728, 0, 1508, 0,
+    0, 249, 0, 986, 0, 0, 0, 0, 0, 1085, 404, 0, 991, 0, 1352, 207,
+    0, 1080, 0, 1147, 0, 1257, 0, 440, 0, 0, 19, 594, 693, 217, 317, 0,
+    212, 621, 68, 1295, 0, 1213, 0, 0, 0, 556, 1331, 0, 319, 0, 1262, 1159,
+    0, 1178, 83, 0, 717, 1238, 0, 0, 2074, 0, 0, 0, 167, 1952, 1261, 0,
+    0, 528, 0, 0, 967, 0, 0, 405, 1922, 0, 0, 966, 0, 949, 0, 0,
+    1994, 0, 0, 1938, 0, 84, 0, 804, 0, 1594, 0, 1590, 0, 0, 0, 1890,
+    2045, 0, 1961, 0, 0, 825, 595, 0, 0, 1378, 0, 1392, 0, 0, 0, 1744,
+    0, 0, 0, 1135, 2075, 705, 1472, 0, 1999, 1537, 955, 1124, 1699, 1483, 53, 1810,
+    0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 1485, 982, 854, 630, 0, 0,
+    765, 285, 0, 0, 1479, 331, 2009, 0, 878, 139, 0, 507, 2094, 1546, 1397, 1328,
+    0, 0, 973, 893, 332, 0, 0, 0, 0, 1003, 0, 2055, 2073, 51, 0, 0,
+    0, 1482, 9, 0, 0, 1513, 0, 0, 1161, 540, 2099, 0, 0, 686, 1839, 498,
+    448, 0, 965, 334, 0, 0, 1892, 539, 27, 0, 0, 1919, 0, 723, 0, 0,
+    360, 0, 0, 4, 680, 0, 345, 0, 573, 474, 0, 1027, 1287, 0, 0, 0,
+    1420, 849, 0, 1525, 0, 0, 0, 1087, 0, 1069, 2039, 0, 0, 1023, 1948, 1960,
+    0, 432, 454, 1908, 1535, 0, 1557, 86, 0, 456, 348, 0, 0, 0, 751, 0,
+    1423, 0, 0, 0, 620, 0, 0, 1228, 0, 579, 0, 0, 818, 492, 0, 0,
+    0, 1383, 1701, 0, 0, 0, 0, 1270, 0, 1370, 0, 0, 1678, 0, 0, 44,
+    318, 1801, 1216, 894, 0, 0, 0, 80, 281, 0, 231, 0, 1904, 0, 1491, 0,
+    370, 976, 688, 1610, 0, 0, 0, 2008, 968, 0, 1708, 1496, 871, 0, 1936, 1580,
+    230, 0, 780, 0, 0, 0, 0, 0, 1674, 0, 1434, 143, 567, 126, 1689, 0,
+    1062, 0, 2047, 1973, 478, 0, 0, 891, 1523, 0, 0, 0, 1026, 1341, 1573, 0,
+    758, 1148, 970, 609, 0, 1198, 0, 0, 0, 1208, 945, 0, 0, 0, 0, 0,
+    2098, 1375, 153, 1737, 0, 341, 0, 1325, 1820, 0, 0, 1659, 1369, 1412, 0, 515,
+    834, 0, 614, 1660, 0, 0, 0, 463, 0, 0, 1182, 187, 0, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 1931, 714, 0, 1758, 1970, 0, 0, 983, 0,
+    33, 1009, 0, 0, 0, 1551, 0, 1834, 0, 1118, 600, 0, 0, 1109, 755, 0,
+    1082, 0, 0, 439, 1900, 0, 1034, 1582, 0, 1765, 933, 1236, 0, 1598, 1562, 1460,
+    1815, 816, 561, 0, 0, 481, 1176, 837, 0, 0, 0, 0, 18, 378, 0, 0,
+    211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2104, 729, 1989, 0, 0, 0,
+    1742, 1661, 1221, 0, 1638, 0, 0, 0, 0, 90, 1819, 1773, 1410, 1650, 1709, 0,
+    0, 683, 1896, 0, 324, 395, 436, 570, 1362, 0, 2011, 0, 335, 32, 0, 0,
+    996, 371, 0, 1808, 0, 152, 88, 267, 0, 0, 277, 0, 30, 0, 0, 0,
+    895, 0, 0, 1843, 0, 656, 938, 0, 0, 57, 1915, 1404, 424, 0, 0, 0,
+    718, 0, 1278, 0, 0, 0, 1104, 455, 382, 555, 0, 0, 944, 0, 0, 1519,
+    1782, 1349, 796, 626, 0, 0, 0, 1886, 0, 1529, 236, 0, 1206, 0, 0, 0,
+    300, 0, 0, 488, 1695, 987, 0, 0, 0, 0, 1626, 0, 368, 2059, 1456, 1038,
+    0, 0, 0, 0, 1220, 0, 0, 0, 2007, 305, 0, 1058, 1802, 402, 1788, 1578,
+    265, 0, 1083, 698, 988, 940, 0, 0, 1563, 0, 253, 0, 358, 1152, 1505, 2015,
+    1772, 1037, 835, 641, 290, 0, 532, 511, 880, 1193, 0, 0, 0, 0, 0, 866,
+    1813, 0, 0, 800, 1403, 1853, 0, 0, 0, 1679, 651, 0, 363, 0, 885, 0,
+    289, 106, 0, 1518, 736, 0, 0, 0, 0, 670, 0, 2115, 0, 858, 0, 0,
+    807, 0, 166, 1335, 1511, 0, 0, 1883, 783, 2106, 0, 0, 0, 117, 0, 2050,
+    240, 0, 361, 926, 163, 971, 707, 0, 703, 1374, 423, 0, 0, 1103, 0, 0,
+    0, 0, 1459, 0, 1218, 1053, 886, 0, 0, 0, 0, 1329, 0, 0, 0, 1583,
+    0, 735, 0, 327, 0, 1289, 0, 1550, 863, 1351, 2111, 2019, 1568, 1798, 1718, 1013,
+    0, 0, 557, 0, 1019, 1760, 62, 0, 0, 785, 0, 0, 2113, 0, 0, 0,
+    203, 1266, 0, 485, 97, 1258, 0, 1905, 0, 0, 0, 1706, 566, 1516, 0, 0,
+    1646, 1244, 581, 1570, 0, 0, 1376, 28, 0, 1893, 0, 0, 0, 0, 0, 1752,
+    0, 367, 0, 1357, 1164, 1888, 0, 1131, 0, 1348, 0, 2076, 1932, 2125, 1971, 0,
+    1035, 2062, 1382, 0, 76, 1902, 174, 0, 0, 175, 0, 0, 1644, 1040, 981, 0,
+    1697, 0, 754, 0, 301, 2038, 403, 1157, 2057, 0, 752, 0, 0, 0, 792, 233,
+    1334, 2093, 1767, 0, 297, 0, 0, 928, 1713, 753, 526, 0, 2097, 0, 1522, 588,
+    1108, 0, 0, 0, 1444, 1433, 0, 1733, 0, 1059, 0, 0, 0, 0, 0, 0,
+    223, 1609, 0, 383, 0, 1133, 0, 1004, 1415, 0, 1016, 0, 0, 191, 0, 0,
+    0, 1950, 0, 0, 1726, 1907, 676, 963, 0, 1309, 0, 0, 0, 1954, 1464, 552,
+    0, 1106, 0, 50, 2107, 851, 0, 0, 764, 0, 0, 0, 0, 291, 1230, 0,
+    1618, 74, 1602, 604, 0, 1549, 0, 29, 1439, 1861, 0, 0, 0, 268, 0, 246,
+    12, 1391, 0, 0, 183, 622, 0, 0, 303, 1592, 0, 1172, 0, 0, 0, 49,
+    631, 1503, 1705, 900, 0, 0, 0, 0, 1298, 1290, 739, 237, 1195, 1729, 0, 385,
+    0, 653, 0, 1527, 250, 0, 1876, 1196, 0, 0, 0, 0, 0, 1586, 625, 1585,
+    31, 1730, 1906, 0, 279, 0, 0, 2025, 1276, 1780, 0, 1937, 684, 806, 1299, 150,
+    1953, 1128, 0, 0, 0, 0, 0, 0, 0, 357, 0, 0, 1923, 1719, 0, 0,
+    457, 1934, 0, 2112, 0, 184, 0, 1806, 0, 0, 0, 284, 186, 127, 340, 1507,
+    733, 0, 0, 1698, 0, 524, 0, 0, 0, 0, 0, 0, 681, 0, 0, 763,
+    38, 666, 1253, 1242, 1379, 0, 0, 1005, 1111, 618, 0, 1712, 0, 1856, 413, 0,
+    612, 1232, 0, 1803, 144, 0, 365, 447, 1629, 0, 1776, 0, 0, 0, 272, 0,
+    629, 2102, 876, 0, 0, 0, 0, 602, 0, 1123, 1673, 1969, 495, 1268, 509, 350,
+    1355, 732, 1662, 0, 0, 1545, 0, 1569, 741, 872, 257, 176, 640, 1624, 0, 0,
+    1121, 0, 0, 727, 844, 0, 0, 0, 1227, 0, 0, 892, 0, 1916, 0, 1098,
+    0, 0, 1443, 1494, 0, 1386, 1784, 0, 0, 1823, 0, 0, 0, 0, 0, 1036,
+    0, 1681, 1884, 912, 0, 0, 1943, 1935, 0, 865, 0, 6, 0, 0, 0, 2004,
+    1324, 123, 0, 0, 0, 0, 699, 1231, 596, 193, 185, 1452, 839, 0, 1256, 0,
+    689, 0, 2081, 0, 1205, 1132, 0, 0, 0, 0, 1366, 0, 1863, 728, 737, 2119,
+    0, 0, 0, 1044, 1321, 326, 0, 109, 0, 0, 0, 1364, 0, 0, 802, 0,
+    943, 1763, 1320, 0, 0, 1, 306, 506, 808, 0, 0, 1664, 897, 0, 0, 129,
+    1060, 0, 0, 1556, 469, 1134, 1408, 814, 1233, 1431, 0, 0, 0, 0, 1437, 0,
+    0, 0, 0, 407, 1838, 0, 0, 1714, 710, 0, 544, 0, 1648, 843, 0, 2109,
+    0, 0, 1812, 0, 0, 522, 911, 0, 2001, 1761, 0, 1250, 1757, 2092, 0, 0,
+    1873, 0, 533, 0, 0, 0, 0, 287, 0, 0, 0, 1056, 0, 786, 757, 0,
+    0, 1165, 0, 1501, 0, 36, 1775, 0, 0, 316, 1455, 1593, 0, 1755, 1476, 1008,
+    0, 0, 1475, 1122, 1308, 0, 0, 716, 0, 464, 1987, 0, 0, 0, 0, 2120,
+    0, 674, 0, 198, 0, 0, 1603, 99, 0, 0, 1871, 1406, 1980, 932, 0, 0,
+    992, 781, 0, 0, 0, 0, 929, 525, 0, 195, 0, 0, 0, 130, 1202, 1897,
+    0, 1968, 0, 0, 0, 0, 0, 0, 774, 0, 308, 824, 1640, 964, 1894, 766,
+    0, 0, 0, 0, 1555, 1051, 0, 1637, 1612, 908, 0, 665, 0, 1363, 811, 0,
+    0, 128, 0, 401, 924, 17, 0, 974, 832, 504, 1498, 2013, 0, 0, 1209, 1192,
+    0, 1539, 0, 1101, 1190, 1509, 613, 0, 0, 0, 565, 1076, 0, 0, 0, 0,
+    2080, 1991, 1682, 0, 0, 0, 2088, 115, 0, 1093, 1544, 470, 0, 0, 0, 599,
+    0, 1469, 0, 356, 0, 136, 0, 351, 0, 394, 0, 1466, 0, 1395, 0, 0,
+    564, 0, 0, 69, 1957, 1129, 948, 1310, 0, 1275, 0, 0, 0, 0, 0, 597};
+
+inline quint32 entityHash(QStringView name)
+{
+    quint32 h = 2166136261u;
+
+    for (const auto &c : name) {
+        h ^= c.unicode();
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+inline quint32 entitySlot(quint32 hash,
+                          quint32 displacement)
+{
+    quint32 h = hash + displacement * 0x9E3779B9u;
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+
+    return h & (s_entitySlotsCount - 1);
+}
+
+QStringView findEntity(QStringView name)
+{
+    if (name.isEmpty() || name.size() > s_maxEntityLength) {
+        return {};
+    }
+
+    const auto hash = entityHash(name);
+    const auto i = s_entitySlots[entitySlot(hash, s_entityDisplacements[hash % s_entityBucketsCount])];
+
+    if (i) {
+        const auto &e = s_entities[i - 1];
+
+        if (name == QStringView(e.m_name, e.m_nameLength)) {
+            return QStringView(e.m_value, e.m_valueLength);
+        }
+    }
+
+    return {};
+}
 
 } /* namespace MD */
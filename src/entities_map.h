@@ -8,13 +8,19 @@
 #ifndef MD4QT_ENTITIES_MAP_H_INCLUDED
 #define MD4QT_ENTITIES_MAP_H_INCLUDED
 
-#include <QHash>
-#include <QString>
+#include <QStringView>
 
 namespace MD
 {
 
-extern const QHash<QString, QString> s_entityMap;
+/*!
+ * \inheaderfile md4qt/entities_map.h
+ *
+ * Returns characters of the named entity, or empty view if there is no such entity.
+ *
+ * \a name Name of the entity without "&" and ";".
+ */
+QStringView findEntity(QStringView name);
 
 } /* namespace MD */
 
@@ -449,6 +449,11 @@ bool FencedCodeParser::mayBreakParagraph(Line &,
     return true;
 }
 
+QString FencedCodeParser::startSymbols() const
+{
+    return QStringLiteral("`~");
+}
+
 void FencedCodeParser::finish(Line &currentLine,
                               TextStream &stream,
                               QSharedPointer<Document>,
@@ -136,6 +136,11 @@ public:
                            QSharedPointer<Document> doc,
                            Context &ctx) const override;
 
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     */
+    QString startSymbols() const override;
+
     /*!
      * Finish things. This method invokes after MD::BlockState::Stop state recieved or at the end of file.
      *
@@ -312,6 +312,16 @@ bool FootnoteParser::mayBreakParagraph(Line &,
     return true;
 }
 
+QString FootnoteParser::startSymbols() const
+{
+    return QStringLiteral("[");
+}
+
+bool FootnoteParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 void FootnoteParser::finish(Line &currentLine,
                             TextStream &stream,
                             QSharedPointer<Document> doc,
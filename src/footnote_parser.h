@@ -164,6 +164,16 @@ public:
                            QSharedPointer<Document> doc,
                            Context &ctx) const override;
 
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     */
+    QString startSymbols() const override;
+
+    /*!
+     * Returns whether result of check() without processing depends only on the line and on indents.
+     */
+    bool checkDependsOnIndentsOnly() const override;
+
 private:
     void processLabel(Line &currentLine,
                       QSharedPointer<Document> doc,
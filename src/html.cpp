@@ -6,12 +6,129 @@
 // md4qt include.
 #include "html.h"
 
+// Qt include.
+#include <QThread>
+#include <QThreadPool>
+
+// C++ include.
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MD4QT_HTML_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace MD
 {
 
 namespace details
 {
 
+//
+// HTML escaping.
+//
+
+inline bool isHtmlSpecial(char16_t c,
+                          bool inAttribute)
+{
+    return (c == u'&' || c == u'<' || c == u'>' || (inAttribute && c == u'"'));
+}
+
+/*
+ * Returns position of the first character that should be escaped in HTML starting from
+ * the given position, or size if there is no such character.
+ */
+inline qsizetype findHtmlSpecial(const char16_t *data,
+                                 qsizetype pos,
+                                 qsizetype size,
+                                 bool inAttribute)
+{
+#ifdef MD4QT_HTML_SSE2
+    const auto amp = _mm_set1_epi16(u'&');
+    const auto lt = _mm_set1_epi16(u'<');
+    const auto gt = _mm_set1_epi16(u'>');
+    // Ampersand is used instead of quotation mark if quotation mark is not special.
+    const auto quot = _mm_set1_epi16(inAttribute ? u'"' : u'&');
+
+    for (; pos + 8 <= size; pos += 8) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+        const auto mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(chunk, amp),
+                                                                      _mm_cmpeq_epi16(chunk, quot)),
+                                                         _mm_or_si128(_mm_cmpeq_epi16(chunk, lt),
+                                                                      _mm_cmpeq_epi16(chunk, gt))));
+
+        if (mask) {
+            qsizetype i = 0;
+
+            while (!(mask & (1 << (i * 2)))) {
+                ++i;
+            }
+
+            return pos + i;
+        }
+    }
+#endif // MD4QT_HTML_SSE2
+
+    for (; pos < size; ++pos) {
+        if (isHtmlSpecial(data[pos], inAttribute)) {
+            break;
+        }
+    }
+
+    return pos;
+}
+
+/*
+ * Returns text with escaped special HTML characters in one pass, runs of not special
+ * characters are copied as is. Text is returned without copying if there is nothing to escape.
+ */
+inline QString escapeHtml(const QString &text,
+                          bool inAttribute)
+{
+    const auto data = reinterpret_cast<const char16_t *>(text.constData());
+    const auto size = text.size();
+
+    auto pos = findHtmlSpecial(data, 0, size, inAttribute);
+
+    if (pos == size) {
+        return text;
+    }
+
+    QString res;
+    res.reserve(size + size / 8 + 8);
+
+    qsizetype copied = 0;
+
+    while (pos < size) {
+        res.append(QStringView(data + copied, pos - copied));
+
+        switch (data[pos]) {
+        case u'&':
+            res.append(QLatin1String("&amp;"));
+            break;
+
+        case u'<':
+            res.append(QLatin1String("&lt;"));
+            break;
+
+        case u'>':
+            res.append(QLatin1String("&gt;"));
+            break;
+
+        default:
+            res.append(QLatin1String("&quot;"));
+            break;
+        }
+
+        copied = pos + 1;
+        pos = findHtmlSpecial(data, copied, size, inAttribute);
+    }
+
+    res.append(QStringView(data + copied, size - copied));
+
+    return res;
+}
+
 //
 // HtmlVisitor
 //
@@ -28,16 +145,151 @@ QString HtmlVisitor::toHtml(QSharedPointer<Document> doc,
     m_isWrappedInArticle = wrappedInArticle;
     m_idsMap = idsMap;
 
+    m_sink = nullptr;
+
     m_html.clear();
     m_fns.clear();
+    m_fnsIndex.clear();
 
-    this->process(doc);
+    processItems(doc);
 
     onFootnotes(footnoteBackLinkContent);
 
     return m_html;
 }
 
+void HtmlVisitor::writeHtml(QSharedPointer<Document> doc,
+                            const HtmlSink &sink,
+                            const QString &footnoteBackLinkContent,
+                            bool wrappedInArticle,
+                            const IdsMap *idsMap)
+{
+    m_isWrappedInArticle = wrappedInArticle;
+    m_idsMap = idsMap;
+    m_sink = &sink;
+
+    m_html.clear();
+    m_fns.clear();
+    m_fnsIndex.clear();
+
+    processItems(doc);
+
+    onFootnotes(footnoteBackLinkContent);
+
+    flushHtml(true);
+
+    m_sink = nullptr;
+}
+
+QSharedPointer<HtmlVisitor> HtmlVisitor::makeWorkerVisitor() const
+{
+    if (m_visitorFactory) {
+        return m_visitorFactory();
+    }
+
+    return QSharedPointer<HtmlVisitor>::create();
+}
+
+void HtmlVisitor::processItems(QSharedPointer<Document> doc)
+{
+    const qsizetype threads = (m_maxThreadCount > 0 ? m_maxThreadCount : QThread::idealThreadCount());
+    const auto count = doc->items().size();
+
+    if (threads == 1 || count < 2) {
+        this->process(doc);
+
+        return;
+    }
+
+    this->setDocument(doc);
+
+    // A few batches per thread, as items differ in size.
+    const auto batchSize = std::max<qsizetype>(1, (count + threads * 4 - 1) / (threads * 4));
+
+    struct Batch {
+        qsizetype m_first = 0;
+        qsizetype m_last = 0;
+        QSharedPointer<HtmlVisitor> m_visitor;
+    };
+
+    QVector<Batch> batches;
+    batches.reserve(count / batchSize + 1);
+
+    // Numbers of footnotes are assigned in order of first references, so references are collected
+    // in order, and each batch starts from the state of footnotes at its first item. Count of
+    // references and number of the current reference are equal out of footnotes.
+    const auto syncCurrent = [](QVector<FootnoteRefStuff> &fns) {
+        for (auto &fn : fns) {
+            fn.m_current = fn.m_count;
+        }
+    };
+
+    m_justCollectFootnoteRefs = true;
+
+    for (qsizetype i = 0; i < count; ++i) {
+        if (i % batchSize == 0) {
+            Batch batch = {i, std::min(i + batchSize, count), makeWorkerVisitor()};
+
+            batch.m_visitor->m_doc = m_doc;
+            batch.m_visitor->m_anchors = m_anchors;
+            batch.m_visitor->m_idsMap = m_idsMap;
+            batch.m_visitor->m_isWrappedInArticle = m_isWrappedInArticle;
+            batch.m_visitor->m_sink = nullptr;
+            batch.m_visitor->m_html.clear();
+            batch.m_visitor->m_fns = m_fns;
+            batch.m_visitor->m_fnsIndex = m_fnsIndex;
+            syncCurrent(batch.m_visitor->m_fns);
+
+            batches.push_back(batch);
+        }
+
+        this->processTopLevelItem(doc->items().at(i).get());
+    }
+
+    m_justCollectFootnoteRefs = false;
+
+    syncCurrent(m_fns);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(static_cast<int>(threads));
+
+    for (const auto &batch : std::as_const(batches)) {
+        pool.start([batch]() {
+            for (auto i = batch.m_first; i < batch.m_last; ++i) {
+                auto item = batch.m_visitor->m_doc->items().at(i).get();
+
+                batch.m_visitor->processTopLevelItem(item);
+                batch.m_visitor->onTopLevelItemProcessed(item);
+            }
+        });
+    }
+
+    pool.waitForDone();
+
+    for (const auto &batch : std::as_const(batches)) {
+        m_html.push_back(batch.m_visitor->m_html);
+
+        flushHtml();
+    }
+}
+
+void HtmlVisitor::flushHtml(bool force)
+{
+    if (m_sink && !m_html.isEmpty() && (force || m_html.size() >= m_chunkSize)) {
+        const auto data = m_html.toUtf8();
+
+        (*m_sink)(data);
+
+        // Memory is kept for the next chunk.
+        m_html.resize(0);
+    }
+}
+
+void HtmlVisitor::onTopLevelItemProcessed(Item *)
+{
+    flushHtml();
+}
+
 QString HtmlVisitor::getId(Item *item) const
 {
     if (item->type() != ItemType::Heading) {
@@ -447,7 +699,7 @@ void HtmlVisitor::onLink(Link *l)
         openStyle(l->openStyles());
 
         m_html.push_back(QStringLiteral("<a href=\""));
-        m_html.push_back(url);
+        m_html.push_back(prepareAttributeForHtml(url));
         m_html.push_back(QStringLiteral("\""));
         printId(l);
         m_html.push_back(QStringLiteral(">"));
@@ -482,9 +734,9 @@ void HtmlVisitor::onImage(Image *i)
         openStyle(i->openStyles());
 
         m_html.push_back(QStringLiteral("<img src=\""));
-        m_html.push_back(i->url());
+        m_html.push_back(prepareAttributeForHtml(i->url()));
         m_html.push_back(QStringLiteral("\" alt=\""));
-        m_html.push_back(prepareTextForHtml(i->text()));
+        m_html.push_back(prepareAttributeForHtml(i->text()));
         m_html.push_back(QStringLiteral("\" style=\"max-width:100%;\""));
         printId(i);
         m_html.push_back(QStringLiteral(" />"));
@@ -498,9 +750,8 @@ void HtmlVisitor::onFootnoteRef(FootnoteRef *ref)
     const auto fit = this->m_doc->footnotesMap().find(ref->id());
 
     if (fit != this->m_doc->footnotesMap().cend()) {
-        const auto r = std::find_if(m_fns.begin(), m_fns.end(), [&ref](const auto &stuff) {
-            return ref->id() == stuff.m_id;
-        });
+        const auto index = m_fnsIndex.value(ref->id(), -1);
+        const auto r = (index != -1 ? m_fns.begin() + index : m_fns.end());
 
         if (!m_justCollectFootnoteRefs) {
             openStyle(ref->openStyles());
@@ -536,9 +787,10 @@ void HtmlVisitor::onFootnoteRef(FootnoteRef *ref)
                 m_html.push_back(QString::number(m_fns.size() + 1));
             }
 
+            m_fnsIndex.insert(ref->id(), m_fns.size());
             m_fns.push_back({ref->id(), 1, 1});
         } else if (!m_justCollectFootnoteRefs) {
-            m_html.push_back(QString::number(std::distance(m_fns.begin(), r) + 1));
+            m_html.push_back(QString::number(index + 1));
         }
 
         if (!m_justCollectFootnoteRefs) {
@@ -620,14 +872,13 @@ void HtmlVisitor::onFootnotes(const QString &footnoteBackLinkContent)
         m_html.push_back(QStringLiteral("<section class=\"footnotes\"><ol dir=\"auto\">"));
     }
 
-    int i = 1;
-
-    // This copy is needed. First time we want to iterate on non-modified container.
-    const auto tmpFns = m_fns;
+    // Footnotes referenced for the first time in footnotes are added to the end, they are not
+    // walked through here. Back links counts are collected first, as a footnote may be referenced
+    // in the following footnotes.
     m_justCollectFootnoteRefs = true;
 
-    for (const auto &id : tmpFns) {
-        const auto fit = this->m_doc->footnotesMap().find(id.m_id);
+    for (qsizetype i = 0, count = m_fns.size(); i < count; ++i) {
+        const auto fit = this->m_doc->footnotesMap().find(m_fns.at(i).m_id);
 
         if (fit != this->m_doc->footnotesMap().cend()) {
             this->onFootnote(fit->get());
@@ -637,11 +888,14 @@ void HtmlVisitor::onFootnotes(const QString &footnoteBackLinkContent)
     m_justCollectFootnoteRefs = false;
     m_dontIncrementFootnoteCount = true;
 
-    for (const auto &id : m_fns) {
+    for (qsizetype i = 0, count = m_fns.size(); i < count; ++i) {
+        const auto id = m_fns.at(i);
+
+        flushHtml();
+
         m_html.push_back(QStringLiteral("<li id=\""));
         m_html.push_back(id.m_id);
         m_html.push_back(QStringLiteral("\">"));
-        ++i;
 
         const auto fit = this->m_doc->footnotesMap().find(id.m_id);
 
@@ -652,11 +906,11 @@ void HtmlVisitor::onFootnotes(const QString &footnoteBackLinkContent)
                 QString backRef;
                 qsizetype backRefPos = m_html.endsWith(QStringLiteral("</p>")) ? 4 : 0;
 
-                for (qsizetype i = 1; i <= id.m_count; ++i) {
+                for (qsizetype ref = 1; ref <= id.m_count; ++ref) {
                     backRef.push_back(QStringLiteral("<a href=\"#ref-"));
                     backRef.push_back(id.m_id);
                     backRef.push_back(QStringLiteral("-"));
-                    backRef.push_back(QString::number(i));
+                    backRef.push_back(QString::number(ref));
                     backRef.push_back(QStringLiteral("\">"));
                     backRef.push_back(footnoteBackLinkContent);
                     backRef.push_back(QStringLiteral("</a>"));
@@ -693,12 +947,12 @@ QString HtmlVisitor::headingIdToHtml(Heading *h)
 
 QString HtmlVisitor::prepareTextForHtml(const QString &t)
 {
-    auto tmp = t;
-    tmp.replace(QLatin1Char('&'), QStringLiteral("&amp;"));
-    tmp.replace(QLatin1Char('<'), QStringLiteral("&lt;"));
-    tmp.replace(QLatin1Char('>'), QStringLiteral("&gt;"));
+    return escapeHtml(t, false);
+}
 
-    return tmp;
+QString HtmlVisitor::prepareAttributeForHtml(const QString &t)
+{
+    return escapeHtml(t, true);
 }
 
 QString HtmlVisitor::tableAlignmentToHtml(typename Table::Alignment a)
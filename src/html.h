@@ -11,11 +11,28 @@
 #include "visitor.h"
 
 // Qt include.
+#include <QByteArrayView>
 #include <QHash>
+#include <QIODevice>
+#include <QSharedPointer>
+
+// C++ include.
+#include <functional>
 
 namespace MD
 {
 
+/*!
+ * \typealias MD::HtmlSink
+ * \inmodule md4qt
+ * \inheaderfile md4qt/html.h
+ *
+ * \brief Receiver of HTML.
+ *
+ * Function that receives chunks of UTF-8 encoded HTML in order.
+ */
+using HtmlSink = std::function<void(QByteArrayView)>;
+
 namespace details
 {
 
@@ -98,7 +115,99 @@ public:
                            bool wrappedInArticle = true,
                            const IdsMap *idsMap = nullptr);
 
+    /*!
+     * Walk through the document and write HTML into the sink by chunks. Size of a chunk is
+     * not less than m_chunkSize, except the last one, but HTML of a top-level item or a
+     * footnote is never split.
+     *
+     * \a doc Document.
+     *
+     * \a sink Receiver of HTML.
+     *
+     * \a footnoteBackLinkContent String that will be applied as content of back link from footnote.
+     *                            As an example, you can use "<img src="..." />".
+     *
+     * \a wrappedInArticle Wrap HTML with <article> tag?
+     *
+     * \a idsMap Map of IDs to set to corresonding items.
+     */
+    virtual void writeHtml(QSharedPointer<Document> doc,
+                           const HtmlSink &sink,
+                           const QString &footnoteBackLinkContent,
+                           bool wrappedInArticle = true,
+                           const IdsMap *idsMap = nullptr);
+
+    /*!
+     * \typealias MD::details::HtmlVisitor::VisitorFactory
+     * \inmodule md4qt
+     * \inheaderfile md4qt/html.h
+     *
+     * \brief Factory of visitors for worker threads.
+     */
+    using VisitorFactory = std::function<QSharedPointer<HtmlVisitor>()>;
+
+    /*!
+     * Returns maximum count of threads used in rendering.
+     */
+    inline qsizetype maxThreadCount() const
+    {
+        return m_maxThreadCount;
+    }
+
+    /*!
+     * Sets maximum count of threads used in rendering.
+     *
+     * If count is not 1 top-level items of the document are rendered concurrently by batches,
+     * each batch by its own visitor in a thread pool, and HTML of batches is concatenated in order.
+     * Numbers of footnotes and footnote references are assigned before rendering in a pass that
+     * just collects footnote references, so HTML is the same as in sequential rendering.
+     * 0 means QThread::idealThreadCount(). By default is 1, i.e. items are rendered sequentially.
+     *
+     * \note Rendering of a top-level item should not depend on other top-level items, except
+     * footnote references handled by this class. If the visitor is customized, set a visitor
+     * factory with MD::details::HtmlVisitor::setVisitorFactory() that makes visitors of the same type.
+     *
+     * \a count Count of threads.
+     */
+    inline void setMaxThreadCount(qsizetype count)
+    {
+        m_maxThreadCount = count;
+    }
+
+    /*!
+     * Sets factory of visitors used in worker threads in rendering.
+     *
+     * Factory is invoked from the thread of rendering. By default MD::details::HtmlVisitor is created.
+     *
+     * \a factory Factory.
+     */
+    inline void setVisitorFactory(const VisitorFactory &factory)
+    {
+        m_visitorFactory = factory;
+    }
+
 protected:
+    /*!
+     * Walks through top-level items of the document, concurrently if it's allowed by
+     * maximum count of threads.
+     *
+     * \a doc Document.
+     */
+    virtual void processItems(QSharedPointer<Document> doc);
+
+    /*!
+     * Returns visitor for a worker thread.
+     */
+    virtual QSharedPointer<HtmlVisitor> makeWorkerVisitor() const;
+
+    /*!
+     * Writes HTML content into the sink if it's not less than m_chunkSize, or if \a force is true.
+     * Does nothing if there is no sink.
+     *
+     * \a force Write regardless of size.
+     */
+    virtual void flushHtml(bool force = false);
+
     /*!
      * Returns ID of item if it's set.
      *
@@ -292,6 +401,13 @@ protected:
      */
     virtual QString prepareTextForHtml(const QString &t);
 
+    /*!
+     * Prepare text to insert into HTML as a value of attribute in quotation marks.
+     *
+     * \a t String.
+     */
+    virtual QString prepareAttributeForHtml(const QString &t);
+
     /*!
      * Returns HTML content for table alignment.
      *
@@ -299,11 +415,21 @@ protected:
      */
     virtual QString tableAlignmentToHtml(typename Table::Alignment a);
 
+    void onTopLevelItemProcessed(Item *item) override;
+
 protected:
     /*!
-     * HTML content.
+     * HTML content. When HTML is written into a sink this is a content not written yet.
      */
     QString m_html;
+    /*!
+     * Receiver of HTML, if any.
+     */
+    const HtmlSink *m_sink = nullptr;
+    /*!
+     * Minimal size of a chunk of HTML passed to the sink.
+     */
+    qsizetype m_chunkSize = 64 * 1024;
     /*!
      * Just collect footnote references?
      */
@@ -352,10 +478,22 @@ protected:
      * Vector of processed footnotes references.
      */
     QVector<FootnoteRefStuff> m_fns;
+    /*!
+     * Indexes in m_fns by ID of footnote.
+     */
+    QHash<QString, qsizetype> m_fnsIndex;
     /*!
      * Map of IDs to set to corresponding items.
      */
     const IdsMap *m_idsMap = nullptr;
+    /*!
+     * Maximum count of threads used in rendering.
+     */
+    qsizetype m_maxThreadCount = 1;
+    /*!
+     * Factory of visitors for worker threads.
+     */
+    VisitorFactory m_visitorFactory;
 }; // class HtmlVisitor
 
 } /* namespace details */
@@ -375,13 +513,16 @@ protected:
  * \a wrapInArticle Wrap HTML with <article> tag?
  *
  * \a idsMap Map of IDs to set to items.
+ *
+ * \a maxThreadCount Maximum count of threads used in rendering, see MD::details::HtmlVisitor::setMaxThreadCount().
  */
 template<class HtmlVisitor = details::HtmlVisitor>
 inline QString toHtml(QSharedPointer<Document> doc,
                       bool wrapInBodyTag = true,
                       const QString &footnoteBackLinkContent = {},
                       bool wrapInArticle = true,
-                      const details::IdsMap *idsMap = nullptr)
+                      const details::IdsMap *idsMap = nullptr,
+                      qsizetype maxThreadCount = 1)
 {
     QString html;
 
@@ -394,6 +535,10 @@ inline QString toHtml(QSharedPointer<Document> doc,
     }
 
     HtmlVisitor visitor;
+    visitor.setMaxThreadCount(maxThreadCount);
+    visitor.setVisitorFactory([]() -> QSharedPointer<details::HtmlVisitor> {
+        return QSharedPointer<HtmlVisitor>::create();
+    });
 
     html.push_back(visitor.toHtml(doc, footnoteBackLinkContent, wrapInArticle, idsMap));
 
@@ -408,6 +553,105 @@ inline QString toHtml(QSharedPointer<Document> doc,
     return html;
 }
 
+/*!
+ * \inheaderfile md4qt/html.h
+ *
+ * \brief Convert Document to HTML and write it into the sink by UTF-8 encoded chunks.
+ *
+ * Whole HTML is never kept in memory.
+ *
+ * \a doc Markdown document.
+ *
+ * \a sink Receiver of HTML.
+ *
+ * \a wrapInBodyTag Wrap HTML into <body> tag?
+ *
+ * \a footnoteBackLinkContent String that will be applied as content of back link from footnote.
+ *                            As an example, you can use "<img src="..." />".
+ *
+ * \a wrapInArticle Wrap HTML with <article> tag?
+ *
+ * \a idsMap Map of IDs to set to items.
+ *
+ * \a maxThreadCount Maximum count of threads used in rendering, see MD::details::HtmlVisitor::setMaxThreadCount().
+ */
+template<class HtmlVisitor = details::HtmlVisitor>
+inline void toHtml(QSharedPointer<Document> doc,
+                   const HtmlSink &sink,
+                   bool wrapInBodyTag = true,
+                   const QString &footnoteBackLinkContent = {},
+                   bool wrapInArticle = true,
+                   const details::IdsMap *idsMap = nullptr,
+                   qsizetype maxThreadCount = 1)
+{
+    if (wrapInBodyTag) {
+        sink(QByteArrayView("<!DOCTYPE html>\n<html><head></head><body>\n"));
+    }
+
+    if (wrapInArticle) {
+        sink(QByteArrayView("<article class=\"markdown-body\">"));
+    }
+
+    HtmlVisitor visitor;
+    visitor.setMaxThreadCount(maxThreadCount);
+    visitor.setVisitorFactory([]() -> QSharedPointer<details::HtmlVisitor> {
+        return QSharedPointer<HtmlVisitor>::create();
+    });
+
+    visitor.writeHtml(doc, sink, footnoteBackLinkContent, wrapInArticle, idsMap);
+
+    if (wrapInArticle) {
+        sink(QByteArrayView("</article>\n"));
+    }
+
+    if (wrapInBodyTag) {
+        sink(QByteArrayView("</body></html>\n"));
+    }
+}
+
+/*!
+ * \inheaderfile md4qt/html.h
+ *
+ * \brief Convert Document to HTML and write it into the device in UTF-8 by chunks.
+ *
+ * Whole HTML is never kept in memory.
+ *
+ * \a doc Markdown document.
+ *
+ * \a device Opened for writing device.
+ *
+ * \a wrapInBodyTag Wrap HTML into <body> tag?
+ *
+ * \a footnoteBackLinkContent String that will be applied as content of back link from footnote.
+ *                            As an example, you can use "<img src="..." />".
+ *
+ * \a wrapInArticle Wrap HTML with <article> tag?
+ *
+ * \a idsMap Map of IDs to set to items.
+ *
+ * \a maxThreadCount Maximum count of threads used in rendering, see MD::details::HtmlVisitor::setMaxThreadCount().
+ */
+template<class HtmlVisitor = details::HtmlVisitor>
+inline void toHtml(QSharedPointer<Document> doc,
+                   QIODevice &device,
+                   bool wrapInBodyTag = true,
+                   const QString &footnoteBackLinkContent = {},
+                   bool wrapInArticle = true,
+                   const details::IdsMap *idsMap = nullptr,
+                   qsizetype maxThreadCount = 1)
+{
+    toHtml<HtmlVisitor>(
+        doc,
+        [&device](QByteArrayView data) {
+            device.write(data.data(), data.size());
+        },
+        wrapInBodyTag,
+        footnoteBackLinkContent,
+        wrapInArticle,
+        idsMap,
+        maxThreadCount);
+}
+
 } /* namespace MD */
 
 #endif // MD4QT_MD_HTML_H_INCLUDED
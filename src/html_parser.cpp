@@ -181,4 +181,9 @@ bool HTMLParser::mayBreakParagraph(Line &,
     return true;
 }
 
+QString HTMLParser::startSymbols() const
+{
+    return QStringLiteral("<");
+}
+
 } /* namespace MD */
@@ -136,6 +136,11 @@ public:
                            QSharedPointer<Document> doc,
                            Context &ctx) const override;
 
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     */
+    QString startSymbols() const override;
+
 private:
     int m_rule = -1;
     QSharedPointer<RawHtml> m_html;
@@ -164,6 +164,11 @@ bool IndentedCodeParser::mayBreakParagraph(Line &,
     return false;
 }
 
+bool IndentedCodeParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 bool IndentedCodeParser::canBeLazyLine(Line &,
                                        TextStream &,
                                        QSharedPointer<Document>,
@@ -12,6 +12,9 @@
 #include "text_stream.h"
 #include "utils.h"
 
+// C++ include.
+#include <algorithm>
+
 namespace MD
 {
 
@@ -19,6 +22,79 @@ InlineCodeParser::InlineCodeParser() = default;
 
 InlineCodeParser::~InlineCodeParser() = default;
 
+// Fills index with sequences of backticks from the current position of the line to the end of the stream.
+inline void buildBackticksIndex(Line line,
+                                ParagraphStream &stream,
+                                InlineContext::BackticksIndex &index)
+{
+    index = {};
+    index.m_built = true;
+    index.m_from = qMakePair(line.lineNumber(), line.position());
+
+    const auto st = stream.currentState();
+
+    while (true) {
+        while (line.position() < line.length()) {
+            skipIf(line, [](const QChar &c) {
+                return c != s_graveAccentChar;
+            });
+
+            const auto startPos = line.position();
+
+            if (startPos < line.length()) {
+                skipIf(line, [](const QChar &c) {
+                    return c == s_graveAccentChar;
+                });
+
+                index.m_sequences[line.position() - startPos].m_positions.append(qMakePair(line.lineNumber(), startPos));
+            }
+        }
+
+        if (stream.atEnd()) {
+            break;
+        }
+
+        line = stream.readLine();
+    }
+
+    stream.restoreState(&st);
+}
+
+// Returns whether there is a sequence of backticks of the given length after the current position of the line.
+inline bool hasClosingBackticks(const Line &line,
+                                ParagraphStream &stream,
+                                InlineContext &ctx,
+                                qsizetype length)
+{
+    auto &index = ctx.backticks();
+    const auto from = qMakePair(line.lineNumber(), line.position());
+
+    if (!index.m_built || from < index.m_from) {
+        buildBackticksIndex(line, stream, index);
+    }
+
+    const auto it = index.m_sequences.find(length);
+
+    if (it == index.m_sequences.end()) {
+        return false;
+    }
+
+    auto &sequences = it.value();
+
+    if (sequences.m_current > 0 && sequences.m_positions.at(sequences.m_current - 1) >= from) {
+        sequences.m_current = std::distance(
+            sequences.m_positions.cbegin(),
+            std::lower_bound(sequences.m_positions.cbegin(), sequences.m_positions.cend(), from));
+    }
+
+    while (sequences.m_current < sequences.m_positions.size()
+           && sequences.m_positions.at(sequences.m_current) < from) {
+        ++sequences.m_current;
+    }
+
+    return (sequences.m_current < sequences.m_positions.size());
+}
+
 bool InlineCodeParser::check(Line &line,
                              ParagraphStream &stream,
                              InlineContext &ctx,
@@ -46,6 +122,16 @@ bool InlineCodeParser::check(Line &line,
         const auto sState = stream.currentState();
 
         const auto endPos = line.position();
+
+        // Without closing sequence there is nothing to scan.
+        if (!hasClosingBackticks(line, stream, ctx, endPos - startPos)) {
+            stream.restoreStateBefore(sState);
+            line = stream.readLine();
+            line.restoreState(&lState);
+
+            return false;
+        }
+
         auto startCodePos = endPos;
         auto startCodeLine = line.lineNumber();
         auto endCodePos = startCodePos;
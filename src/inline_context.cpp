@@ -13,4 +13,14 @@ InlineContext::InlineContext() = default;
 
 InlineContext::~InlineContext() = default;
 
+void InlineContext::clear()
+{
+    m_delims.clear();
+    m_openers.clear();
+    m_inlines.clear();
+    m_openStyles.clear();
+    m_closeStyles.clear();
+    m_backticks = {};
+}
+
 } /* namespace MD */
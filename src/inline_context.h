@@ -10,7 +10,10 @@
 #include "doc.h"
 
 // Qt include.
+#include <QHash>
+#include <QPair>
 #include <QQueue>
+#include <QVector>
 
 namespace MD
 {
@@ -66,6 +69,10 @@ public:
          * Parser that produced this delimiter.
          */
         InlineParser *m_parser = nullptr;
+        /*!
+         * Length of the sequence of delimiters, the sequence is stored as a single delimiter.
+         */
+        qsizetype m_length = 1;
     }; // struct Emphasis
 
     /*!
@@ -118,11 +125,88 @@ public:
         return m_inlines;
     }
 
+    /*!
+     * \class MD::InlineContext::BackticksIndex
+     * \inmodule md4qt
+     * \inheaderfile md4qt/inline_context.h
+     *
+     * \brief Index of sequences of backticks.
+     *
+     * Sequences of backticks in the rest of the paragraph grouped by length, it's built once
+     * and allows to find closing sequence of an inline code without scanning of the paragraph.
+     */
+    struct BackticksIndex {
+        /*!
+         * \class MD::InlineContext::BackticksIndex::Sequences
+         * \inmodule md4qt
+         * \inheaderfile md4qt/inline_context.h
+         *
+         * \brief Sequences of backticks of the same length.
+         *
+         * Sequences of backticks of the same length.
+         */
+        struct Sequences {
+            /*!
+             * Line numbers and positions of sequences in order of appearance.
+             */
+            QVector<QPair<qsizetype, qsizetype>> m_positions;
+            /*!
+             * Index of the first sequence not before the last looked up position.
+             */
+            qsizetype m_current = 0;
+        }; // struct Sequences
+
+        /*!
+         * Whether the index is built.
+         */
+        bool m_built = false;
+        /*!
+         * Line number and position from which the index was built.
+         */
+        QPair<qsizetype, qsizetype> m_from = {-1, -1};
+        /*!
+         * Sequences by length.
+         */
+        QHash<qsizetype, Sequences> m_sequences;
+    }; // struct BackticksIndex
+
+    /*!
+     * Returns index of sequences of backticks.
+     */
+    inline BackticksIndex &backticks()
+    {
+        return m_backticks;
+    }
+
+    /*!
+     * \typealias MD::InlineContext::DelimiterStack
+     * \inmodule md4qt
+     * \inheaderfile md4qt/inline_context.h
+     *
+     * \brief Type of stack of delimiters.
+     */
+    using DelimiterStack = QVector<Delimiter>;
+
+    /*!
+     * Returns stack of openers used on resolving of emphases.
+     */
+    inline DelimiterStack &openers()
+    {
+        return m_openers;
+    }
+
+    /*!
+     * Clears the context, allocated memory is kept if possible.
+     */
+    void clear();
+
 private:
     DelimiterQueue m_delims;
+    DelimiterStack m_openers;
     InlinesList m_inlines;
     ItemWithOpts::Styles m_openStyles;
     ItemWithOpts::Styles m_closeStyles;
+    BackticksIndex m_backticks;
 }; // class InlineContext
 
 } /* namespace MD */
@@ -0,0 +1,138 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+// md4qt include.
+#include "inline_engine.h"
+#include "emphasis_parser.h"
+#include "gfm_autolink_parser.h"
+#include "reverse_solidus.h"
+
+namespace MD
+{
+
+//
+// InlineEngine::Scratch
+//
+
+struct InlineEngine::Scratch {
+    QVector<Line> m_lines;
+    InlineContext m_context;
+}; // struct Scratch
+
+//
+// InlineEngine
+//
+
+InlineEngine::InlineEngine(Parser &parser)
+    : m_parser(parser)
+{
+}
+
+InlineEngine::~InlineEngine() = default;
+
+void InlineEngine::setInlineParsers(const Parser::InlineParsers &parsers)
+{
+    m_gfmAutolinkParsers.clear();
+
+    for (const auto &p : parsers) {
+        if (p.dynamicCast<GfmAutolinkParser>()) {
+            m_gfmAutolinkParsers.append(p.get());
+        }
+    }
+}
+
+void InlineEngine::parse(ParagraphStream &stream,
+                         InlineContext &ctx,
+                         QSharedPointer<Document> doc,
+                         const QString &path,
+                         const QString &fileName,
+                         QStringList &linksToParse,
+                         const WithPosition &toSkip,
+                         bool gfmAutolinks)
+{
+    m_parser.pushStateOfInliners();
+
+    const auto st = stream.currentState();
+    auto line = stream.readLine();
+
+    while (true) {
+        ReverseSolidusHandler rs;
+
+        while (m_parser.nextInlineStart(line, rs)) {
+            auto processed = false;
+
+            rs.process(line.currentChar());
+
+            if (!(line.position() >= toSkip.startColumn() && line.position() <= toSkip.endColumn())) {
+                const auto &parsers = m_parser.inlineParsersFor(line.currentChar());
+
+                for (const auto &p : parsers) {
+                    if (!gfmAutolinks && m_gfmAutolinkParsers.contains(p.get())) {
+                        continue;
+                    }
+
+                    if (p->check(line, stream, ctx, doc, path, fileName, linksToParse, m_parser, rs)) {
+                        processed = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!processed) {
+                rs.next();
+                line.nextChar();
+            } else {
+                rs.clear();
+            }
+        }
+
+        if (!stream.atEnd()) {
+            line = stream.readLine();
+        } else {
+            break;
+        }
+    }
+
+    stream.restoreState(&st);
+
+    m_parser.popStateOfInliners();
+
+    EmphasisParser::processEmphasises(ctx);
+}
+
+//
+// InlineEngine::Buffers
+//
+
+InlineEngine::Buffers::Buffers(InlineEngine &engine)
+    : m_engine(engine)
+    , m_level(engine.m_level++)
+{
+    if (m_level == m_engine.m_scratches.size()) {
+        m_engine.m_scratches.append(QSharedPointer<Scratch>::create());
+    }
+}
+
+InlineEngine::Buffers::~Buffers()
+{
+    // Memory is kept for the next scan, but items are released.
+    auto &scratch = *m_engine.m_scratches[m_level];
+    scratch.m_lines.clear();
+    scratch.m_context.clear();
+
+    --m_engine.m_level;
+}
+
+QVector<Line> &InlineEngine::Buffers::lines()
+{
+    return m_engine.m_scratches[m_level]->m_lines;
+}
+
+InlineContext &InlineEngine::Buffers::context()
+{
+    return m_engine.m_scratches[m_level]->m_context;
+}
+
+} /* namespace MD */
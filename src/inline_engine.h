@@ -0,0 +1,135 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef MD4QT_MD_INLINE_ENGINE_H_INCLUDED
+#define MD4QT_MD_INLINE_ENGINE_H_INCLUDED
+
+// md4qt include.
+#include "doc.h"
+#include "inline_context.h"
+#include "parser.h"
+#include "text_stream.h"
+
+// Qt include.
+#include <QSharedPointer>
+#include <QStringList>
+#include <QVarLengthArray>
+#include <QVector>
+
+namespace MD
+{
+
+/*!
+ * \class MD::InlineEngine
+ * \inmodule md4qt
+ * \inheaderfile md4qt/inline_engine.h
+ *
+ * \brief Inline parsing engine.
+ *
+ * Scans text of paragraphs, cells of tables, headings and texts of links with inline parsers
+ * of the parser. Each parser has its own engine, scratch buffers of the engine are reused
+ * from one scan to another, so memory for them is allocated once per nesting level.
+ */
+class InlineEngine final
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * \a parser Parser which inline parsers are used.
+     */
+    explicit InlineEngine(Parser &parser);
+    ~InlineEngine();
+
+    /*!
+     * Should be invoked on each change of pipeline of inline parsers.
+     *
+     * \a parsers Pipeline.
+     */
+    void setInlineParsers(const Parser::InlineParsers &parsers);
+
+    /*!
+     * \class MD::InlineEngine::Buffers
+     * \inmodule md4qt
+     * \inheaderfile md4qt/inline_engine.h
+     *
+     * \brief Scratch buffers of one scan.
+     *
+     * Buffers are acquired on construction and released on destruction. Scans may be nested (text
+     * of a link is scanned during the scan of the paragraph), each nesting level has its own buffers.
+     */
+    class Buffers final
+    {
+    public:
+        /*!
+         * Acquires empty buffers.
+         *
+         * \a engine Engine.
+         */
+        explicit Buffers(InlineEngine &engine);
+        ~Buffers();
+
+        /*!
+         * Returns storage for lines of the text.
+         */
+        QVector<Line> &lines();
+
+        /*!
+         * Returns inline context.
+         */
+        InlineContext &context();
+
+    private:
+        InlineEngine &m_engine;
+        qsizetype m_level;
+
+        Q_DISABLE_COPY(Buffers)
+    }; // class Buffers
+
+    /*!
+     * Parses inlines of the text in the stream, and resolves emphases. State of the stream is restored.
+     *
+     * \a stream Text.
+     *
+     * \a ctx Inline context.
+     *
+     * \a doc Document.
+     *
+     * \a path Absolute path of the Markdown file.
+     *
+     * \a fileName File name of the Markdown file.
+     *
+     * \a linksToParse Links that should be parsed too.
+     *
+     * \a toSkip Columns of the text where inlines are not started, used for label of heading.
+     *
+     * \a gfmAutolinks Whether GFM autolinks are allowed, they are not allowed in text of link.
+     */
+    void parse(ParagraphStream &stream,
+               InlineContext &ctx,
+               QSharedPointer<Document> doc,
+               const QString &path,
+               const QString &fileName,
+               QStringList &linksToParse,
+               const WithPosition &toSkip = {},
+               bool gfmAutolinks = true);
+
+private:
+    friend class Buffers;
+
+    struct Scratch;
+
+    Parser &m_parser;
+    // Scratch buffers by nesting level.
+    QVector<QSharedPointer<Scratch>> m_scratches;
+    qsizetype m_level = 0;
+    QVarLengthArray<const InlineParser *, 1> m_gfmAutolinkParsers;
+
+    Q_DISABLE_COPY(InlineEngine)
+}; // class InlineEngine
+
+} /* namespace MD */
+
+#endif // MD4QT_MD_INLINE_ENGINE_H_INCLUDED
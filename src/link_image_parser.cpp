@@ -6,9 +6,8 @@
 // md4qt include.
 #include "link_image_parser.h"
 #include "constants.h"
-#include "emphasis_parser.h"
-#include "gfm_autolink_parser.h"
 #include "inline_context.h"
+#include "inline_engine.h"
 #include "paragraph_parser.h"
 #include "parser.h"
 #include "reverse_solidus.h"
@@ -77,7 +76,7 @@ void LinkImageParser::clearLinkOpenersAndCtx(qsizetype idx,
     for (qsizetype i = 0; i < ctx.delims().size(); ++i) {
         auto &d = ctx.delims()[i];
 
-        if (isIn(where, {d.m_pos, d.m_line, d.m_pos, d.m_line})) {
+        if (isIn(where, {d.m_pos, d.m_line, d.m_pos + d.m_length - 1, d.m_line})) {
             ctx.delims().removeAt(i--);
         }
     }
@@ -175,83 +174,39 @@ LinkImageParser::parseDescription(const State::Delim &startParagraphDelim,
     line.restoreState(&startParagraphDelim.m_lineState);
 
     const auto startLine = line.lineNumber();
-    auto endLine = startLine;
 
     auto paragraph = QSharedPointer<Paragraph>::create();
     paragraph->setStartColumn(line.position());
     paragraph->setStartLine(startLine);
     paragraph->setEndColumn(line.length() - 1);
-    paragraph->setEndLine(endLine);
+    paragraph->setEndLine(startLine);
 
     QString text = line.slicedCopy(line.position());
 
-    ParagraphStream::HashedLines lines;
-    lines.insert(line.lineNumber(), line);
+    InlineEngine::Buffers buffers(parser.inlineEngine());
+    auto &lines = buffers.lines();
+    lines.append(line);
 
     while (stream.currentState() != endParagraphDelim.m_streamState) {
         line = stream.readLine();
 
         if (stream.currentState() == endParagraphDelim.m_streamState) {
             line = line.sliced(0, endParagraphDelim.m_lineState.m_pos + 1);
-            lines.insert(line.lineNumber(), line);
-            endLine = line.lineNumber();
             paragraph->setEndColumn(line.length() - 1);
-            paragraph->setEndLine(endLine);
-        } else {
-            lines.insert(line.lineNumber(), line);
+            paragraph->setEndLine(line.lineNumber());
         }
 
+        lines.append(line);
+
         text.append(s_spaceChar);
         text.append(line.slicedCopy(line.position()));
     }
 
-    parser.pushStateOfInliners();
-
-    ParagraphStream pStream(lines, startLine, endLine);
-    const auto pSState = pStream.currentState();
-    InlineContext inlineContext;
-
-    line = pStream.readLine();
-
-    while (true) {
-        ReverseSolidusHandler rs;
-
-        while (line.position() < line.length()) {
-            auto processed = false;
-
-            rs.process(line.currentChar());
-
-            const auto parsers = parser.inlineParsersFor(line.currentChar());
-
-            for (const auto &p : parsers) {
-                if (!p.dynamicCast<GfmAutolinkParser>()
-                    && p->check(line, pStream, inlineContext, doc, path, fileName, linksToParse, parser, rs)) {
-                    processed = true;
-                    break;
-                }
-            }
-
-            if (!processed) {
-                rs.next();
-                line.nextChar();
-            } else {
-                rs.clear();
-            }
-        }
-
-        if (!pStream.atEnd()) {
-            line = pStream.readLine();
-        } else {
-            break;
-        }
-    }
-
-    parser.popStateOfInliners();
+    ParagraphStream pStream(lines, startLine);
 
-    pStream.restoreState(&pSState);
+    parser.inlineEngine().parse(pStream, buffers.context(), doc, path, fileName, linksToParse, {}, false);
 
-    EmphasisParser::processEmphasises(inlineContext);
-    ParagraphParser::makeTextObjects(inlineContext, pStream, paragraph);
+    ParagraphParser::makeTextObjects(buffers.context(), pStream, paragraph);
 
     stream.restoreState(&sState);
 
@@ -343,9 +343,7 @@ ListParser::ListProcessState ListParser::processList(Line &currentLine,
                             item->setDelim({startPos, currentLine.lineNumber(), startPos, currentLine.lineNumber()});
                         }
                     } else if (ctx.children().back().block() && !ctx.children().back().isDiscardForced()) {
-                        Context child(&ctx);
-                        child.applyParentContext(ctx);
-                        ctx.children().enqueue(child);
+                        ctx.appendChild();
                     }
 
                     const auto was = ctx.listDelim(spacesCount);
@@ -646,6 +644,11 @@ bool ListParser::mayBreakParagraph(Line &line,
     return ret;
 }
 
+QString ListParser::startSymbols() const
+{
+    return QStringLiteral("-+*0123456789");
+}
+
 QSharedPointer<Block> ListParser::currentBlock(const Context &) const
 {
     return m_lastListItem;
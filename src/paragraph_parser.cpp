@@ -5,8 +5,8 @@
 
 // md4qt include.
 #include "paragraph_parser.h"
-#include "emphasis_parser.h"
 #include "inline_context.h"
+#include "inline_engine.h"
 #include "parser.h"
 #include "reverse_solidus.h"
 #include "utils.h"
@@ -464,7 +464,7 @@ BlockState ParagraphParser::process(Line &currentLine,
             if (ctx.firstLineNumber() != -1) {
                 const auto mst = stream.currentState();
 
-                InlineContext inlineContext;
+                InlineEngine::Buffers buffers(parser()->inlineEngine());
 
                 auto line = stream.moveTo(ctx.firstLineNumber());
                 const auto st = ctx.startPos(line.lineNumber());
@@ -480,15 +480,13 @@ BlockState ParagraphParser::process(Line &currentLine,
                     parent->appendItem(m_paragraph);
                 }
 
-                ParagraphStream::HashedLines lines;
+                auto &lines = buffers.lines();
                 const auto startLineNumber = line.lineNumber();
-                auto endLineNumber = startLineNumber;
 
                 while (line.lineNumber() < currentLine.lineNumber()) {
                     m_paragraph->setEndColumn(line.length() - 1);
                     m_paragraph->setEndLine(line.lineNumber());
-                    lines.insert(line.lineNumber(), line);
-                    endLineNumber = line.lineNumber();
+                    lines.append(line);
                     line = stream.readLine();
                     const auto st = ctx.startPos(line.lineNumber());
                     line.restoreState(&st);
@@ -496,58 +494,11 @@ BlockState ParagraphParser::process(Line &currentLine,
 
                 stream.restoreState(&mst);
 
-                parser()->pushStateOfInliners();
+                ParagraphStream pStream(lines, startLineNumber);
 
-                ParagraphStream pStream(lines, startLineNumber, endLineNumber);
-                const auto pst = pStream.currentState();
-                line = pStream.readLine();
+                parser()->inlineEngine().parse(pStream, buffers.context(), doc, path, fileName, linksToParse);
 
-                while (true) {
-                    ReverseSolidusHandler rs;
-
-                    while (line.position() < line.length()) {
-                        auto processed = false;
-
-                        rs.process(line.currentChar());
-
-                        const auto parsers = parser()->inlineParsersFor(line.currentChar());
-
-                        for (const auto &p : parsers) {
-                            if (p->check(line,
-                                         pStream,
-                                         inlineContext,
-                                         doc,
-                                         path,
-                                         fileName,
-                                         linksToParse,
-                                         *parser(),
-                                         rs)) {
-                                processed = true;
-                                break;
-                            }
-                        }
-
-                        if (!processed) {
-                            rs.next();
-                            line.nextChar();
-                        } else {
-                            rs.clear();
-                        }
-                    }
-
-                    if (!pStream.atEnd()) {
-                        line = pStream.readLine();
-                    } else {
-                        break;
-                    }
-                }
-
-                pStream.restoreState(&pst);
-
-                parser()->popStateOfInliners();
-
-                EmphasisParser::processEmphasises(inlineContext);
-                makeTextObjects(inlineContext, pStream, m_paragraph);
+                makeTextObjects(buffers.context(), pStream, m_paragraph);
             }
 
             m_finished = true;
@@ -583,6 +534,11 @@ bool ParagraphParser::mayBreakParagraph(Line &,
     return false;
 }
 
+bool ParagraphParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 bool ParagraphParser::canBeLazyLine(Line &,
                                     TextStream &,
                                     QSharedPointer<Document>,
@@ -137,6 +137,11 @@ public:
                            QSharedPointer<Document> doc,
                            Context &ctx) const override;
 
+    /*!
+     * Returns whether result of check() without processing depends only on the line and on indents.
+     */
+    bool checkDependsOnIndentsOnly() const override;
+
     /*!
      * Returns whether this kind of block can be a lazy line.
      *
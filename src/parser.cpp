@@ -19,11 +19,13 @@
 #include "html_parser.h"
 #include "indented_code_parser.h"
 #include "inline_code_parser.h"
+#include "inline_engine.h"
 #include "inline_html_parser.h"
 #include "inline_math_parser.h"
 #include "link_image_parser.h"
 #include "list_parser.h"
 #include "paragraph_parser.h"
+#include "reverse_solidus.h"
 #include "setext_heading_parser.h"
 #include "strikethrough_emphasis_parser.h"
 #include "table_parser.h"
@@ -34,7 +36,12 @@
 #include "yaml_parser.h"
 
 // Qt include.
+#include <QFile>
 #include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QThreadPool>
 
 // C++ include.
 #include <algorithm>
@@ -48,6 +55,7 @@ namespace MD
 //
 
 Parser::Parser()
+    : m_inlineEngine(QSharedPointer<InlineEngine>::create(*this))
 {
     setBlockParsers(makeDefaultBlockParsersPipeline(this));
     setInlineParsers(makeDefaultInlineParsersPipeline());
@@ -61,7 +69,11 @@ QSharedPointer<Document> Parser::parse(const QString &fileName,
 {
     QSharedPointer<Document> doc(new Document);
 
-    parseFile(fileName, recursive, doc, ext);
+    if (recursive && m_maxThreadCount != 1) {
+        parseFilesConcurrently(fileName, doc, ext, {});
+    } else {
+        parseFile(fileName, recursive, doc, ext);
+    }
 
     reset();
 
@@ -74,7 +86,24 @@ QSharedPointer<Document> Parser::parse(QTextStream &stream,
 {
     QSharedPointer<Document> doc(new Document);
 
-    parseStream(stream, path, fileName, false, doc, QStringList());
+    TextStream s(stream);
+
+    parseStream(s, path, fileName, false, doc, QStringList());
+
+    reset();
+
+    return doc;
+}
+
+QSharedPointer<Document> Parser::parse(QByteArrayView data,
+                                       const QString &path,
+                                       const QString &fileName)
+{
+    QSharedPointer<Document> doc(new Document);
+
+    TextStream s(data);
+
+    parseStream(s, path, fileName, false, doc, QStringList());
 
     reset();
 
@@ -99,13 +128,600 @@ QSharedPointer<Document> Parser::parse(const QString &fileName,
         wd = workingDirectory.sliced(0, i + 1);
     }
 
-    parseFile(fileName, recursive, doc, ext, nullptr, wd);
+    if (recursive && m_maxThreadCount != 1) {
+        parseFilesConcurrently(fileName, doc, ext, wd);
+    } else {
+        parseFile(fileName, recursive, doc, ext, nullptr, wd);
+    }
 
     reset();
 
     return doc;
 }
 
+// Returns positions of the first characters of lines.
+inline QVector<qsizetype> linesStarts(QStringView text)
+{
+    QVector<qsizetype> starts = {0};
+
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        if (text[i] == s_carriageReturnChar && i + 1 < text.size() && text[i + 1] == s_newLineChar) {
+            ++i;
+        }
+
+        if (text[i] == s_newLineChar || text[i] == s_carriageReturnChar) {
+            starts.append(i + 1);
+        }
+    }
+
+    return starts;
+}
+
+// Returns count of line breaks in the text.
+inline qsizetype countLineBreaks(QStringView text)
+{
+    qsizetype count = 0;
+
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        if (text[i] == s_newLineChar
+            || (text[i] == s_carriageReturnChar && (i + 1 == text.size() || text[i + 1] != s_newLineChar))) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+// Returns position of the line break after the line started at the given position.
+inline qsizetype endOfLine(QStringView text,
+                           qsizetype start)
+{
+    for (; start < text.size(); ++start) {
+        if (text[start] == s_newLineChar || text[start] == s_carriageReturnChar) {
+            break;
+        }
+    }
+
+    return start;
+}
+
+// Returns whether the line is blank, lines out of the text are blank.
+inline bool isBlankLine(QStringView text,
+                        const QVector<qsizetype> &starts,
+                        qsizetype line)
+{
+    if (line < 0 || line >= starts.size()) {
+        return true;
+    }
+
+    for (qsizetype i = starts.at(line), end = endOfLine(text, i); i < end; ++i) {
+        if (text[i] != s_spaceChar && text[i] != s_tabChar) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns whether the item is a container block, its state affects blocks after it.
+inline bool isContainer(Item *item)
+{
+    return (item->type() == ItemType::List || item->type() == ItemType::Blockquote);
+}
+
+inline bool containsHeading(Item *item)
+{
+    switch (item->type()) {
+    case ItemType::Heading:
+        return true;
+
+    case ItemType::Blockquote:
+    case ItemType::List:
+    case ItemType::ListItem:
+    case ItemType::Footnote: {
+        const auto &items = static_cast<Block *>(item)->items();
+
+        return std::any_of(items.cbegin(), items.cend(), [](const auto &i) {
+            return containsHeading(i.get());
+        });
+    }
+
+    default:
+        return false;
+    }
+}
+
+inline void shiftPosition(WithPosition &pos,
+                          qsizetype delta)
+{
+    if (pos.startLine() >= 0) {
+        pos.setStartLine(pos.startLine() + delta);
+    }
+
+    if (pos.endLine() >= 0) {
+        pos.setEndLine(pos.endLine() + delta);
+    }
+}
+
+inline void shiftPositions(Item *item,
+                           qsizetype delta);
+
+inline void shiftChildren(Block *block,
+                          qsizetype delta)
+{
+    for (const auto &item : block->items()) {
+        shiftPositions(item.get(), delta);
+    }
+}
+
+inline void shiftStyles(ItemWithOpts *item,
+                        qsizetype delta)
+{
+    if (!item->openStyles().isEmpty()) {
+        auto styles = item->openStyles();
+
+        for (auto &s : styles) {
+            shiftPosition(s, delta);
+        }
+
+        item->setOpenStyles(styles);
+    }
+
+    if (!item->closeStyles().isEmpty()) {
+        auto styles = item->closeStyles();
+
+        for (auto &s : styles) {
+            shiftPosition(s, delta);
+        }
+
+        item->setCloseStyles(styles);
+    }
+}
+
+// Shifts all line numbers in the item and its children.
+inline void shiftPositions(Item *item,
+                           qsizetype delta)
+{
+    shiftPosition(*item, delta);
+
+    if (auto opts = dynamic_cast<ItemWithOpts *>(item)) {
+        shiftStyles(opts, delta);
+    }
+
+    switch (item->type()) {
+    case ItemType::Heading: {
+        auto h = static_cast<Heading *>(item);
+        auto delims = h->delims();
+
+        for (auto &d : delims) {
+            shiftPosition(d, delta);
+        }
+
+        h->setDelims(delims);
+
+        auto label = h->labelPos();
+        shiftPosition(label, delta);
+        h->setLabelPos(label);
+
+        if (h->text()) {
+            shiftPositions(h->text().get(), delta);
+        }
+    } break;
+
+    case ItemType::Blockquote: {
+        auto b = static_cast<Blockquote *>(item);
+        auto delims = b->delims();
+
+        for (auto &d : delims) {
+            shiftPosition(d, delta);
+        }
+
+        b->setDelims(delims);
+        shiftChildren(b, delta);
+    } break;
+
+    case ItemType::ListItem: {
+        auto l = static_cast<ListItem *>(item);
+
+        auto delim = l->delim();
+        shiftPosition(delim, delta);
+        l->setDelim(delim);
+
+        auto taskDelim = l->taskDelim();
+        shiftPosition(taskDelim, delta);
+        l->setTaskDelim(taskDelim);
+
+        shiftChildren(l, delta);
+    } break;
+
+    case ItemType::Link:
+    case ItemType::Image: {
+        auto l = static_cast<LinkBase *>(item);
+
+        auto textPos = l->textPos();
+        shiftPosition(textPos, delta);
+        l->setTextPos(textPos);
+
+        auto urlPos = l->urlPos();
+        shiftPosition(urlPos, delta);
+        l->setUrlPos(urlPos);
+
+        if (l->p()) {
+            shiftPositions(l->p().get(), delta);
+        }
+
+        if (item->type() == ItemType::Link && static_cast<Link *>(item)->img()) {
+            shiftPositions(static_cast<Link *>(item)->img().get(), delta);
+        }
+    } break;
+
+    case ItemType::Code:
+    case ItemType::Math: {
+        auto c = static_cast<Code *>(item);
+
+        auto startDelim = c->startDelim();
+        shiftPosition(startDelim, delta);
+        c->setStartDelim(startDelim);
+
+        auto endDelim = c->endDelim();
+        shiftPosition(endDelim, delta);
+        c->setEndDelim(endDelim);
+
+        auto syntaxPos = c->syntaxPos();
+        shiftPosition(syntaxPos, delta);
+        c->setSyntaxPos(syntaxPos);
+    } break;
+
+    case ItemType::Table:
+        for (const auto &row : static_cast<Table *>(item)->rows()) {
+            shiftPositions(row.get(), delta);
+        }
+        break;
+
+    case ItemType::TableRow:
+        for (const auto &cell : static_cast<TableRow *>(item)->cells()) {
+            shiftPositions(cell.get(), delta);
+        }
+        break;
+
+    case ItemType::FootnoteRef: {
+        auto f = static_cast<FootnoteRef *>(item);
+
+        auto idPos = f->idPos();
+        shiftPosition(idPos, delta);
+        f->setIdPos(idPos);
+    } break;
+
+    case ItemType::Footnote: {
+        auto f = static_cast<Footnote *>(item);
+
+        auto idPos = f->idPos();
+        shiftPosition(idPos, delta);
+        f->setIdPos(idPos);
+
+        shiftChildren(f, delta);
+    } break;
+
+    default:
+        if (auto b = dynamic_cast<Block *>(item)) {
+            shiftChildren(b, delta);
+        }
+        break;
+    }
+}
+
+// Returns whether both items have the same kind and place, taking into account the delta of lines.
+inline bool isSameBlock(Item *newItem,
+                        Item *oldItem,
+                        qsizetype delta)
+{
+    return (newItem->type() == oldItem->type()
+            && newItem->startColumn() == oldItem->startColumn()
+            && newItem->startLine() == oldItem->startLine() + delta
+            && newItem->endColumn() == oldItem->endColumn()
+            && newItem->endLine() == oldItem->endLine() + delta);
+}
+
+ReparsedRange Parser::reparse(QSharedPointer<Document> doc,
+                              const QString &text,
+                              const TextEdit &edit,
+                              const QString &path,
+                              const QString &fileName)
+{
+    ReparsedRange range;
+
+    QString newText = text;
+    newText.replace(edit.m_position, edit.m_removed, edit.m_inserted);
+
+    const auto reparseAll = [&]() -> ReparsedRange {
+        range = {};
+        range.m_removed = doc->items();
+
+        QSharedPointer<Document> newDoc(new Document);
+        TextStream stream(newText);
+
+        parseStream(stream, path, fileName, false, newDoc, QStringList());
+
+        reset();
+
+        doc->setItems(newDoc->items());
+        doc->setFootnotesMap(newDoc->footnotesMap());
+        doc->setLabeledLinks(newDoc->labeledLinks());
+        doc->setLabeledHeadings(newDoc->labeledHeadings());
+        doc->setAuxLabelsMap(newDoc->auxLabelsMap());
+
+        range.m_inserted = doc->items();
+
+        return range;
+    };
+
+    const auto &items = doc->items();
+
+    // Only not recursive document can be reparsed partially, the first item is an anchor.
+    if (items.isEmpty() || items.front()->type() != ItemType::Anchor) {
+        return reparseAll();
+    }
+
+    for (auto it = std::next(items.cbegin()), last = items.cend(); it != last; ++it) {
+        if ((*it)->type() == ItemType::Anchor || (*it)->type() == ItemType::PageBreak) {
+            return reparseAll();
+        }
+    }
+
+    const auto starts = linesStarts(text);
+    const auto lineOfPosition = [&starts](qsizetype pos) -> qsizetype {
+        return std::distance(starts.cbegin(), std::upper_bound(starts.cbegin(), starts.cend(), pos)) - 1;
+    };
+
+    const auto editFirstLine = lineOfPosition(edit.m_position);
+    const auto editLastLine = lineOfPosition(edit.m_position + edit.m_removed);
+
+    // Blocks touching the edit and the lines before and after it may change, one more block
+    // on each side is reparsed, and the range is extended up to blank lines around it. Text before
+    // the first reparsed block is not changed, so it's parsed from a clean state. The last reparsed
+    // block should stay the same, then the state after it is the same too. Containers are not
+    // used as boundaries of the range.
+    qsizetype first = 1;
+
+    while (first < items.size() && items.at(first)->endLine() < editFirstLine - 1) {
+        ++first;
+    }
+
+    first = qMax(qsizetype(1), first - 1);
+
+    while (first > 1
+           && (!isBlankLine(text, starts, items.at(first)->startLine() - 1) || isContainer(items.at(first - 1).get()))) {
+        --first;
+    }
+
+    qsizetype last = items.size() - 1;
+
+    while (last >= first && items.at(last)->startLine() > editLastLine + 1) {
+        --last;
+    }
+
+    last = qMin(items.size() - 1, last + 1);
+
+    while (last < items.size() - 1
+           && (!isBlankLine(text, starts, items.at(last)->endLine() + 1) || isContainer(items.at(last).get()))) {
+        ++last;
+    }
+
+    const auto toEnd = (last == items.size() - 1);
+
+    range.m_incremental = true;
+    range.m_firstItem = first;
+    range.m_firstLine = (first == 1 ? 0 : items.at(first)->startLine());
+    range.m_lastLine = (toEnd ? -1 : items.at(last)->endLine());
+
+    const auto start = starts.at(range.m_firstLine);
+    const auto end = (toEnd ? text.size() : endOfLine(text, starts.at(range.m_lastLine)));
+    const auto oldPart = QStringView(text).sliced(start, end - start);
+    const auto newPart = QStringView(newText).sliced(start, end - start + edit.m_inserted.size() - edit.m_removed);
+
+    // Link reference definitions and footnotes are global for the document.
+    if (oldPart.contains(QStringLiteral("]:")) || newPart.contains(QStringLiteral("]:"))) {
+        return reparseAll();
+    }
+
+    for (qsizetype i = first; i <= last; ++i) {
+        if (containsHeading(items.at(i).get())) {
+            return reparseAll();
+        }
+    }
+
+    // Footnotes and link reference definitions are not in the items, they should not be
+    // between the reparsed blocks and their neighbours.
+    const auto touchesRange = [&](const WithPosition &pos) -> bool {
+        return (pos.endLine() > items.at(first - 1)->endLine()
+                && (toEnd || pos.startLine() < items.at(last + 1)->startLine()));
+    };
+
+    for (const auto &f : doc->footnotesMap()) {
+        if (touchesRange(*f)) {
+            return reparseAll();
+        }
+    }
+
+    for (const auto &l : doc->labeledLinks()) {
+        if (touchesRange(*l)) {
+            return reparseAll();
+        }
+    }
+
+    range.m_lineDelta = countLineBreaks(newPart) - countLineBreaks(oldPart);
+
+    QSharedPointer<Document> part(new Document);
+    part->setLabeledLinks(doc->labeledLinks());
+    part->setFootnotesMap(doc->footnotesMap());
+
+    TextStream stream(newText);
+    stream.setLinesRange(range.m_firstLine, toEnd ? -1 : range.m_lastLine + range.m_lineDelta);
+
+    QStringList linksToParse;
+
+    parse(stream, part, path, fileName, linksToParse);
+
+    reset();
+
+    if (!part->labeledHeadings().isEmpty()) {
+        return reparseAll();
+    }
+
+    for (const auto &item : part->items()) {
+        if (containsHeading(item.get())) {
+            return reparseAll();
+        }
+    }
+
+    if (!toEnd
+        && (part->isEmpty() || !isSameBlock(part->items().back().get(), items.at(last).get(), range.m_lineDelta))) {
+        return reparseAll();
+    }
+
+    range.m_removed = items.mid(first, last - first + 1);
+    range.m_inserted = part->items();
+
+    auto newItems = items.mid(0, first);
+    newItems.append(part->items());
+
+    for (qsizetype i = last + 1; i < items.size(); ++i) {
+        if (range.m_lineDelta) {
+            shiftPositions(items.at(i).get(), range.m_lineDelta);
+        }
+
+        newItems.append(items.at(i));
+    }
+
+    if (range.m_lineDelta && !toEnd) {
+        for (const auto &f : doc->footnotesMap()) {
+            if (f->startLine() > range.m_lastLine) {
+                shiftPositions(f.get(), range.m_lineDelta);
+            }
+        }
+
+        for (const auto &l : doc->labeledLinks()) {
+            if (l->startLine() > range.m_lastLine) {
+                shiftPositions(l.get(), range.m_lineDelta);
+            }
+        }
+    }
+
+    doc->setItems(newItems);
+
+    return range;
+}
+
+bool Parser::nextInlineStart(Line &line,
+                             ReverseSolidusHandler &rs) const
+{
+    qsizetype skipped = 0;
+
+    while (line.position() < line.length()) {
+        const auto c = line.currentChar();
+
+        if (c == s_reverseSolidusChar || mayStartInline(c)) {
+            break;
+        }
+
+        line.nextChar();
+        ++skipped;
+    }
+
+    // Reverse solidus handler forgets about reverse solidus on the second not processed character.
+    for (qsizetype i = 0, count = qMin(skipped, qsizetype(2)); i < count; ++i) {
+        rs.next();
+    }
+
+    return (line.position() < line.length());
+}
+
+void Parser::setInlineParsers(const InlineParsers &p)
+{
+    m_allInlineParsers = p;
+
+    for (auto &parsers : m_asciiInlineParsers) {
+        parsers.clear();
+    }
+
+    m_otherInlineParsers.clear();
+    m_inlineStarts.reset();
+
+    m_inlineEngine->setInlineParsers(p);
+
+    for (const auto &inl : p) {
+        const auto chars = inl->startDelimiterSymbols();
+
+        for (qsizetype i = 0; i < chars.size(); ++i) {
+            if (chars[i].unicode() < m_asciiInlineParsers.size()) {
+                m_asciiInlineParsers[chars[i].unicode()].append(inl);
+                m_inlineStarts.set(chars[i].unicode());
+            } else {
+                m_otherInlineParsers[chars[i]].append(inl);
+            }
+        }
+    }
+}
+
+void Parser::setBlockParsers(const BlockParsers &p)
+{
+    m_blockParsers = p;
+    m_cacheableBlockStarts.reset();
+    m_checkedLineNumber = -1;
+    m_checkedLine.clear();
+
+    const auto cacheable = [](const BlockParsers &parsers) {
+        return std::all_of(parsers.cbegin(), parsers.cend(), [](const auto &block) {
+            return block->checkDependsOnIndentsOnly();
+        });
+    };
+
+    m_cacheableBlockParsers = cacheable(p);
+
+    for (std::size_t c = 0; c < m_asciiBlockParsers.size(); ++c) {
+        auto &parsers = m_asciiBlockParsers[c];
+
+        parsers.clear();
+
+        for (const auto &block : p) {
+            const auto chars = block->startSymbols();
+
+            if (chars.isEmpty() || chars.contains(QChar(static_cast<char16_t>(c)))) {
+                parsers.append(block);
+            }
+        }
+
+        m_cacheableBlockStarts.set(c, cacheable(parsers));
+    }
+}
+
+const Parser::BlockParsers &Parser::blockParsersFor(Line &line,
+                                                    bool *cacheable) const
+{
+    const auto st = line.currentState();
+
+    skipSpaces(line);
+
+    const auto c = line.currentChar();
+    const auto atEnd = line.atEnd();
+
+    line.restoreState(&st);
+
+    if (!atEnd && c.unicode() < m_asciiBlockParsers.size()) {
+        if (cacheable) {
+            *cacheable = m_cacheableBlockStarts.test(c.unicode());
+        }
+
+        return m_asciiBlockParsers[c.unicode()];
+    }
+
+    if (cacheable) {
+        *cacheable = m_cacheableBlockParsers;
+    }
+
+    return m_blockParsers;
+}
+
 Parser::BlockParsers Parser::makeDefaultBlockParsersPipeline(Parser *parser)
 {
     BlockParsers parsers;
@@ -185,17 +801,7 @@ BlockParser *Parser::checkBlock(Line &line,
                                 QSharedPointer<Document> doc,
                                 Context &ctx) const
 {
-    if (line.position() < line.length()) {
-        for (auto it = m_blockParsers.begin(), last = m_blockParsers.end(); it != last; ++it) {
-            const auto state = (*it)->check(line, stream, doc, ctx, QString(), QString(), true);
-
-            if (state != BlockState::None) {
-                return it->get();
-            }
-        }
-    }
-
-    return nullptr;
+    return checkBlockExcluding(line, stream, doc, ctx, nullptr);
 }
 
 BlockParser *Parser::checkBlockExcluding(Line &line,
@@ -205,20 +811,108 @@ BlockParser *Parser::checkBlockExcluding(Line &line,
                                          const BlockParser *exclude) const
 {
     if (line.position() < line.length()) {
-        for (auto it = m_blockParsers.begin(), last = m_blockParsers.end(); it != last; ++it) {
+        bool cacheable = false;
+        const auto &parsers = blockParsersFor(line, &cacheable);
+
+        CheckedLine checked;
+
+        if (cacheable) {
+            checked.m_state = line.currentState();
+            checked.m_exclude = exclude;
+            checked.m_indentColumnForCheck = ctx.indentColumnForCheck(false);
+            checked.m_indentColumn = ctx.indentColumn();
+            checked.m_firstChildIndent = (ctx.hasChildIndents() ? ctx.firstChildIndent() : -1);
+            checked.m_maxAvailableIndent = ctx.maxAvailableIndent();
+
+            if (m_checkedLineNumber != line.lineNumber()) {
+                m_checkedLineNumber = line.lineNumber();
+                m_checkedLine.clear();
+            }
+
+            for (const auto &c : std::as_const(m_checkedLine)) {
+                if (c.m_state.m_pos == checked.m_state.m_pos
+                    && c.m_state.m_column == checked.m_state.m_column
+                    && c.m_exclude == checked.m_exclude
+                    && c.m_indentColumnForCheck == checked.m_indentColumnForCheck
+                    && c.m_indentColumn == checked.m_indentColumn
+                    && c.m_firstChildIndent == checked.m_firstChildIndent
+                    && c.m_maxAvailableIndent == checked.m_maxAvailableIndent) {
+                    return c.m_block;
+                }
+            }
+        }
+
+        for (auto it = parsers.begin(), last = parsers.end(); it != last; ++it) {
             if (it->get() != exclude) {
                 const auto state = (*it)->check(line, stream, doc, ctx, QString(), QString(), true);
 
                 if (state != BlockState::None) {
-                    return it->get();
+                    checked.m_block = it->get();
+
+                    break;
                 }
             }
         }
+
+        if (cacheable) {
+            m_checkedLine.append(checked);
+        }
+
+        return checked.m_block;
     }
 
     return nullptr;
 }
 
+inline QString makeAnchor(const QString &path,
+                          const QString &fileName)
+{
+    return (path.isEmpty() ? QString(fileName) : QString(path + s_solidusChar + fileName));
+}
+
+// Reads file and returns text stream with its content, or null if file can't be opened.
+// Sets path and file name of the file relative to the working directory.
+inline QSharedPointer<TextStream> readFile(const QFileInfo &fi,
+                                           const QString &workingDirectory,
+                                           QString &path,
+                                           QString &fileName)
+{
+    QFile f(fi.filePath());
+
+    if (!f.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+
+    // Decode mapped file directly into the stream to not keep a raw copy of the data.
+    const auto size = f.size();
+    auto mapped = (size > 0 ? f.map(0, size) : nullptr);
+
+    auto s = QSharedPointer<TextStream>::create(mapped ? QByteArrayView(mapped, size) : QByteArrayView(f.readAll()));
+
+    if (mapped) {
+        f.unmap(mapped);
+    }
+
+    f.close();
+
+    path = fi.absolutePath();
+    fileName = fi.fileName();
+
+    if (!workingDirectory.isEmpty() && path.contains(workingDirectory)) {
+        QFileInfo folder(workingDirectory);
+
+        if (folder.exists() && folder.isDir()) {
+            path = folder.absoluteFilePath();
+
+            auto tmp = fi.absoluteFilePath();
+            fileName = tmp.remove(path);
+            fileName.removeAt(0);
+        }
+    }
+
+    return s;
+}
+
 void Parser::parseFile(const QString &fileName,
                        bool recursive,
                        QSharedPointer<Document> doc,
@@ -233,30 +927,15 @@ void Parser::parseFile(const QString &fileName,
             doc->appendItem(QSharedPointer<PageBreak>(new PageBreak));
         }
 
-        QFile f(fileName);
-
-        if (f.open(QIODevice::ReadOnly)) {
-            QTextStream s(f.readAll());
-            f.close();
+        workingDirectory.replace(s_reverseSolidusChar, s_solidusChar);
 
-            auto wd = fi.absolutePath();
-            auto fn = fi.fileName();
+        QString wd;
+        QString fn;
 
-            workingDirectory.replace(s_reverseSolidusChar, s_solidusChar);
+        auto s = readFile(fi, workingDirectory, wd, fn);
 
-            if (!workingDirectory.isEmpty() && wd.contains(workingDirectory)) {
-                QFileInfo folder(workingDirectory);
-
-                if (folder.exists() && folder.isDir()) {
-                    wd = folder.absoluteFilePath();
-
-                    auto tmp = fi.absoluteFilePath();
-                    fn = tmp.remove(wd);
-                    fn.removeAt(0);
-                }
-            }
-
-            parseStream(s, wd, fn, recursive, doc, ext, parentLinks, workingDirectory);
+        if (s) {
+            parseStream(*s, wd, fn, recursive, doc, ext, parentLinks, workingDirectory);
         }
     }
 }
@@ -283,19 +962,37 @@ void resolveLinks(QStringList &linksToParse,
     }
 }
 
-void Parser::parse(QTextStream &s,
+struct Parser::ReplayState {
+    // Top-level context.
+    Context *m_context = nullptr;
+    // Position of the second phase in the stream.
+    TextStream::State m_streamState;
+    // Current line of the second phase.
+    Line m_line;
+    bool m_readNewLine = true;
+    // The last line that may define a link reference or a footnote.
+    qsizetype m_lastDefinitionLine = -1;
+};
+
+void Parser::parse(TextStream &stream,
                    QSharedPointer<Document> doc,
                    const QString &path,
                    const QString &fileName,
                    QStringList &linksToParse)
 {
-    TextStream stream(s);
-    Context ctx;
-    Context child;
-    child.applyParentContext(ctx);
-    ctx.children().enqueue(child);
+    m_checkedLineNumber = -1;
+    m_checkedLine.clear();
+
+    Context ctx(nullptr, &m_contexts);
+    ctx.appendChild();
 
-    stream.saveState();
+    ReplayState replayState;
+    replayState.m_context = &ctx;
+    replayState.m_streamState = stream.currentState();
+
+    if (m_singlePass) {
+        replayState.m_lastDefinitionLine = stream.lastLineContaining(QStringLiteral("]:"));
+    }
 
     while (!stream.atEnd()) {
         auto line = stream.readLine();
@@ -303,6 +1000,10 @@ void Parser::parse(QTextStream &s,
 
         ParseState state;
 
+        if (m_singlePass) {
+            state.m_replay = &replayState;
+        }
+
         const auto moveToDiscardedIf = [&state, &line, &stream, &empty]() -> bool {
             if (state.m_state == BlockState::Discard) {
                 if (state.m_context && state.m_context->firstLineNumber() != -1) {
@@ -350,19 +1051,35 @@ void Parser::parse(QTextStream &s,
         }
     }
 
-    stream.restoreState();
-
     resetParsers();
 
-    bool readNewLine = true;
-    Line line(QStringView(), -1);
+    replay(stream, doc, ctx, path, fileName, linksToParse, replayState, true);
+}
+
+void Parser::replay(TextStream &stream,
+                    QSharedPointer<Document> doc,
+                    Context &ctx,
+                    const QString &path,
+                    const QString &fileName,
+                    QStringList &linksToParse,
+                    ReplayState &replayState,
+                    bool toEnd)
+{
+    const auto checkState = stream.currentState();
+    stream.restoreState(&replayState.m_streamState);
+
+    auto &line = replayState.m_line;
 
     while (!stream.atEnd()) {
-        if (readNewLine) {
+        if (!toEnd && ctx.children().size() < 2) {
+            break;
+        }
+
+        if (replayState.m_readNewLine) {
             line = stream.readLine();
         }
 
-        readNewLine = true;
+        replayState.m_readNewLine = true;
 
         auto *childCtx = &ctx.children().head();
 
@@ -376,7 +1093,7 @@ void Parser::parse(QTextStream &s,
                 }
 
                 if (line.position() < line.length()) {
-                    readNewLine = false;
+                    replayState.m_readNewLine = false;
                 }
 
                 childCtx->block()->finish(line, stream, doc, doc, *childCtx, path, fileName, linksToParse);
@@ -399,6 +1116,36 @@ void Parser::parse(QTextStream &s,
             childCtx->block()->reset(*childCtx);
         }
     }
+
+    replayState.m_streamState = stream.currentState();
+
+    stream.restoreState(&checkState);
+}
+
+void Parser::replayFinishedBlocks(Line &currentLine,
+                                  TextStream &stream,
+                                  QSharedPointer<Document> doc,
+                                  Context &ctx,
+                                  const QString &path,
+                                  const QString &fileName,
+                                  QStringList &linksToParse,
+                                  ParseState &state)
+{
+    // The last top-level context may be merged with the next one, so only contexts before it
+    // are finished. Replay never reads the last line of the stream here, as the end of stream
+    // is handled by the final replay, and blocks are held back while a link reference or a
+    // footnote may be defined further.
+    if (state.m_replay
+        && &ctx == state.m_replay->m_context
+        && ctx.children().size() > 1
+        && !stream.atEnd()
+        && currentLine.lineNumber() > state.m_replay->m_lastDefinitionLine) {
+        resetParsers();
+
+        replay(stream, doc, ctx, path, fileName, linksToParse, *state.m_replay, false);
+
+        resetParsers();
+    }
 }
 
 void Parser::loopBlockParsers(Line &currentLine,
@@ -411,7 +1158,9 @@ void Parser::loopBlockParsers(Line &currentLine,
                               ParseState &state)
 {
     if (currentLine.position() < currentLine.length()) {
-        for (auto it = m_blockParsers.begin(), last = m_blockParsers.end(); it != last; ++it) {
+        const auto &parsers = blockParsersFor(currentLine);
+
+        for (auto it = parsers.begin(), last = parsers.end(); it != last; ++it) {
             if (&ctx.children().back() == state.m_context && state.m_skip.contains(it->get())) {
                 continue;
             }
@@ -435,9 +1184,7 @@ void Parser::loopBlockParsers(Line &currentLine,
 
                 if (st != BlockState::Stop) {
                     if (st != BlockState::ContinueWithoutAppendingChildCtx) {
-                        Context child(&ctx.children().back());
-                        child.applyParentContext(ctx.children().back());
-                        ctx.children().back().children().enqueue(child);
+                        ctx.children().back().appendChild();
                     }
 
                     parse(currentLine,
@@ -459,9 +1206,9 @@ void Parser::loopBlockParsers(Line &currentLine,
                                   linksToParse);
                     (*it)->reset(ctx.children().back());
 
-                    Context child(&ctx);
-                    child.applyParentContext(ctx);
-                    ctx.children().enqueue(child);
+                    replayFinishedBlocks(currentLine, stream, doc, ctx, path, fileName, linksToParse, state);
+
+                    ctx.appendChild();
                 }
 
                 break;
@@ -502,9 +1249,9 @@ void Parser::parse(Line &currentLine,
                     ->finish(currentLine, stream, doc, nullptr, ctx.children().back(), path, fileName, linksToParse);
                 ctx.children().back().block()->reset(ctx.children().back());
 
-                Context child;
-                child.applyParentContext(ctx);
-                ctx.children().enqueue(child);
+                replayFinishedBlocks(currentLine, stream, doc, ctx, path, fileName, linksToParse, state);
+
+                ctx.appendChild();
 
                 loopBlockParsers(currentLine, stream, doc, ctx, path, fileName, linksToParse, state);
             } else if (st == BlockState::Discard) {
@@ -514,7 +1261,10 @@ void Parser::parse(Line &currentLine,
 
                 state.m_context = &ctx.children().back();
                 state.m_state = BlockState::Discard;
-                state.m_skip.insert(ctx.children().back().block());
+
+                if (!state.m_skip.contains(ctx.children().back().block())) {
+                    state.m_skip.append(ctx.children().back().block());
+                }
             } else {
                 parse(currentLine, stream, doc, ctx.children().back(), path, fileName, linksToParse, state);
             }
@@ -524,7 +1274,7 @@ void Parser::parse(Line &currentLine,
     }
 }
 
-void Parser::parseStream(QTextStream &s,
+void Parser::parseStream(TextStream &s,
                          const QString &path,
                          const QString &fileName,
                          bool recursive,
@@ -533,49 +1283,237 @@ void Parser::parseStream(QTextStream &s,
                          QStringList *parentLinks,
                          const QString &workingDirectory)
 {
-    QStringList linksToParse;
+    auto linksToParse = parseSingleStream(s, path, fileName, doc);
 
-    const auto anchor = path.isEmpty() ? QString(fileName) : QString(path + s_solidusChar + fileName);
+    m_parsedFiles.insert(makeAnchor(path, fileName));
 
-    doc->appendItem(QSharedPointer<Anchor>(new Anchor(anchor)));
+    // Parse all links if parsing is recursive.
+    if (recursive) {
+        followLinks(linksToParse, parentLinks, [&](const QString &nextFileName, QStringList *links) {
+            parseFile(nextFileName, recursive, doc, ext, links, workingDirectory);
+        });
+    }
+}
+
+QStringList Parser::parseSingleStream(TextStream &stream,
+                                      const QString &path,
+                                      const QString &fileName,
+                                      QSharedPointer<Document> doc)
+{
+    QStringList linksToParse;
 
-    parse(s, doc, path, fileName, linksToParse);
+    doc->appendItem(QSharedPointer<Anchor>(new Anchor(makeAnchor(path, fileName))));
 
-    m_parsedFiles.push_back(anchor);
+    parse(stream, doc, path, fileName, linksToParse);
 
     resolveLinks(linksToParse, doc);
 
-    // Parse all links if parsing is recursive.
-    if (recursive && !linksToParse.empty()) {
-        const auto tmpLinks = linksToParse;
+    return linksToParse;
+}
 
-        while (!linksToParse.empty()) {
-            auto nextFileName = linksToParse.front();
-            linksToParse.erase(linksToParse.cbegin());
+void Parser::followLinks(QStringList &linksToParse,
+                         QStringList *parentLinks,
+                         const std::function<void(const QString &,
+                                                  QStringList *)> &parseLink)
+{
+    if (linksToParse.empty()) {
+        return;
+    }
 
-            if (parentLinks) {
-                const auto pit = std::find(parentLinks->cbegin(), parentLinks->cend(), nextFileName);
+    const auto tmpLinks = linksToParse;
 
-                if (pit != parentLinks->cend()) {
-                    continue;
-                }
-            }
+    while (!linksToParse.empty()) {
+        auto nextFileName = linksToParse.front();
+        linksToParse.erase(linksToParse.cbegin());
+
+        if (parentLinks) {
+            const auto pit = std::find(parentLinks->cbegin(), parentLinks->cend(), nextFileName);
 
-            if (nextFileName.startsWith(s_numberSignChar)) {
+            if (pit != parentLinks->cend()) {
                 continue;
             }
+        }
 
-            const auto pit = std::find(m_parsedFiles.cbegin(), m_parsedFiles.cend(), nextFileName);
+        if (nextFileName.startsWith(s_numberSignChar)) {
+            continue;
+        }
 
-            if (pit == m_parsedFiles.cend()) {
-                parseFile(nextFileName, recursive, doc, ext, &linksToParse, workingDirectory);
+        if (!m_parsedFiles.contains(nextFileName)) {
+            parseLink(nextFileName, &linksToParse);
+        }
+    }
+
+    if (parentLinks) {
+        std::copy(tmpLinks.cbegin(), tmpLinks.cend(), std::back_inserter(*parentLinks));
+    }
+}
+
+struct Parser::ParsedFile {
+    // Whether file exists and has allowed extension.
+    bool m_exists = false;
+    // Document of the file, null if the file can't be opened.
+    QSharedPointer<Document> m_doc;
+    // Anchor of the file.
+    QString m_anchor;
+    // Resolved links of the file.
+    QStringList m_links;
+};
+
+Parser::ParsedFile Parser::parseSingleFile(const QString &fileName,
+                                           const QStringList &ext,
+                                           QString workingDirectory)
+{
+    ParsedFile file;
+
+    QFileInfo fi(fileName);
+
+    if (fi.exists() && ext.contains(fi.suffix().toLower())) {
+        file.m_exists = true;
+
+        workingDirectory.replace(s_reverseSolidusChar, s_solidusChar);
+
+        QString wd;
+        QString fn;
+
+        auto s = readFile(fi, workingDirectory, wd, fn);
+
+        if (s) {
+            file.m_doc.reset(new Document);
+            file.m_anchor = makeAnchor(wd, fn);
+            file.m_links = parseSingleStream(*s, wd, fn, file.m_doc);
+        }
+    }
+
+    reset();
+
+    return file;
+}
+
+QSharedPointer<Parser> Parser::makeWorkerParser() const
+{
+    if (m_parserFactory) {
+        return m_parserFactory();
+    }
+
+    auto parser = QSharedPointer<Parser>::create();
+    parser->setAutolinkUriValidation(m_autolinkUriValidation);
+    parser->setSinglePass(m_singlePass);
+
+    return parser;
+}
+
+void Parser::parseFilesConcurrently(const QString &fileName,
+                                    QSharedPointer<Document> doc,
+                                    const QStringList &ext,
+                                    const QString &workingDirectory)
+{
+    QHash<QString, ParsedFile> files;
+    QSet<QString> scheduled;
+    QMutex mutex;
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_maxThreadCount > 0 ? static_cast<int>(m_maxThreadCount) : QThread::idealThreadCount());
+
+    // Each parsed file schedules its links, so independent files are parsed concurrently.
+    std::function<void(const QString &)> schedule = [&](const QString &nextFileName) {
+        {
+            QMutexLocker lock(&mutex);
+
+            if (scheduled.contains(nextFileName)) {
+                return;
             }
+
+            scheduled.insert(nextFileName);
         }
 
-        if (parentLinks) {
-            std::copy(tmpLinks.cbegin(), tmpLinks.cend(), std::back_inserter(*parentLinks));
+        pool.start([&, nextFileName]() {
+            auto file = makeWorkerParser()->parseSingleFile(nextFileName, ext, workingDirectory);
+            const auto links = file.m_links;
+
+            {
+                QMutexLocker lock(&mutex);
+
+                files.insert(nextFileName, file);
+            }
+
+            for (const auto &link : links) {
+                if (!link.startsWith(s_numberSignChar)) {
+                    schedule(link);
+                }
+            }
+        });
+    };
+
+    schedule(fileName);
+
+    pool.waitForDone();
+
+    stitchFile(fileName, files, doc, ext, nullptr, workingDirectory);
+}
+
+void Parser::stitchFile(const QString &fileName,
+                        QHash<QString,
+                              ParsedFile> &files,
+                        QSharedPointer<Document> doc,
+                        const QStringList &ext,
+                        QStringList *parentLinks,
+                        const QString &workingDirectory)
+{
+    // File may be visited more than once only if its link differs from its anchor,
+    // then it's parsed again as sequential parsing does.
+    const auto it = files.find(fileName);
+    auto file = (it != files.end() ? *it : parseSingleFile(fileName, ext, workingDirectory));
+
+    if (it != files.end()) {
+        files.erase(it);
+    }
+
+    if (!file.m_exists) {
+        return;
+    }
+
+    if (!doc->isEmpty() && doc->items().back()->type() != ItemType::PageBreak) {
+        doc->appendItem(QSharedPointer<PageBreak>(new PageBreak));
+    }
+
+    if (!file.m_doc) {
+        return;
+    }
+
+    for (const auto &item : file.m_doc->items()) {
+        doc->appendItem(item);
+    }
+
+    for (auto fit = file.m_doc->footnotesMap().cbegin(), last = file.m_doc->footnotesMap().cend(); fit != last; ++fit) {
+        doc->insertFootnote(fit.key(), fit.value());
+    }
+
+    for (auto lit = file.m_doc->labeledLinks().cbegin(), last = file.m_doc->labeledLinks().cend(); lit != last; ++lit) {
+        if (!doc->labeledLinks().contains(lit.key())) {
+            doc->insertLabeledLink(lit.key(), lit.value());
+        }
+    }
+
+    for (auto hit = file.m_doc->labeledHeadings().cbegin(), last = file.m_doc->labeledHeadings().cend(); hit != last;
+         ++hit) {
+        doc->insertLabeledHeading(hit.key(), hit.value());
+    }
+
+    for (auto ait = file.m_doc->auxLabelsMap().cbegin(), last = file.m_doc->auxLabelsMap().cend(); ait != last; ++ait) {
+        for (auto pit = ait.value().cbegin(), plast = ait.value().cend(); pit != plast; ++pit) {
+            doc->insertAuxLabel(ait.key(), pit.key());
+
+            for (qsizetype i = 0; i < pit.value(); ++i) {
+                doc->incrementAuxLabelCounter(ait.key(), pit.key());
+            }
         }
     }
+
+    m_parsedFiles.insert(file.m_anchor);
+
+    followLinks(file.m_links, parentLinks, [&](const QString &nextFileName, QStringList *links) {
+        stitchFile(nextFileName, files, doc, ext, links, workingDirectory);
+    });
 }
 
 void Parser::resetParsers()
@@ -12,10 +12,15 @@
 #include "inline_parser.h"
 
 // C++ include.
+#include <array>
+#include <bitset>
+#include <functional>
 #include <type_traits>
 
 // Qt include.
 #include <QHash>
+#include <QSet>
+#include <QVarLengthArray>
 
 QT_BEGIN_NAMESPACE
 class QTextStream;
@@ -36,6 +41,85 @@ namespace MD
 class Context;
 class TextStream;
 class Line;
+class ReverseSolidusHandler;
+class InlineEngine;
+
+//
+// TextEdit
+//
+
+/*!
+ * \class MD::TextEdit
+ * \inmodule md4qt
+ * \inheaderfile md4qt/parser.h
+ *
+ * \brief Edit of the Markdown text.
+ *
+ * Replacement of the range of characters in the old text with the new string.
+ *
+ * \sa MD::Parser::reparse
+ */
+struct TextEdit {
+    /*!
+     * Position of the first replaced character in the old text.
+     */
+    qsizetype m_position = 0;
+    /*!
+     * Count of removed characters.
+     */
+    qsizetype m_removed = 0;
+    /*!
+     * Inserted string.
+     */
+    QString m_inserted;
+}; // struct TextEdit
+
+//
+// ReparsedRange
+//
+
+/*!
+ * \class MD::ReparsedRange
+ * \inmodule md4qt
+ * \inheaderfile md4qt/parser.h
+ *
+ * \brief Result of the incremental reparse.
+ *
+ * Describes top-level items of the document that were replaced.
+ *
+ * \sa MD::Parser::reparse
+ */
+struct ReparsedRange {
+    /*!
+     * Whether only a range of the document was reparsed. If not, all items of the document
+     * were replaced.
+     */
+    bool m_incremental = false;
+    /*!
+     * Index of the first replaced top-level item.
+     */
+    qsizetype m_firstItem = 0;
+    /*!
+     * Removed top-level items.
+     */
+    Block::Items m_removed;
+    /*!
+     * Inserted top-level items, they start at MD::ReparsedRange::m_firstItem.
+     */
+    Block::Items m_inserted;
+    /*!
+     * First line of the replaced range.
+     */
+    qsizetype m_firstLine = 0;
+    /*!
+     * Last line of the replaced range in the old text, -1 means the end of the text.
+     */
+    qsizetype m_lastLine = -1;
+    /*!
+     * Difference of lines count, positions of all items after the replaced range are shifted by it.
+     */
+    qsizetype m_lineDelta = 0;
+}; // struct ReparsedRange
 
 //
 // Parser
@@ -106,6 +190,24 @@ public:
                                    const QString &path,
                                    const QString &fileName);
 
+    /*!
+     * Returns parsed Markdown document.
+     *
+     * Raw data is decoded only once directly into the internal buffer of the parser, without
+     * intermediate copies made by QTextStream. Encoding is detected by BOM, UTF-8 is used by
+     * default.
+     *
+     * \a data Raw data to parse, for example memory mapped file.
+     *
+     * \a path Absolute path to the root folder for the document.
+     *         This path will be used to resolve local links.
+     *
+     * \a fileName This argument needed only for anchor.
+     */
+    QSharedPointer<Document> parse(QByteArrayView data,
+                                   const QString &path,
+                                   const QString &fileName);
+
     /*!
      * Returns parsed Markdown document.
      *
@@ -127,6 +229,32 @@ public:
                                    const QStringList &ext = {QStringLiteral("md"),
                                                              QStringLiteral("markdown")});
 
+    /*!
+     * Updates the document after the edit of its text, and returns what was replaced.
+     *
+     * Only top-level blocks around the edit are reparsed and spliced into the document, positions
+     * of the following items are shifted. The whole text is parsed again if the edit may change
+     * anything outside of the reparsed blocks: link reference definitions, footnotes, headings
+     * (their labels are unique through the document), a block that swallows the following text,
+     * or the document was parsed recursively. In both cases the document is the same as the
+     * result of parsing of the new text.
+     *
+     * \a doc Document parsed from \a text with the same \a path and \a fileName, it's modified in place.
+     *
+     * \a text Old text of the document.
+     *
+     * \a edit Edit of the text.
+     *
+     * \a path Absolute path to the root folder for the document.
+     *
+     * \a fileName This argument needed only for anchor.
+     */
+    ReparsedRange reparse(QSharedPointer<Document> doc,
+                          const QString &text,
+                          const TextEdit &edit,
+                          const QString &path,
+                          const QString &fileName);
+
     /*!
      * Returns autolink URI validation mode.
      */
@@ -148,6 +276,80 @@ public:
         m_autolinkUriValidation = validation;
     }
 
+    /*!
+     * Returns whether single pass mode is on.
+     */
+    inline bool isSinglePass() const
+    {
+        return m_singlePass;
+    }
+
+    /*!
+     * Sets single pass mode.
+     *
+     * By default parser checks the whole stream to recognize blocks, and only then
+     * replays all lines once again to populate the document. In single pass mode
+     * every top-level block is processed right after it was recognized, so lines are
+     * replayed while they are still hot and the context of the finished block is freed
+     * immediately. Blocks are held back for the final replay only while a line further
+     * in the stream may still define a link reference or a footnote, so the resulting
+     * document is the same in both modes.
+     *
+     * \a on Turn on or off.
+     */
+    inline void setSinglePass(bool on = true)
+    {
+        m_singlePass = on;
+    }
+
+    /*!
+     * \inmodule md4qt
+     * \typealias MD::Parser::ParserFactory
+     * \inheaderfile md4qt/parser.h
+     *
+     * \brief Factory of parsers for worker threads.
+     */
+    using ParserFactory = std::function<QSharedPointer<Parser>()>;
+
+    /*!
+     * Returns maximum count of threads used in recursive parsing.
+     */
+    inline qsizetype maxThreadCount() const
+    {
+        return m_maxThreadCount;
+    }
+
+    /*!
+     * Sets maximum count of threads used in recursive parsing.
+     *
+     * If count is not 1 linked files are parsed concurrently, each file by its own parser
+     * in a thread pool, and then parsed files are stitched into one document in the same order
+     * as in sequential parsing. 0 means QThread::idealThreadCount(). By default is 1, i.e. files
+     * are parsed sequentially.
+     *
+     * \note If pipelines of this parser were changed, set a parser factory with
+     * MD::Parser::setParserFactory() that makes parsers with the same pipelines.
+     *
+     * \a count Count of threads.
+     */
+    inline void setMaxThreadCount(qsizetype count)
+    {
+        m_maxThreadCount = count;
+    }
+
+    /*!
+     * Sets factory of parsers used in worker threads in recursive parsing.
+     *
+     * Factory is invoked from different threads. By default a parser with default pipelines and
+     * settings of this parser is created.
+     *
+     * \a factory Factory.
+     */
+    inline void setParserFactory(const ParserFactory &factory)
+    {
+        m_parserFactory = factory;
+    }
+
     /*!
      * \inmodule md4qt
      * \typealias MD::Parser::BlockParsers
@@ -215,21 +417,54 @@ public:
      *
      * \a p Pipeline.
      */
-    inline void setBlockParsers(const BlockParsers &p)
-    {
-        m_blockParsers = p;
-    }
+    void setBlockParsers(const BlockParsers &p);
 
     /*!
      * Returms inline parsers for the given opener symbol.
      *
      * \a c Opener symbol.
      */
-    inline InlineParsers inlineParsersFor(const QChar &c) const
+    inline const InlineParsers &inlineParsersFor(const QChar &c) const
     {
-        return m_inlineParsers.value(c);
+        if (c.unicode() < m_asciiInlineParsers.size()) {
+            return m_asciiInlineParsers[c.unicode()];
+        }
+
+        const auto it = m_otherInlineParsers.constFind(c);
+
+        if (it != m_otherInlineParsers.cend()) {
+            return it.value();
+        }
+
+        static const InlineParsers s_noParsers;
+
+        return s_noParsers;
+    }
+
+    /*!
+     * Returns whether any inline parser may start with the given symbol.
+     *
+     * \a c Symbol.
+     */
+    inline bool mayStartInline(const QChar &c) const
+    {
+        return (c.unicode() < m_inlineStarts.size() ? m_inlineStarts.test(c.unicode())
+                                                    : m_otherInlineParsers.contains(c));
     }
 
+    /*!
+     * Moves the line to the next character that may start an inline, or that is a reverse solidus.
+     * Skipped characters are passed to the reverse solidus handler as not processed ones.
+     *
+     * Returns false if the line is at end.
+     *
+     * \a line Line.
+     *
+     * \a rs Reverse solidus handler.
+     */
+    bool nextInlineStart(Line &line,
+                         ReverseSolidusHandler &rs) const;
+
     /*!
      * Push state of all inline parsers.
      */
@@ -255,19 +490,14 @@ public:
      *
      * \a p Pipeline.
      */
-    inline void setInlineParsers(const InlineParsers &p)
-    {
-        m_allInlineParsers = p;
-
-        m_inlineParsers.clear();
-
-        for (const auto &inl : p) {
-            const auto chars = inl->startDelimiterSymbols();
+    void setInlineParsers(const InlineParsers &p);
 
-            for (qsizetype i = 0; i < chars.size(); ++i) {
-                m_inlineParsers[chars[i]].append(inl);
-            }
-        }
+    /*!
+     * Returns engine of inline parsing.
+     */
+    inline InlineEngine &inlineEngine()
+    {
+        return *m_inlineEngine;
     }
 
     /*!
@@ -341,7 +571,7 @@ private:
                    QStringList *parentLinks = nullptr,
                    QString workingDirectory = {});
 
-    void parseStream(QTextStream &stream,
+    void parseStream(TextStream &stream,
                      const QString &path,
                      const QString &fileName,
                      bool recursive,
@@ -350,17 +580,58 @@ private:
                      QStringList *parentLinks = nullptr,
                      const QString &workingDirectory = {});
 
+    // Parses stream without following links, returns resolved links of the stream.
+    QStringList parseSingleStream(TextStream &stream,
+                                  const QString &path,
+                                  const QString &fileName,
+                                  QSharedPointer<Document> doc);
+
+    // Follows links in the order of sequential recursive parsing, invokes parseLink for each link to parse.
+    void followLinks(QStringList &linksToParse,
+                     QStringList *parentLinks,
+                     const std::function<void(const QString &,
+                                              QStringList *)> &parseLink);
+
+    struct ParsedFile;
+
+    // Parses file without following links.
+    ParsedFile parseSingleFile(const QString &fileName,
+                               const QStringList &ext,
+                               QString workingDirectory);
+
+    // Parses file and all linked files concurrently.
+    void parseFilesConcurrently(const QString &fileName,
+                                QSharedPointer<Document> doc,
+                                const QStringList &ext,
+                                const QString &workingDirectory);
+
+    // Appends concurrently parsed file to the document in the order of sequential parsing.
+    void stitchFile(const QString &fileName,
+                    QHash<QString,
+                          ParsedFile> &files,
+                    QSharedPointer<Document> doc,
+                    const QStringList &ext,
+                    QStringList *parentLinks,
+                    const QString &workingDirectory);
+
+    // Returns parser for a worker thread.
+    QSharedPointer<Parser> makeWorkerParser() const;
+
     // Both phases.
-    void parse(QTextStream &s,
+    void parse(TextStream &stream,
                QSharedPointer<Document> doc,
                const QString &path,
                const QString &fileName,
                QStringList &linksToParse);
 
+    struct ReplayState;
+
     struct ParseState {
         BlockState m_state = BlockState::None;
         Context *m_context = nullptr;
-        QSet<BlockParser *> m_skip;
+        // Block parsers that were discarded on the context, usually one.
+        QVarLengthArray<BlockParser *, 2> m_skip;
+        ReplayState *m_replay = nullptr;
     };
 
     // First phase.
@@ -373,6 +644,11 @@ private:
                QStringList &linksToParse,
                ParseState &state);
 
+    // Returns block parsers that may start on the given line, by the first non-space symbol of the line.
+    // Sets cacheable to whether results of checks of these block parsers depend only on indents.
+    const BlockParsers &blockParsersFor(Line &line,
+                                        bool *cacheable = nullptr) const;
+
     // Loop through all block parsers.
     void loopBlockParsers(Line &currentLine,
                           TextStream &stream,
@@ -383,6 +659,27 @@ private:
                           QStringList &linksToParse,
                           ParseState &state);
 
+    // Second phase. Processes top-level blocks. If toEnd is false the last top-level
+    // context is not touched, as it may be still not finished.
+    void replay(TextStream &stream,
+                QSharedPointer<Document> doc,
+                Context &ctx,
+                const QString &path,
+                const QString &fileName,
+                QStringList &linksToParse,
+                ReplayState &replayState,
+                bool toEnd);
+
+    // In single pass mode processes all finished top-level blocks if it's safe.
+    void replayFinishedBlocks(Line &currentLine,
+                              TextStream &stream,
+                              QSharedPointer<Document> doc,
+                              Context &ctx,
+                              const QString &path,
+                              const QString &fileName,
+                              QStringList &linksToParse,
+                              ParseState &state);
+
     // Reset parsers - invokes reset() moethod for each of them.
     void resetParsers();
 
@@ -390,11 +687,38 @@ private:
     void reset();
 
 private:
-    QStringList m_parsedFiles;
+    // Result of checking of the current line without processing. Context is described by its indents.
+    struct CheckedLine {
+        Line::State m_state;
+        const BlockParser *m_exclude = nullptr;
+        qsizetype m_indentColumnForCheck = 0;
+        qsizetype m_indentColumn = 0;
+        qsizetype m_firstChildIndent = -1;
+        qsizetype m_maxAvailableIndent = 0;
+        BlockParser *m_block = nullptr;
+    }; // struct CheckedLine
+
+    QSet<QString> m_parsedFiles;
     QVector<QSharedPointer<BlockParser>> m_blockParsers;
+    // Dispatch table of block parsers by the first non-space ASCII symbol of a line.
+    std::array<BlockParsers, 128> m_asciiBlockParsers;
+    std::bitset<128> m_cacheableBlockStarts;
+    bool m_cacheableBlockParsers = false;
+    // The same line is checked on each level of nesting, results for the current line are cached.
+    mutable qsizetype m_checkedLineNumber = -1;
+    mutable QVector<CheckedLine> m_checkedLine;
     InlineParsers m_allInlineParsers;
-    QHash<QChar, InlineParsers> m_inlineParsers;
+    // Dispatch table of inline parsers by ASCII symbol, and the rest of symbols in the hash.
+    std::array<InlineParsers, 128> m_asciiInlineParsers;
+    QHash<QChar, InlineParsers> m_otherInlineParsers;
+    std::bitset<128> m_inlineStarts;
+    QSharedPointer<InlineEngine> m_inlineEngine;
+    // Contexts of block parsing are reused from one parse to another.
+    ContextPool m_contexts;
     AutolinkUriValidation m_autolinkUriValidation = AutolinkUriValidation::QUrl;
+    bool m_singlePass = false;
+    qsizetype m_maxThreadCount = 1;
+    ParserFactory m_parserFactory;
 
     Q_DISABLE_COPY(Parser)
 }; // class Parser
@@ -4,6 +4,7 @@
 */
 
 #include "poscache.h"
+#include "parser.h"
 
 // Qt include.
 #include <QScopedValueRollback>
@@ -46,21 +47,6 @@ PosRange::PosRange(qsizetype startColumn,
 {
 }
 
-PosRange::PosRange(qsizetype startColumn,
-                   qsizetype startLine,
-                   qsizetype endColumn,
-                   qsizetype endLine,
-                   Item *item,
-                   const QVector<QSharedPointer<PosRange>> &children)
-    : m_startColumn(startColumn)
-    , m_startLine(startLine)
-    , m_endColumn(endColumn)
-    , m_endLine(endLine)
-    , m_item(item)
-    , m_children(children)
-{
-}
-
 bool PosRange::isValidPos() const
 {
     return m_startColumn > -1 && m_startLine > -1 && m_endColumn > -1 && m_endLine > -1;
@@ -96,6 +82,38 @@ bool comparePosRangeUpper(const details::PosRange &range,
     return (range < *ptr);
 }
 
+// Returns whether the item is of one of the given types, any type matches empty types.
+inline bool isOfType(Item *item,
+                     const QVector<ItemType> &types)
+{
+    return types.isEmpty() || types.contains(item->type());
+}
+
+// Returns the range with lines shifted by the given offset.
+inline details::PosRange shiftedRange(details::PosRange range,
+                                      qsizetype offset)
+{
+    range.m_startLine += offset;
+    range.m_endLine += offset;
+
+    return range;
+}
+
+// Returns distance between the position and the range, lines first, then columns on the same line.
+inline std::pair<qsizetype, qsizetype> distanceTo(const details::PosRange &pos,
+                                                  const details::PosRange &range)
+{
+    if (range < pos) {
+        return {pos.m_startLine - range.m_endLine,
+                range.m_endLine == pos.m_startLine ? pos.m_startColumn - range.m_endColumn : 0};
+    } else if (pos < range) {
+        return {range.m_startLine - pos.m_endLine,
+                range.m_startLine == pos.m_endLine ? range.m_startColumn - pos.m_endColumn : 0};
+    }
+
+    return {0, 0};
+}
+
 //
 // PosCache
 //
@@ -106,7 +124,10 @@ PosCache::~PosCache() = default;
 
 void PosCache::initialize(QSharedPointer<MD::Document> doc)
 {
-    m_cache.clear();
+    m_inserted.clear();
+    m_links.clear();
+    m_topLevel.clear();
+    m_sortedTopLevel.clear();
 
     if (doc) {
         Visitor::process(doc);
@@ -119,6 +140,85 @@ void PosCache::initialize(QSharedPointer<MD::Document> doc)
             onReferenceLink(it->get());
         }
     }
+
+    buildCache();
+}
+
+void PosCache::update(QSharedPointer<MD::Document> doc,
+                      const ReparsedRange &range)
+{
+    if (!range.m_incremental || !doc) {
+        initialize(doc);
+
+        return;
+    }
+
+    // Top-level ranges that end before the first replaced line are kept.
+    const auto first = topLevelLowerBound({0, range.m_firstLine, 0, range.m_firstLine});
+
+    const auto removed = range.m_removed.size();
+    auto found = (first + removed <= m_cache.size());
+
+    for (qsizetype i = 0; found && i < removed; ++i) {
+        found = (m_cache.at(first + i).m_item == range.m_removed.at(i).get());
+    }
+
+    if (!found) {
+        initialize(doc);
+
+        return;
+    }
+
+    m_doc = doc;
+    m_inserted.clear();
+    m_links.clear();
+    m_topLevel.clear();
+    m_sortedTopLevel.clear();
+
+    for (const auto &item : range.m_inserted) {
+        processTopLevelItem(item.get());
+    }
+
+    const auto inserted = m_topLevel.size();
+
+    for (qsizetype i = 0; i < removed; ++i) {
+        m_removedChildren += countChildren(m_cache.at(first + i));
+    }
+
+    if (inserted == removed) {
+        // Replaced in place, the following ranges are shifted lazily.
+        for (qsizetype i = 0; i < inserted; ++i) {
+            m_cache[first + i] = placeRange(m_topLevel.at(i));
+            m_lineOffsets[first + i] -= lineOffset(first + i);
+        }
+
+        shiftLines(first + inserted, range.m_lineDelta);
+    } else {
+        applyShifts();
+
+        if (inserted > removed) {
+            m_cache.insert(first, inserted - removed, details::PosRange{-1, -1, -1, -1});
+            m_lineOffsets.insert(first, inserted - removed, 0);
+        } else {
+            m_cache.remove(first + inserted, removed - inserted);
+            m_lineOffsets.remove(first + inserted, removed - inserted);
+        }
+
+        m_shifts.resize(m_cache.size() + 1);
+
+        for (qsizetype i = 0; i < inserted; ++i) {
+            m_cache[first + i] = placeRange(m_topLevel.at(i));
+            m_lineOffsets[first + i] = 0;
+        }
+
+        for (qsizetype i = first + inserted, count = m_cache.size(); i < count; ++i) {
+            m_lineOffsets[i] += range.m_lineDelta;
+        }
+    }
+
+    if (m_removedChildren > m_children.size() / 2) {
+        compactChildren();
+    }
 }
 
 PosCache::Items PosCache::findFirstInCache(const MD::WithPosition &pos) const
@@ -127,47 +227,259 @@ PosCache::Items PosCache::findFirstInCache(const MD::WithPosition &pos) const
 
     details::PosRange tmp{pos.startColumn(), pos.startLine(), pos.endColumn(), pos.endLine()};
 
-    findFirstInCache(m_cache, tmp, res);
+    const auto first = topLevelLowerBound(tmp);
+
+    if (first < m_cache.size()) {
+        const auto range = topLevelRange(first);
+
+        if (range == tmp) {
+            res.push_back(range.m_item);
+
+            // Children are not shifted, the position is shifted back instead.
+            const auto offset = lineOffset(first);
+            tmp.m_startLine -= offset;
+            tmp.m_endLine -= offset;
+
+            findFirstInCache(range.m_firstChild, range.m_childrenCount, tmp, res);
+        }
+    }
 
     return res;
 }
 
-details::PosRange *PosCache::findInCache(const QVector<QSharedPointer<details::PosRange>> &vec,
-                                         const details::PosRange &pos,
-                                         bool ordered) const
+PosCache::Items PosCache::findAllInRange(qsizetype startLine,
+                                         qsizetype endLine,
+                                         const QVector<ItemType> &types) const
+{
+    Items res;
+
+    const auto first = topLevelLowerBound({0, startLine, 0, startLine});
+
+    for (qsizetype i = first, last = m_cache.size(); i < last; ++i) {
+        const auto offset = lineOffset(i);
+        const auto &range = m_cache.at(i);
+
+        if (range.m_startLine + offset > endLine) {
+            break;
+        }
+
+        if (isOfType(range.m_item, types)) {
+            res.push_back(range.m_item);
+        }
+
+        findAllInRange(range.m_firstChild, range.m_childrenCount, startLine - offset, endLine - offset, types, res);
+    }
+
+    return res;
+}
+
+void PosCache::findAllInRange(qsizetype first,
+                              qsizetype count,
+                              qsizetype startLine,
+                              qsizetype endLine,
+                              const QVector<ItemType> &types,
+                              Items &res) const
+{
+    if (!count) {
+        return;
+    }
+
+    const auto begin = m_children.cbegin() + first;
+    const auto end = begin + count;
+
+    for (auto it = std::lower_bound(begin,
+                                    end,
+                                    startLine,
+                                    [](const details::PosRange &r, qsizetype line) {
+                                        return r.m_endLine < line;
+                                    });
+         it != end && it->m_startLine <= endLine;
+         ++it) {
+        if (isOfType(it->m_item, types)) {
+            res.push_back(it->m_item);
+        }
+
+        findAllInRange(it->m_firstChild, it->m_childrenCount, startLine, endLine, types, res);
+    }
+}
+
+PosCache::Items PosCache::findNearestInCache(const MD::WithPosition &pos,
+                                             qsizetype count,
+                                             const QVector<ItemType> &types) const
+{
+    Items res;
+
+    if (count <= 0 || m_cache.isEmpty()) {
+        return res;
+    }
+
+    const details::PosRange tmp{pos.startColumn(), pos.startLine(), pos.endColumn(), pos.endLine()};
+
+    // Walks in one direction through sorted sibling ranges, so distances of the next ranges don't decrease.
+    struct Cursor {
+        std::pair<qsizetype, qsizetype> m_distance;
+        qsizetype m_order;
+        qsizetype m_index;
+        qsizetype m_step;
+        qsizetype m_first;
+        qsizetype m_last;
+        // Line offset of children, top-level ranges have their own offsets.
+        qsizetype m_offset;
+        bool m_topLevel;
+    }; // struct Cursor
+
+    const auto greater = [](const Cursor &l, const Cursor &r) {
+        return (l.m_distance > r.m_distance || (l.m_distance == r.m_distance && l.m_order > r.m_order));
+    };
+
+    QVector<Cursor> heap;
+    qsizetype order = 0;
+
+    // Children are not shifted, so their distances do not depend on offsets.
+    const auto push = [&](Cursor c) {
+        if (c.m_index >= c.m_first && c.m_index < c.m_last) {
+            c.m_distance = distanceTo(tmp,
+                                      c.m_topLevel ? topLevelRange(c.m_index)
+                                                   : shiftedRange(m_children.at(c.m_index), c.m_offset));
+            c.m_order = order++;
+
+            heap.push_back(c);
+            std::push_heap(heap.begin(), heap.end(), greater);
+        }
+    };
+
+    const auto first = topLevelLowerBound(tmp);
+
+    push({{}, 0, first, 1, 0, m_cache.size(), 0, true});
+    push({{}, 0, first - 1, -1, 0, m_cache.size(), 0, true});
+
+    while (!heap.isEmpty() && res.size() < count) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        auto c = heap.takeLast();
+
+        const auto offset = (c.m_topLevel ? lineOffset(c.m_index) : c.m_offset);
+        const auto &range = (c.m_topLevel ? m_cache.at(c.m_index) : m_children.at(c.m_index));
+
+        if (isOfType(range.m_item, types)) {
+            res.push_back(range.m_item);
+        }
+
+        // Children are not farther than their parent, so they are walked from the position in both directions.
+        if (range.m_childrenCount) {
+            const auto begin = m_children.cbegin() + range.m_firstChild;
+            const auto last = range.m_firstChild + range.m_childrenCount;
+            const auto index =
+                std::lower_bound(begin, begin + range.m_childrenCount, shiftedRange(tmp, -offset)) - m_children.cbegin();
+
+            push({{}, 0, index, 1, range.m_firstChild, last, offset, false});
+            push({{}, 0, index - 1, -1, range.m_firstChild, last, offset, false});
+        }
+
+        c.m_index += c.m_step;
+        push(c);
+    }
+
+    return res;
+}
+
+Item *PosCache::findNextInCache(const MD::WithPosition &pos,
+                                const QVector<ItemType> &types) const
+{
+    const details::PosRange tmp{pos.startColumn(), pos.startLine(), pos.endColumn(), pos.endLine()};
+
+    for (qsizetype i = topLevelLowerBound(tmp), last = m_cache.size(); i < last; ++i) {
+        if (auto item = findNextInCache(m_cache.at(i), shiftedRange(tmp, -lineOffset(i)), types)) {
+            return item;
+        }
+    }
+
+    return nullptr;
+}
+
+Item *PosCache::findNextInCache(const details::PosRange &range,
+                                const details::PosRange &pos,
+                                const QVector<ItemType> &types) const
+{
+    if (pos < range && isOfType(range.m_item, types)) {
+        return range.m_item;
+    }
+
+    if (range.m_childrenCount) {
+        const auto begin = m_children.cbegin() + range.m_firstChild;
+        const auto end = begin + range.m_childrenCount;
+
+        for (auto it = std::lower_bound(begin, end, pos); it != end; ++it) {
+            if (auto item = findNextInCache(*it, pos, types)) {
+                return item;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+qsizetype PosCache::findInCache(const details::PosRange &pos,
+                                bool ordered) const
 {
     if (!m_currentItems.empty()) {
-        return m_currentItems.top().get();
+        return m_currentItems.top();
     } else if (ordered) {
-        return nullptr;
+        return -1;
     } else {
-        const auto it = std::lower_bound(vec.begin(), vec.end(), pos, comparePosRangeLower);
+        const auto lower = [this, &pos](const QVector<qsizetype> &vec) -> qsizetype {
+            const auto it =
+                std::lower_bound(vec.cbegin(), vec.cend(), pos, [this](qsizetype i, const details::PosRange &r) {
+                    return m_inserted.at(i) < r;
+                });
+
+            return (it != vec.cend() ? *it : -1);
+        };
+
+        // Top-level ranges are merged on build, so the lower bound is the first of lower bounds in both vectors.
+        auto index = lower(m_topLevel);
+        const auto sorted = lower(m_sortedTopLevel);
+
+        if (index == -1 || (sorted != -1 && m_inserted.at(sorted) < m_inserted.at(index))) {
+            index = sorted;
+        }
+
+        if (index == -1 || !(m_inserted.at(index) == pos)) {
+            return -1;
+        }
+
+        while (true) {
+            auto child = m_links.at(index).m_firstChild;
 
-        if (it != vec.end() && *it->get() == pos) {
-            if (!it->get()->m_children.empty()) {
-                auto nested = findInCache(it->get()->m_children, pos);
+            while (child != -1 && m_inserted.at(child) < pos) {
+                child = m_links.at(child).m_nextSibling;
+            }
 
-                return (nested ? nested : it->get());
+            if (child != -1 && m_inserted.at(child) == pos) {
+                index = child;
             } else {
-                return it->get();
+                return index;
             }
-        } else {
-            return nullptr;
         }
     }
 }
 
-void PosCache::findFirstInCache(const QVector<QSharedPointer<details::PosRange>> &vec,
+void PosCache::findFirstInCache(qsizetype first,
+                                qsizetype count,
                                 const details::PosRange &pos,
                                 Items &res) const
 {
-    const auto it = std::lower_bound(vec.begin(), vec.end(), pos, comparePosRangeLower);
+    while (count) {
+        const auto begin = m_children.cbegin() + first;
+        const auto end = begin + count;
+        const auto it = std::lower_bound(begin, end, pos);
 
-    if (it != vec.end() && *it->get() == pos) {
-        res.push_back(it->get()->m_item);
+        if (it != end && *it == pos) {
+            res.push_back(it->m_item);
 
-        if (!it->get()->m_children.empty()) {
-            findFirstInCache(it->get()->m_children, pos, res);
+            first = it->m_firstChild;
+            count = it->m_childrenCount;
+        } else {
+            break;
         }
     }
 }
@@ -176,48 +488,216 @@ void PosCache::insertInCache(const details::PosRange &item,
                              bool sort,
                              bool insertInStack)
 {
-    const auto insertInStackFunc = [this, insertInStack](QSharedPointer<details::PosRange> item) {
+    if (!m_skipInCache) {
+        assert(item.isValidPos());
+
+        const auto parent = findInCache(item, !sort);
+        const auto index = m_inserted.size();
+
+        m_inserted.push_back(item);
+        m_links.push_back({});
+
+        if (parent != -1) {
+            auto &links = m_links[parent];
+
+            if (links.m_lastChild != -1) {
+                m_links[links.m_lastChild].m_nextSibling = index;
+            } else {
+                links.m_firstChild = index;
+            }
+
+            links.m_lastChild = index;
+        } else if (sort) {
+            const auto it = std::upper_bound(m_sortedTopLevel.begin(),
+                                             m_sortedTopLevel.end(),
+                                             item,
+                                             [this](const details::PosRange &r, qsizetype i) {
+                                                 return r < m_inserted.at(i);
+                                             });
+
+            m_sortedTopLevel.insert(it, index);
+        } else {
+            m_topLevel.push_back(index);
+        }
+
         if (insertInStack) {
-            this->m_currentItems.push(item);
+            m_currentItems.push(index);
         }
-    };
+    }
+}
 
-    static const auto makeSharedPosRange = [](const details::PosRange &range) -> QSharedPointer<details::PosRange> {
-        return QSharedPointer<details::PosRange>::create(range.m_startColumn,
-                                                         range.m_startLine,
-                                                         range.m_endColumn,
-                                                         range.m_endLine,
-                                                         range.m_item,
-                                                         range.m_children);
-    };
+void PosCache::buildCache()
+{
+    m_cache.clear();
+    m_children.clear();
+    m_children.reserve(m_inserted.size());
+    m_removedChildren = 0;
 
-    if (!m_skipInCache) {
-        assert(item.isValidPos());
+    const auto count = m_topLevel.size();
+    m_topLevel.append(m_sortedTopLevel);
+
+    std::inplace_merge(m_topLevel.begin(),
+                       m_topLevel.begin() + count,
+                       m_topLevel.end(),
+                       [this](qsizetype l, qsizetype r) {
+                           return m_inserted.at(l) < m_inserted.at(r);
+                       });
+
+    m_cache.reserve(m_topLevel.size());
 
-        auto pos = findInCache(m_cache, item, !sort);
+    for (const auto i : std::as_const(m_topLevel)) {
+        m_cache.push_back(placeRange(i));
+    }
+
+    m_lineOffsets.fill(0, m_cache.size());
+    m_shifts.fill(0, m_cache.size() + 1);
+    m_shifted = false;
+}
 
-        if (pos) {
-            pos->m_children.push_back(makeSharedPosRange(item));
+qsizetype PosCache::topLevelLowerBound(const details::PosRange &pos) const
+{
+    qsizetype first = 0;
 
-            insertInStackFunc(pos->m_children.back());
+    for (qsizetype count = m_cache.size(); count > 0;) {
+        const auto step = count / 2;
+
+        if (topLevelRange(first + step) < pos) {
+            first += step + 1;
+            count -= step + 1;
         } else {
-            if (sort) {
-                const auto it = std::upper_bound(m_cache.begin(), m_cache.end(), item, comparePosRangeUpper);
+            count = step;
+        }
+    }
 
-                if (it != m_cache.end()) {
-                    insertInStackFunc(*m_cache.insert(it, makeSharedPosRange(item)));
-                } else {
-                    m_cache.push_back(makeSharedPosRange(item));
+    return first;
+}
 
-                    insertInStackFunc(m_cache.back());
-                }
-            } else {
-                m_cache.push_back(makeSharedPosRange(item));
+details::PosRange PosCache::topLevelRange(qsizetype index) const
+{
+    auto range = m_cache.at(index);
+    const auto offset = lineOffset(index);
 
-                insertInStackFunc(m_cache.back());
-            }
+    range.m_startLine += offset;
+    range.m_endLine += offset;
+
+    return range;
+}
+
+qsizetype PosCache::lineOffset(qsizetype index) const
+{
+    auto offset = m_lineOffsets.at(index);
+
+    if (m_shifted) {
+        for (auto i = index + 1; i > 0; i -= (i & -i)) {
+            offset += m_shifts.at(i);
+        }
+    }
+
+    return offset;
+}
+
+details::PosRange PosCache::placeRange(qsizetype index)
+{
+    auto range = m_inserted.at(index);
+    range.m_firstChild = m_children.size();
+
+    // Level by level, children of each range are appended one after another.
+    m_order.clear();
+    m_order.push_back(index);
+
+    for (qsizetype i = 0; i < m_order.size(); ++i) {
+        const auto firstChild = m_children.size();
+        const auto firstInOrder = m_order.size();
+
+        for (auto child = m_links.at(m_order.at(i)).m_firstChild; child != -1;
+             child = m_links.at(child).m_nextSibling) {
+            m_order.push_back(child);
+        }
+
+        // Footnotes and links are inserted after all other items, so children may be unordered.
+        const auto byStart = [this](qsizetype l, qsizetype r) {
+            const auto &lr = m_inserted.at(l);
+            const auto &rr = m_inserted.at(r);
+
+            return (lr.m_startLine < rr.m_startLine
+                    || (lr.m_startLine == rr.m_startLine && lr.m_startColumn < rr.m_startColumn));
+        };
+
+        if (!std::is_sorted(m_order.begin() + firstInOrder, m_order.end(), byStart)) {
+            std::stable_sort(m_order.begin() + firstInOrder, m_order.end(), byStart);
+        }
+
+        for (auto j = firstInOrder, last = m_order.size(); j < last; ++j) {
+            m_children.push_back(m_inserted.at(m_order.at(j)));
+        }
+
+        if (i) {
+            auto &parent = m_children[range.m_firstChild + i - 1];
+            parent.m_firstChild = firstChild;
+            parent.m_childrenCount = m_children.size() - firstChild;
+        } else {
+            range.m_childrenCount = m_children.size() - firstChild;
         }
     }
+
+    return range;
+}
+
+qsizetype PosCache::countChildren(const details::PosRange &range) const
+{
+    // All children of a top-level range are placed together level by level.
+    auto count = range.m_childrenCount;
+
+    for (qsizetype i = 0; i < count; ++i) {
+        count += m_children.at(range.m_firstChild + i).m_childrenCount;
+    }
+
+    return count;
+}
+
+void PosCache::shiftLines(qsizetype from,
+                          qsizetype delta)
+{
+    if (delta && from < m_cache.size()) {
+        for (auto i = from + 1; i < m_shifts.size(); i += (i & -i)) {
+            m_shifts[i] += delta;
+        }
+
+        m_shifted = true;
+    }
+}
+
+void PosCache::applyShifts()
+{
+    if (m_shifted) {
+        for (qsizetype i = 0, count = m_cache.size(); i < count; ++i) {
+            m_lineOffsets[i] = lineOffset(i);
+        }
+
+        m_shifts.fill(0);
+        m_shifted = false;
+    }
+}
+
+void PosCache::compactChildren()
+{
+    QVector<details::PosRange> children;
+    children.reserve(m_children.size() - m_removedChildren);
+
+    for (auto &range : m_cache) {
+        const auto count = countChildren(range);
+        const auto delta = children.size() - range.m_firstChild;
+
+        for (qsizetype i = 0; i < count; ++i) {
+            children.push_back(m_children.at(range.m_firstChild + i));
+            children.back().m_firstChild += delta;
+        }
+
+        range.m_firstChild += delta;
+    }
+
+    m_children.swap(children);
+    m_removedChildren = 0;
 }
 
 void PosCache::onUserDefined(Item *i)
@@ -15,6 +15,8 @@
 namespace MD
 {
 
+struct ReparsedRange;
+
 namespace details
 {
 
@@ -68,28 +70,6 @@ struct PosRange {
              qsizetype endLine,
              Item *item);
 
-    /*!
-     * Initializing constructor.
-     *
-     * \a startColumn Start column.
-     *
-     * \a startLine Start line.
-     *
-     * \a endColumn End column.
-     *
-     * \a endLine End line.
-     *
-     * \a item This item.
-     *
-     * \a children Children items.
-     */
-    PosRange(qsizetype startColumn,
-             qsizetype startLine,
-             qsizetype endColumn,
-             qsizetype endLine,
-             Item *item,
-             const QVector<QSharedPointer<PosRange>> &children);
-
     /*!
      * Start column
      */
@@ -111,9 +91,13 @@ struct PosRange {
      */
     Item *m_item = nullptr;
     /*!
-     * List of children.
+     * Index of the first child in the cache, children of a range are placed one after another.
      */
-    QVector<QSharedPointer<PosRange>> m_children = {};
+    qsizetype m_firstChild = -1;
+    /*!
+     * Count of children.
+     */
+    qsizetype m_childrenCount = 0;
 
     /*!
      * Returns whether position valid.
@@ -151,6 +135,7 @@ bool operator<(const PosRange &l,
 
 } /* namespace details */
 
+// Kept for compatibility, MD::PosCache doesn't use shared ranges anymore.
 bool comparePosRangeLower(const QSharedPointer<details::PosRange> &ptr,
                           const details::PosRange &range);
 
@@ -172,7 +157,16 @@ bool comparePosRangeUpper(const details::PosRange &range,
  * and stores it internally. When positions cache is initialized a developer can search for items
  * by its positions with MD::PosCache::findFirstInCache method.
  *
- * A complexity of walking is O(N), whereas searching is LOG(N).
+ * Positions of top-level items are stored in one contiguous array, and positions of their children in
+ * another one, where children of each item are placed one after another, so searching is a chain of binary
+ * searches without indirections. A complexity of walking is O(N), whereas searching is LOG(N).
+ *
+ * After MD::Parser::reparse() the cache may be updated with MD::PosCache::update method, that walks
+ * only through inserted items, positions of the following items are shifted lazily.
+ *
+ * Besides searching by position the cache answers what items intersect the given lines
+ * (MD::PosCache::findAllInRange), what items are nearest to the position (MD::PosCache::findNearestInCache),
+ * and what item of the given type goes next after the position (MD::PosCache::findNextInCache).
  *
  * \sa MD::Visitor
  */
@@ -194,6 +188,18 @@ public:
      */
     virtual void initialize(QSharedPointer<MD::Document> doc);
 
+    /*!
+     * Updates the cache after MD::Parser::reparse() of the document. Only inserted items are walked
+     * through, positions of the following items are shifted lazily. If the document was parsed
+     * again entirely, or the cache doesn't correspond to the replaced items, the cache is initialized again.
+     *
+     * \a doc Document.
+     *
+     * \a range Replaced range of the document returned by MD::Parser::reparse().
+     */
+    virtual void update(QSharedPointer<MD::Document> doc,
+                        const ReparsedRange &range);
+
     /*!
      * \class MD::PosCache::Items
      * \inmodule md4qt
@@ -212,30 +218,71 @@ public:
      */
     Items findFirstInCache(const MD::WithPosition &pos) const;
 
-protected:
     /*!
-     * Find in cache an item with the given position.
+     * Returns all items that intersect the given lines, in order of the document where parents go
+     * before their children. Searching of the first item is LOG(N), then only found items are walked through,
+     * so this method is suitable for the visible part of the text.
+     *
+     * \a startLine First line.
+     *
+     * \a endLine Last line.
+     *
+     * \a types Types of items to return, if empty all items are returned.
+     */
+    Items findAllInRange(qsizetype startLine,
+                         qsizetype endLine,
+                         const QVector<ItemType> &types = {}) const;
+
+    /*!
+     * Returns at most \a count items nearest to the given position, sorted by distance. Distance is
+     * a count of lines between the position and the item, or a count of columns if they are on the same line.
+     * Items that intersect the position have zero distance, parents go before their children.
+     *
+     * \a pos Position.
+     *
+     * \a count Maximum count of items.
+     *
+     * \a types Types of items to return, if empty all items are returned.
+     */
+    Items findNearestInCache(const MD::WithPosition &pos,
+                             qsizetype count,
+                             const QVector<ItemType> &types = {}) const;
+
+    /*!
+     * Returns first item in order of the document that starts after the given position, or nullptr.
      *
-     * \a vec Cache of position.
+     * \a pos Position.
+     *
+     * \a types Types of sought-for item, if empty any item is returned.
+     */
+    Item *findNextInCache(const MD::WithPosition &pos,
+                          const QVector<ItemType> &types = {}) const;
+
+protected:
+    /*!
+     * Find in cache being built an item with the given position, returns index of the item
+     * in order of insertion or -1.
      *
      * \a pos Position of sought-for item.
      *
      * \a ordered Indicates that we sure that searching item places after everything.
      */
-    details::PosRange *findInCache(const QVector<QSharedPointer<details::PosRange>> &vec,
-                                   const details::PosRange &pos,
-                                   bool ordered = false) const;
+    qsizetype findInCache(const details::PosRange &pos,
+                          bool ordered = false) const;
 
     /*!
      * Find in cache items with the given position with all parents.
      *
-     * \a vec Cache.
+     * \a first Index of the first range among children in the cache to search among.
+     *
+     * \a count Count of ranges to search among.
      *
      * \a pos Position of sought-for item.
      *
      * \a res Reference to result of search.
      */
-    void findFirstInCache(const QVector<QSharedPointer<details::PosRange>> &vec,
+    void findFirstInCache(qsizetype first,
+                          qsizetype count,
                           const details::PosRange &pos,
                           Items &res) const;
 
@@ -254,6 +301,34 @@ protected:
                        bool sort = false,
                        bool insertInStack = false);
 
+    /*!
+     * Places inserted ranges into the cache, so children of each range are placed one after another.
+     * Invoked at the end of initialization.
+     */
+    void buildCache();
+
+    /*!
+     * Returns the top-level range in the cache with shifted position.
+     *
+     * \a index Index of the range.
+     */
+    details::PosRange topLevelRange(qsizetype index) const;
+
+    /*!
+     * Returns index of the first top-level range that is not less than the given position, or count
+     * of top-level ranges.
+     *
+     * \a pos Position.
+     */
+    qsizetype topLevelLowerBound(const details::PosRange &pos) const;
+
+    /*!
+     * Returns shift of lines of the top-level range and all its children.
+     *
+     * \a index Index of the range.
+     */
+    qsizetype lineOffset(qsizetype index) const;
+
 protected:
     /*!
      * Cache user defined item.
@@ -402,16 +477,65 @@ protected:
 
 protected:
     /*!
-     * Cache.
+     * Cache of top-level ranges.
+     */
+    QVector<details::PosRange> m_cache;
+    /*!
+     * Cache of children ranges, children of each range are placed one after another, and
+     * all children of a top-level range are placed together.
      */
-    QVector<QSharedPointer<details::PosRange>> m_cache;
+    QVector<details::PosRange> m_children;
     /*!
      * Skip adding in cache.
      */
     bool m_skipInCache = false;
 
 private:
-    QStack<QSharedPointer<details::PosRange>> m_currentItems;
+    // Places inserted range with all its children into the cache of children, returns the range.
+    details::PosRange placeRange(qsizetype index);
+    // Returns count of all children of the range.
+    qsizetype countChildren(const details::PosRange &range) const;
+    // Shifts lines of top-level ranges starting from the given one.
+    void shiftLines(qsizetype from,
+                    qsizetype delta);
+    // Applies lazy shifts to offsets of top-level ranges.
+    void applyShifts();
+    // Removes children of removed ranges from the cache of children.
+    void compactChildren();
+    // Appends children that intersect the given lines with all their children.
+    void findAllInRange(qsizetype first,
+                        qsizetype count,
+                        qsizetype startLine,
+                        qsizetype endLine,
+                        const QVector<ItemType> &types,
+                        Items &res) const;
+    // Returns the range itself or its first child that starts after the given position.
+    Item *findNextInCache(const details::PosRange &range,
+                          const details::PosRange &pos,
+                          const QVector<ItemType> &types) const;
+
+    // Links of inserted range in the tree.
+    struct Links {
+        qsizetype m_firstChild = -1;
+        qsizetype m_lastChild = -1;
+        qsizetype m_nextSibling = -1;
+    }; // struct Links
+
+    // Ranges in order of insertion and their links, memory is kept for the next initialization.
+    QVector<details::PosRange> m_inserted;
+    QVector<Links> m_links;
+    // Top-level ranges inserted in order and sorted on insertion.
+    QVector<qsizetype> m_topLevel;
+    QVector<qsizetype> m_sortedTopLevel;
+    // Queue of ranges being placed into the cache.
+    QVector<qsizetype> m_order;
+    QStack<qsizetype> m_currentItems;
+    // Line offsets of top-level ranges, and lazy shifts of them in Fenwick tree.
+    QVector<qsizetype> m_lineOffsets;
+    QVector<qsizetype> m_shifts;
+    bool m_shifted = false;
+    // Count of children of removed ranges in the cache of children.
+    qsizetype m_removedChildren = 0;
 }; // class PosCache
 
 } /* namespace MD */
@@ -187,4 +187,9 @@ bool SetextHeadingParser::canBeLazyLine(Line &line,
     return (line.currentChar() == s_equalSignChar);
 }
 
+QString SetextHeadingParser::startSymbols() const
+{
+    return QStringLiteral("=-");
+}
+
 } /* namespace MD */
@@ -151,6 +151,11 @@ public:
                        QSharedPointer<Document> doc,
                        Context &ctx) const override;
 
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     */
+    QString startSymbols() const override;
+
     /*!
      * Returns if the given line a setext after paragrah.
      *
@@ -0,0 +1,154 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+// md4qt include.
+#include "shared_parser.h"
+
+// Qt include.
+#include <QMutexLocker>
+
+namespace MD
+{
+
+//
+// SharedParser::Session
+//
+
+// Parse session. Takes a parser from the pool and returns it back on destruction, even if parsing
+// threw an exception.
+class SharedParser::Session final
+{
+public:
+    explicit Session(const SharedParser &owner)
+        : m_owner(owner)
+        , m_parser(owner.acquire())
+    {
+    }
+
+    ~Session()
+    {
+        m_owner.release(m_parser, m_finished);
+    }
+
+    Parser &parser()
+    {
+        return *m_parser;
+    }
+
+    // Parser resets its state at the end of each parse, so after that it's ready for the next session.
+    void finish()
+    {
+        m_finished = true;
+    }
+
+private:
+    const SharedParser &m_owner;
+    QSharedPointer<Parser> m_parser;
+    bool m_finished = false;
+
+    Q_DISABLE_COPY(Session)
+}; // class Session
+
+//
+// SharedParser
+//
+
+SharedParser::SharedParser(const Parser::ParserFactory &factory)
+    : m_factory(factory)
+{
+}
+
+SharedParser::~SharedParser() = default;
+
+QSharedPointer<Document> SharedParser::parse(const QString &fileName,
+                                             bool recursive,
+                                             const QStringList &ext) const
+{
+    return withSession([&](Parser &parser) {
+        return parser.parse(fileName, recursive, ext);
+    });
+}
+
+QSharedPointer<Document> SharedParser::parse(QTextStream &stream,
+                                             const QString &path,
+                                             const QString &fileName) const
+{
+    return withSession([&](Parser &parser) {
+        return parser.parse(stream, path, fileName);
+    });
+}
+
+QSharedPointer<Document> SharedParser::parse(QByteArrayView data,
+                                             const QString &path,
+                                             const QString &fileName) const
+{
+    return withSession([&](Parser &parser) {
+        return parser.parse(data, path, fileName);
+    });
+}
+
+QSharedPointer<Document> SharedParser::parse(const QString &fileName,
+                                             const QString &workingDirectory,
+                                             bool recursive,
+                                             const QStringList &ext) const
+{
+    return withSession([&](Parser &parser) {
+        return parser.parse(fileName, workingDirectory, recursive, ext);
+    });
+}
+
+qsizetype SharedParser::sessionsCount() const
+{
+    QMutexLocker lock(&m_mutex);
+
+    return m_sessionsCount;
+}
+
+QSharedPointer<Parser> SharedParser::acquire() const
+{
+    {
+        QMutexLocker lock(&m_mutex);
+
+        if (!m_free.isEmpty()) {
+            return m_free.takeLast();
+        }
+    }
+
+    // Construction of pipelines is not under the lock.
+    auto parser = (m_factory ? m_factory() : QSharedPointer<Parser>::create());
+
+    QMutexLocker lock(&m_mutex);
+
+    ++m_sessionsCount;
+
+    return parser;
+}
+
+void SharedParser::release(QSharedPointer<Parser> parser,
+                           bool reusable) const
+{
+    QMutexLocker lock(&m_mutex);
+
+    if (reusable) {
+        m_free.append(parser);
+    } else {
+        // Parsing was interrupted and state of the parser was not reset, so the session is dropped.
+        --m_sessionsCount;
+    }
+}
+
+template<class Func>
+QSharedPointer<Document> SharedParser::withSession(Func func) const
+{
+    Session session(*this);
+
+    auto doc = func(session.parser());
+
+    session.finish();
+
+    return doc;
+}
+
+} /* namespace MD */
@@ -0,0 +1,134 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef MD4QT_MD_SHARED_PARSER_H_INCLUDED
+#define MD4QT_MD_SHARED_PARSER_H_INCLUDED
+
+// md4qt include.
+#include "parser.h"
+
+// Qt include.
+#include <QMutex>
+#include <QVector>
+
+namespace MD
+{
+
+//
+// SharedParser
+//
+
+/*!
+ * \class MD::SharedParser
+ * \inmodule md4qt
+ * \inheaderfile md4qt/shared_parser.h
+ *
+ * \brief Reusable thread-safe Markdown parser.
+ *
+ * MD::Parser keeps state of parsing in its pipelines, so one instance can't be used from
+ * different threads at the same time. This class holds immutable configuration, a factory of
+ * parsers, and a pool of parse sessions. Each call takes a free session (a parser made by the
+ * factory only once and then reused) for the time of parsing, so concurrent calls don't share
+ * mutable state and pipelines are not rebuilt on each call.
+ *
+ * All methods of this class are thread-safe.
+ */
+class SharedParser final
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * \a factory Factory of configured parsers. Invoked from different threads. If it's not set
+     *            parsers with default pipelines are created.
+     */
+    explicit SharedParser(const Parser::ParserFactory &factory = {});
+    ~SharedParser();
+
+    /*!
+     * Returns parsed Markdown document. \sa MD::Parser::parse().
+     *
+     * \a fileName File name of the Markdown document.
+     *
+     * \a recursive Should parsing be recursive?
+     *
+     * \a ext Allowed extensions for Markdonw document files.
+     */
+    QSharedPointer<Document> parse(const QString &fileName,
+                                   bool recursive = true,
+                                   const QStringList &ext = {QStringLiteral("md"),
+                                                             QStringLiteral("markdown")}) const;
+
+    /*!
+     * Returns parsed Markdown document. \sa MD::Parser::parse().
+     *
+     * \a stream Stream to parse.
+     *
+     * \a path Absolute path to the root folder for the document.
+     *
+     * \a fileName This argument needed only for anchor.
+     */
+    QSharedPointer<Document> parse(QTextStream &stream,
+                                   const QString &path,
+                                   const QString &fileName) const;
+
+    /*!
+     * Returns parsed Markdown document. \sa MD::Parser::parse().
+     *
+     * \a data Raw data to parse.
+     *
+     * \a path Absolute path to the root folder for the document.
+     *
+     * \a fileName This argument needed only for anchor.
+     */
+    QSharedPointer<Document> parse(QByteArrayView data,
+                                   const QString &path,
+                                   const QString &fileName) const;
+
+    /*!
+     * Returns parsed Markdown document. \sa MD::Parser::parse().
+     *
+     * \a fileName File name of the Markdown document (full path).
+     *
+     * \a workingDirectory Absolute path to the working directory for the document.
+     *
+     * \a recursive Should parsing be recursive?
+     *
+     * \a ext Allowed extensions for Markdonw document files.
+     */
+    QSharedPointer<Document> parse(const QString &fileName,
+                                   const QString &workingDirectory,
+                                   bool recursive = true,
+                                   const QStringList &ext = {QStringLiteral("md"),
+                                                             QStringLiteral("markdown")}) const;
+
+    /*!
+     * Returns count of sessions created so far, i.e. maximum count of concurrent calls. Sessions
+     * interrupted by exceptions are dropped and not counted.
+     */
+    qsizetype sessionsCount() const;
+
+private:
+    class Session;
+
+    QSharedPointer<Parser> acquire() const;
+    void release(QSharedPointer<Parser> parser,
+                 bool reusable) const;
+
+    template<class Func>
+    QSharedPointer<Document> withSession(Func func) const;
+
+private:
+    Parser::ParserFactory m_factory;
+    mutable QMutex m_mutex;
+    mutable QVector<QSharedPointer<Parser>> m_free;
+    mutable qsizetype m_sessionsCount = 0;
+
+    Q_DISABLE_COPY(SharedParser)
+}; // class SharedParser
+
+} /* namespace MD */
+
+#endif // MD4QT_MD_SHARED_PARSER_H_INCLUDED
@@ -6,8 +6,8 @@
 // md4qt include.
 #include "table_parser.h"
 #include "constants.h"
-#include "emphasis_parser.h"
 #include "inline_context.h"
+#include "inline_engine.h"
 #include "paragraph_parser.h"
 #include "parser.h"
 #include "utils.h"
@@ -147,6 +147,26 @@ inline int isTableHeader(Line &line)
     }
 }
 
+// Returns whether the line after the given one may be an alignment of the table. Table is discarded
+// on the next line if it's not an alignment, so such a table is not worth to start.
+inline bool mayBeFollowedByAlignment(const Line &line,
+                                     TextStream &stream)
+{
+    const auto st = stream.currentState();
+    const auto atEnd = stream.atEnd();
+    const auto next = (atEnd ? Line() : stream.readLine());
+
+    stream.restoreState(&st);
+
+    if (next.lineNumber() == line.lineNumber() + 1 && !atEnd) {
+        const auto view = next.view();
+
+        return (view.contains(s_verticalLineChar) && (view.contains(s_minusChar) || view.contains(s_colonChar)));
+    }
+
+    return !(atEnd && st.m_lineNumber == line.lineNumber() + 1);
+}
+
 TableParser::TableParser(Parser *parser)
     : BlockParser(parser)
 {
@@ -155,7 +175,7 @@ TableParser::TableParser(Parser *parser)
 TableParser::~TableParser() = default;
 
 BlockState TableParser::check(Line &currentLine,
-                              TextStream &,
+                              TextStream &stream,
                               QSharedPointer<Document>,
                               Context &ctx,
                               const QString &,
@@ -169,7 +189,7 @@ BlockState TableParser::check(Line &currentLine,
     if (ctx.isInIndent(currentLine.column())) {
         const auto c = isTableHeader(currentLine);
 
-        if (c) {
+        if (c && (checkWithoutProcessing || mayBeFollowedByAlignment(currentLine, stream))) {
             if (checkWithoutProcessing) {
                 currentLine.restoreState();
             } else {
@@ -267,47 +287,14 @@ void TableParser::processCell(Line line,
 
     skipSpaces(line);
 
-    InlineContext inlineContext;
-
-    parser()->pushStateOfInliners();
-
-    ParagraphStream::HashedLines lines;
-    lines.insert(line.lineNumber(), line);
-
-    ParagraphStream pStream(lines, line.lineNumber(), line.lineNumber());
-    const auto pst = pStream.currentState();
-
-    line = pStream.readLine();
-
-    ReverseSolidusHandler rs;
-
-    while (line.position() < line.length()) {
-        auto processed = false;
-
-        rs.process(line.currentChar());
+    InlineEngine::Buffers buffers(parser()->inlineEngine());
+    buffers.lines().append(line);
 
-        const auto parsers = parser()->inlineParsersFor(line.currentChar());
+    ParagraphStream pStream(buffers.lines(), line.lineNumber());
 
-        for (const auto &p : parsers) {
-            if (p->check(line, pStream, inlineContext, doc, path, fileName, linksToParse, *parser(), rs)) {
-                processed = true;
-                break;
-            }
-        }
+    auto &inlineContext = buffers.context();
 
-        if (!processed) {
-            rs.next();
-            line.nextChar();
-        } else {
-            rs.clear();
-        }
-    }
-
-    pStream.restoreState(&pst);
-
-    parser()->popStateOfInliners();
-
-    EmphasisParser::processEmphasises(inlineContext);
+    parser()->inlineEngine().parse(pStream, inlineContext, doc, path, fileName, linksToParse);
 
     for (const auto &i : std::as_const(inlineContext.inlines())) {
         if (i->type() == ItemType::Code) {
@@ -468,6 +455,11 @@ bool TableParser::mayBreakParagraph(Line &line,
     return isTableHeader(line) && !isTableAlignment(line);
 }
 
+bool TableParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 bool TableParser::canBeLazyLine(Line &,
                                 TextStream &,
                                 QSharedPointer<Document>,
@@ -6,9 +6,122 @@
 // md4qt include.
 #include "text_stream.h"
 
+// Qt include.
+#include <QStringDecoder>
+
+// C++ include.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MD4QT_TEXT_STREAM_SSE2
+#include <emmintrin.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MD4QT_TEXT_STREAM_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
 namespace MD
 {
 
+//
+// Line breaks scanning.
+//
+
+inline qsizetype findLineBreakScalar(const char16_t *data,
+                                     qsizetype pos,
+                                     qsizetype size)
+{
+    for (; pos < size; ++pos) {
+        if (data[pos] == u'\n' || data[pos] == u'\r') {
+            break;
+        }
+    }
+
+    return pos;
+}
+
+#ifdef MD4QT_TEXT_STREAM_SSE2
+inline qsizetype findLineBreakSse2(const char16_t *data,
+                                   qsizetype pos,
+                                   qsizetype size)
+{
+    const auto n = _mm_set1_epi16(u'\n');
+    const auto r = _mm_set1_epi16(u'\r');
+
+    for (; pos + 8 <= size; pos += 8) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+        const auto mask =
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(chunk, n), _mm_cmpeq_epi16(chunk, r)));
+
+        if (mask) {
+            qsizetype i = 0;
+
+            while (!(mask & (1 << (i * 2)))) {
+                ++i;
+            }
+
+            return pos + i;
+        }
+    }
+
+    return findLineBreakScalar(data, pos, size);
+}
+#endif // MD4QT_TEXT_STREAM_SSE2
+
+#ifdef MD4QT_TEXT_STREAM_AVX2
+__attribute__((target("avx2"))) qsizetype findLineBreakAvx2(const char16_t *data,
+                                                             qsizetype pos,
+                                                             qsizetype size)
+{
+    const auto n = _mm256_set1_epi16(u'\n');
+    const auto r = _mm256_set1_epi16(u'\r');
+
+    for (; pos + 16 <= size; pos += 16) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + pos));
+        const auto mask = static_cast<unsigned int>(
+            _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi16(chunk, n), _mm256_cmpeq_epi16(chunk, r))));
+
+        if (mask) {
+            return pos + __builtin_ctz(mask) / 2;
+        }
+    }
+
+    return findLineBreakSse2(data, pos, size);
+}
+#endif // MD4QT_TEXT_STREAM_AVX2
+
+using FindLineBreakFunc = qsizetype (*)(const char16_t *, qsizetype, qsizetype);
+
+inline FindLineBreakFunc selectFindLineBreak()
+{
+#if defined(MD4QT_TEXT_STREAM_AVX2)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return &findLineBreakAvx2;
+    }
+
+    return &findLineBreakSse2;
+#elif defined(MD4QT_TEXT_STREAM_SSE2)
+    return &findLineBreakSse2;
+#else
+    return &findLineBreakScalar;
+#endif
+}
+
+/*
+ * Returns position of the first "\n" or "\r" character starting from the given position,
+ * or size if there is no line break. Vectorized implementation is selected at runtime.
+ */
+inline qsizetype findLineBreak(const QChar *data,
+                               qsizetype pos,
+                               qsizetype size)
+{
+    static const auto s_findLineBreak = selectFindLineBreak();
+
+    return s_findLineBreak(reinterpret_cast<const char16_t *>(data), pos, size);
+}
+
 //
 // Line
 //
@@ -62,10 +175,12 @@ TextStreamBase::~TextStreamBase() = default;
 
 Line TextStreamBase::currentLine()
 {
-    if (m_hashedLines.contains(m_current.m_lineNumber - 1)) {
-        auto line = m_hashedLines.value(m_current.m_lineNumber - 1);
+    const auto ln = m_current.m_lineNumber - 1;
 
-        return Line(line.first, line.second.m_lineNumber - 1);
+    if (ln >= 0 && ln < m_lines.size()) {
+        const auto &line = m_lines[ln];
+
+        return Line(line.first, ln);
     } else {
         return {};
     }
@@ -73,8 +188,8 @@ Line TextStreamBase::currentLine()
 
 Line TextStreamBase::readLine()
 {
-    if (m_hashedLines.contains(m_current.m_lineNumber)) {
-        auto line = m_hashedLines.value(m_current.m_lineNumber);
+    if (m_current.m_lineNumber < m_lines.size()) {
+        const auto &line = m_lines[m_current.m_lineNumber];
 
         restoreState(&line.second);
 
@@ -82,47 +197,78 @@ Line TextStreamBase::readLine()
     }
 
     auto makeLine = [this](QStringView view, const State &state) -> auto {
-        this->m_hashedLines.insert(state.m_lineNumber - 1, qMakePair(view, state));
+        // Lines are read sequentially, so index is dense.
+        if (state.m_lineNumber - 1 == this->m_lines.size()) {
+            this->m_lines.append(qMakePair(view, state));
+        }
 
         return Line(view, state.m_lineNumber - 1);
     };
 
     const auto start = m_current.m_pos;
-    bool rFound = false;
+    const auto size = length();
+    const auto text = data();
     ++m_current.m_lineNumber;
 
-    while (!atEnd()) {
-        bool decrement = true;
-        const auto c = getChar();
+    if (start == size) {
+        if (!isEmpty()) {
+            return makeLine(QStringView(text + start, size - start), m_current);
+        } else {
+            return Line(QStringView(), -1);
+        }
+    }
+
+    const auto i = findLineBreak(text, start, size);
+
+    if (i == size) {
+        m_current.m_pos = size;
 
-        if (atEnd() && (c == s_carriageReturnChar || c == s_newLineChar) && !m_current.m_isLastNewLine) {
+        return makeLine(QStringView(text + start, size - start), m_current);
+    }
+
+    if (text[i] == s_newLineChar) {
+        // Last new line in the stream is read twice, the second time it gives an empty line.
+        if (i == size - 1 && !m_current.m_isLastNewLine) {
             m_current.m_isLastNewLine = true;
-            --m_current.m_pos;
-            decrement = false;
+            m_current.m_pos = i;
+        } else {
+            m_current.m_pos = i + 1;
         }
 
-        if (rFound && c != s_newLineChar) {
-            if (!m_current.m_isLastNewLine) {
-                --m_current.m_pos;
-            }
+        return makeLine(QStringView(text + start, i - start), m_current);
+    }
 
-            return makeLine(QStringView(data() + start, m_current.m_pos - start - 1), m_current);
-        }
+    // "\r" is the last character in the stream.
+    if (i == size - 1) {
+        m_current.m_isLastNewLine = true;
+        m_current.m_pos = size;
+
+        return makeLine(QStringView(text + start, i - start), m_current);
+    }
 
-        if (c == s_newLineChar) {
-            return makeLine(
-                QStringView(data() + start, m_current.m_pos - start - (decrement ? 1 : 0) - (rFound ? 1 : 0)),
-                m_current);
+    if (text[i + 1] == s_newLineChar) {
+        if (i + 1 == size - 1 && !m_current.m_isLastNewLine) {
+            m_current.m_isLastNewLine = true;
+            m_current.m_pos = i + 1;
+        } else {
+            m_current.m_pos = i + 2;
         }
 
-        rFound = (c == s_carriageReturnChar);
+        return makeLine(QStringView(text + start, i - start), m_current);
     }
 
-    if (!isEmpty()) {
-        return makeLine(QStringView(data() + start, m_current.m_pos - start - (rFound ? 1 : 0)), m_current);
-    } else {
-        return Line(QStringView(), -1);
+    m_current.m_pos = i + 2;
+
+    if (m_current.m_pos == size && text[i + 1] == s_carriageReturnChar && !m_current.m_isLastNewLine) {
+        m_current.m_isLastNewLine = true;
+        --m_current.m_pos;
+    }
+
+    if (!m_current.m_isLastNewLine) {
+        --m_current.m_pos;
     }
+
+    return makeLine(QStringView(text + start, m_current.m_pos - start - 1), m_current);
 }
 
 void TextStreamBase::saveState()
@@ -142,12 +288,12 @@ TextStreamBase::State TextStreamBase::currentState() const
 
 Line TextStreamBase::moveTo(qsizetype ln)
 {
-    if (m_hashedLines.contains(ln)) {
-        auto line = m_hashedLines.value(ln);
+    if (ln >= 0 && ln < m_lines.size()) {
+        const auto &line = m_lines[ln];
 
         restoreState(&line.second);
 
-        return Line(line.first, line.second.m_lineNumber - 1);
+        return Line(line.first, ln);
     }
 
     return Line(QStringView(), -1);
@@ -159,21 +305,32 @@ Line TextStreamBase::moveTo(qsizetype ln)
 
 TextStream::TextStream(QTextStream &stream)
     : m_data(stream.readAll())
+    , m_length(m_data.length())
+{
+}
+
+TextStream::TextStream(QByteArrayView data)
+{
+    QStringDecoder decoder(QStringConverter::encodingForData(data).value_or(QStringConverter::Utf8));
+
+    m_data = decoder.decode(data);
+    m_length = m_data.length();
+}
+
+TextStream::TextStream(const QString &data)
+    : m_data(data)
+    , m_length(m_data.length())
 {
 }
 
 bool TextStream::atEnd() const
 {
-    return (m_current.m_pos == m_data.length());
+    return (m_current.m_pos == m_length);
 }
 
-QChar TextStream::getChar()
+qsizetype TextStream::length() const
 {
-    if (!atEnd()) {
-        return m_data[m_current.m_pos++];
-    } else {
-        return {};
-    }
+    return m_length;
 }
 
 const QChar *TextStream::data() const
@@ -186,6 +343,53 @@ bool TextStream::isEmpty() const
     return m_data.isEmpty();
 }
 
+qsizetype TextStream::lastLineContaining(QStringView s) const
+{
+    const auto pos = QStringView(m_data).first(m_length).lastIndexOf(s);
+
+    if (pos == -1) {
+        return -1;
+    }
+
+    qsizetype lineNumber = 0;
+
+    for (qsizetype i = findLineBreak(m_data.data(), 0, pos); i < pos; i = findLineBreak(m_data.data(), i + 1, pos)) {
+        if (m_data[i] == s_carriageReturnChar && i + 1 < pos && m_data[i + 1] == s_newLineChar) {
+            ++i;
+        }
+
+        ++lineNumber;
+    }
+
+    return lineNumber;
+}
+
+void TextStream::setLinesRange(qsizetype firstLine,
+                               qsizetype lastLine)
+{
+    while (m_current.m_lineNumber < firstLine && !atEnd()) {
+        readLine();
+    }
+
+    if (lastLine < 0) {
+        return;
+    }
+
+    auto pos = m_current.m_pos;
+
+    for (auto ln = m_current.m_lineNumber; ln <= lastLine; ++ln) {
+        const auto i = findLineBreak(m_data.data(), pos, m_length);
+
+        if (i == m_length || ln == lastLine) {
+            m_length = i;
+
+            break;
+        }
+
+        pos = (m_data[i] == s_carriageReturnChar && i + 1 < m_length && m_data[i + 1] == s_newLineChar ? i + 2 : i + 1);
+    }
+}
+
 //
 // ParagraphStream
 //
@@ -193,8 +397,26 @@ bool TextStream::isEmpty() const
 ParagraphStream::ParagraphStream(const HashedLines &lines,
                                  qsizetype firstLineNumber,
                                  qsizetype lastLineNumber)
-    : m_lines(lines)
+    : m_firstLineNumber(firstLineNumber)
     , m_lastLineNumber(lastLineNumber)
+{
+    m_lines.reserve(qMax(lastLineNumber - firstLineNumber + 1, qsizetype(0)));
+
+    for (auto i = firstLineNumber; i <= lastLineNumber; ++i) {
+        m_lines.append(lines.value(i));
+    }
+
+    State st;
+    st.m_lineNumber = firstLineNumber;
+
+    restoreState(&st);
+}
+
+ParagraphStream::ParagraphStream(const QVector<Line> &lines,
+                                 qsizetype firstLineNumber)
+    : m_lines(lines)
+    , m_firstLineNumber(firstLineNumber)
+    , m_lastLineNumber(firstLineNumber + lines.size() - 1)
 {
     State st;
     st.m_lineNumber = firstLineNumber;
@@ -204,7 +426,13 @@ ParagraphStream::ParagraphStream(const HashedLines &lines,
 
 Line ParagraphStream::readLine()
 {
-    return (!atEnd() ? m_lines.value(m_currentState.m_lineNumber++) : Line());
+    if (atEnd()) {
+        return {};
+    }
+
+    const auto i = m_currentState.m_lineNumber++ - m_firstLineNumber;
+
+    return (i >= 0 ? m_lines.at(i) : Line());
 }
 
 bool ParagraphStream::atEnd() const
@@ -10,10 +10,12 @@
 #include "constants.h"
 
 // Qt include.
+#include <QByteArrayView>
 #include <QHash>
 #include <QString>
 #include <QStringView>
 #include <QTextStream>
+#include <QVector>
 
 namespace MD
 {
@@ -362,9 +364,9 @@ public:
 
 protected:
     /*!
-     * Returns current character from stream and moves to next character.
+     * Returns length of data.
      */
-    virtual QChar getChar() = 0;
+    virtual qsizetype length() const = 0;
 
     /*!
      * Returns data.
@@ -387,7 +389,10 @@ protected:
     State m_saved;
 
 private:
-    QHash<qsizetype, QPair<QStringView, State>> m_hashedLines;
+    /*!
+     * Index of already read lines, where index in the vector is a line number.
+     */
+    QVector<QPair<QStringView, State>> m_lines;
 }; // class TextStreamBase
 
 /*!
@@ -403,16 +408,48 @@ class TextStream final : public TextStreamBase
 {
 public:
     explicit TextStream(QTextStream &stream);
+    /*!
+     * Constructs stream from raw data. Data is decoded once directly into the stream's buffer,
+     * encoding is detected by BOM, UTF-8 is used by default.
+     *
+     * \a data Raw data.
+     */
+    explicit TextStream(QByteArrayView data);
+    /*!
+     * Constructs stream from string.
+     *
+     * \a data String.
+     */
+    explicit TextStream(const QString &data);
 
     bool atEnd() const override;
 
+    /*!
+     * Returns number of the last line that contains the given string, or -1 if there is no such line.
+     *
+     * \a s String to look for.
+     */
+    qsizetype lastLineContaining(QStringView s) const;
+
+    /*!
+     * Restricts stream to the given range of lines. Stream is positioned at the first line of the range,
+     * numbers of lines stay the same, the last line of the range is read as the last line of the stream.
+     *
+     * \a firstLine First line of the range.
+     *
+     * \a lastLine Last line of the range, -1 means the last line of the data.
+     */
+    void setLinesRange(qsizetype firstLine,
+                       qsizetype lastLine = -1);
+
 protected:
-    QChar getChar() override;
+    qsizetype length() const override;
     const QChar *data() const override;
     bool isEmpty() const override;
 
 private:
     QString m_data;
+    qsizetype m_length = 0;
 }; // class TextStream
 
 /*!
@@ -439,6 +476,15 @@ public:
     ParagraphStream(const HashedLines &lines,
                     qsizetype firstLineNumber,
                     qsizetype lastLineNumber);
+    /*!
+     * Constructs stream from consecutive lines.
+     *
+     * \a lines Lines.
+     *
+     * \a firstLineNumber Number of the first line.
+     */
+    ParagraphStream(const QVector<Line> &lines,
+                    qsizetype firstLineNumber);
 
     /*!
      * Returns next line.
@@ -494,9 +540,10 @@ public:
     State currentState() const;
 
 private:
-    HashedLines m_lines;
+    QVector<Line> m_lines;
     State m_currentState;
     State m_savedState;
+    qsizetype m_firstLineNumber;
     qsizetype m_lastLineNumber;
 }; // class ParagraphStream
 
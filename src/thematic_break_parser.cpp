@@ -94,4 +94,14 @@ bool ThematicBreakParser::mayBreakParagraph(Line &,
     return true;
 }
 
+QString ThematicBreakParser::startSymbols() const
+{
+    return QStringLiteral("-*_");
+}
+
+bool ThematicBreakParser::checkDependsOnIndentsOnly() const
+{
+    return true;
+}
+
 } /* namespace MD */
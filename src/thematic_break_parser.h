@@ -134,6 +134,16 @@ public:
                            TextStream &stream,
                            QSharedPointer<Document> doc,
                            Context &ctx) const override;
+
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     */
+    QString startSymbols() const override;
+
+    /*!
+     * Returns whether result of check() without processing depends only on the line and on indents.
+     */
+    bool checkDependsOnIndentsOnly() const override;
 }; // class ThematicBreakParser
 
 } /* namespace MD */
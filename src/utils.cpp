@@ -90,12 +90,41 @@ void removeBackslashes(QString &str)
     }
 }
 
+// Returns code point of numeric character reference, reference is "&#" + digits + ";".
+inline bool numericEntity(QStringView en,
+                          char32_t &c)
+{
+    bool ok = false;
+
+    if (en.size() > 3 && en[2].toLower() == s_xChar) {
+        const auto hex = en.sliced(3, en.size() - 4);
+
+        if (hex.size() <= 6 && hex.size() > 0) {
+            c = hex.toInt(&ok, 16);
+        }
+    } else {
+        const auto dec = en.sliced(2, en.size() - 3);
+
+        if (dec.size() <= 7 && dec.size() > 0) {
+            c = dec.toInt(&ok, 10);
+        }
+    }
+
+    return ok;
+}
+
 void replaceEntity(QString &str)
 {
     qsizetype p1 = 0;
+    // Result is built only if there is something to replace, the rest of the string
+    // starting from this position is not copied into the result yet.
+    qsizetype copied = 0;
+    QString res;
 
     while ((p1 = str.indexOf(s_ampersandChar, p1)) != -1) {
-        if (p1 > 0 && str[p1 - 1] == s_reverseSolidusChar) {
+        const auto prev = (p1 > copied ? str[p1 - 1] : (!res.isEmpty() ? res.back() : QChar()));
+
+        if (prev == s_reverseSolidusChar) {
             ++p1;
 
             continue;
@@ -103,60 +132,42 @@ void replaceEntity(QString &str)
 
         const auto p2 = str.indexOf(s_semicolonChar, p1);
 
-        if (p2 != -1) {
-            const auto en = str.sliced(p1, p2 - p1 + 1);
-
-            if (en.size() > 2 && en[1] == s_numberSignChar) {
-                if (en.size() > 3 && en[2].toLower() == s_xChar) {
-                    const auto hex = en.sliced(3, en.size() - 4);
-
-                    if (hex.size() <= 6 && hex.size() > 0) {
-                        bool ok = false;
+        if (p2 == -1) {
+            break;
+        }
 
-                        const char32_t c = hex.toInt(&ok, 16);
+        const auto en = QStringView(str).sliced(p1, p2 - p1 + 1);
+        const auto numeric = (en.size() > 2 && en[1] == s_numberSignChar);
+        char32_t c = 0;
+        QStringView value;
 
-                        if (ok) {
-                            if (c) {
-                                const auto value = QString(QChar::fromUcs4(c));
-                                str.replace(p1, p2 - p1 + 1, value);
-                                p1 += value.length() - 1;
-                            } else {
-                                str.replace(p1, p2 - p1 + 1, s_replaceChar);
-                            }
-                        }
-                    }
-                } else {
-                    const auto dec = en.sliced(2, en.size() - 3);
-
-                    if (dec.size() <= 7 && dec.size() > 0) {
-                        bool ok = false;
+        if (numeric ? !numericEntity(en, c) : (value = findEntity(en.sliced(1, en.size() - 2))).isEmpty()) {
+            ++p1;
 
-                        const char32_t c = dec.toInt(&ok, 10);
+            continue;
+        }
 
-                        if (ok) {
-                            if (c) {
-                                const auto value = QString(QChar::fromUcs4(c));
-                                str.replace(p1, p2 - p1 + 1, value);
-                                p1 += value.length() - 1;
-                            } else {
-                                str.replace(p1, p2 - p1 + 1, s_replaceChar);
-                            }
-                        }
-                    }
-                }
-            } else {
-                const auto it = s_entityMap.find(en);
+        if (res.isEmpty()) {
+            res.reserve(str.size());
+        }
 
-                if (it != s_entityMap.cend()) {
-                    str.replace(p1, p2 - p1 + 1, *it);
-                    p1 += it->length() - 1;
-                }
-            }
+        res.append(QStringView(str).sliced(copied, p1 - copied));
 
-            ++p1;
+        if (!numeric) {
+            res.append(value);
+        } else if (c) {
+            res.append(QChar::fromUcs4(c));
         } else {
-            break;
+            res.append(s_replaceChar);
         }
+
+        copied = p2 + 1;
+        p1 = copied;
+    }
+
+    if (copied) {
+        res.append(QStringView(str).sliced(copied));
+        str = res;
     }
 }
 
@@ -18,6 +18,17 @@ Visitor::Visitor() = default;
 Visitor::~Visitor() = default;
 
 void Visitor::process(QSharedPointer<Document> d)
+{
+    setDocument(d);
+
+    for (auto it = m_doc->items().cbegin(), last = m_doc->items().cend(); it != last; ++it) {
+        processTopLevelItem(it->get());
+
+        onTopLevelItemProcessed(it->get());
+    }
+}
+
+void Visitor::setDocument(QSharedPointer<Document> d)
 {
     m_anchors.clear();
     m_doc = d;
@@ -32,51 +43,52 @@ void Visitor::process(QSharedPointer<Document> d)
             break;
         }
     }
+}
 
-    for (auto it = m_doc->items().cbegin(), last = m_doc->items().cend(); it != last; ++it) {
-        if (static_cast<int>((*it)->type()) >= static_cast<int>(ItemType::UserDefined)) {
-            onUserDefined(it->get());
-        } else {
-            switch ((*it)->type()) {
-            case ItemType::Heading:
-                onHeading(static_cast<Heading *>(it->get()));
-                break;
+void Visitor::processTopLevelItem(Item *item)
+{
+    if (static_cast<int>(item->type()) >= static_cast<int>(ItemType::UserDefined)) {
+        onUserDefined(item);
+    } else {
+        switch (item->type()) {
+        case ItemType::Heading:
+            onHeading(static_cast<Heading *>(item));
+            break;
 
-            case ItemType::Paragraph:
-                onParagraph(static_cast<Paragraph *>(it->get()), true);
-                break;
+        case ItemType::Paragraph:
+            onParagraph(static_cast<Paragraph *>(item), true);
+            break;
 
-            case ItemType::Code:
-                onCode(static_cast<Code *>(it->get()));
-                break;
+        case ItemType::Code:
+            onCode(static_cast<Code *>(item));
+            break;
 
-            case ItemType::Blockquote:
-                onBlockquote(static_cast<Blockquote *>(it->get()));
-                break;
+        case ItemType::Blockquote:
+            onBlockquote(static_cast<Blockquote *>(item));
+            break;
 
-            case ItemType::List:
-                onList(static_cast<List *>(it->get()));
-                break;
+        case ItemType::List:
+            onList(static_cast<List *>(item));
+            break;
 
-            case ItemType::Table:
-                onTable(static_cast<Table *>(it->get()));
-                break;
+        case ItemType::Table:
+            onTable(static_cast<Table *>(item));
+            break;
 
-            case ItemType::Anchor:
-                onAnchor(static_cast<Anchor *>(it->get()));
-                break;
+        case ItemType::Anchor:
+            onAnchor(static_cast<Anchor *>(item));
+            break;
 
-            case ItemType::RawHtml:
-                onRawHtml(static_cast<RawHtml *>(it->get()));
-                break;
+        case ItemType::RawHtml:
+            onRawHtml(static_cast<RawHtml *>(item));
+            break;
 
-            case ItemType::HorizontalLine:
-                onHorizontalLine(static_cast<HorizontalLine *>(it->get()));
-                break;
+        case ItemType::HorizontalLine:
+            onHorizontalLine(static_cast<HorizontalLine *>(item));
+            break;
 
-            default:
-                break;
-            }
+        default:
+            break;
         }
     }
 }
@@ -86,6 +98,11 @@ void Visitor::onUserDefined(Item *item)
     Q_UNUSED(item)
 }
 
+void Visitor::onTopLevelItemProcessed(Item *item)
+{
+    Q_UNUSED(item)
+}
+
 void Visitor::onParagraph(Paragraph *p,
                           bool wrap,
                           bool skipOpeningWrap)
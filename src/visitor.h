@@ -210,6 +210,27 @@ protected:
      */
     virtual bool wrapFirstParagraphInListItem(ListItem *i) const;
 
+    /*!
+     * Invoked by process() after each top-level item of the document.
+     *
+     * \a item Item.
+     */
+    virtual void onTopLevelItemProcessed(Item *item);
+
+    /*!
+     * Sets the document and collects its anchors, invoked by process() before walking through items.
+     *
+     * \a d Markdown document.
+     */
+    void setDocument(QSharedPointer<Document> d);
+
+    /*!
+     * Handle top-level item of the document.
+     *
+     * \a item Item.
+     */
+    void processTopLevelItem(Item *item);
+
 protected:
     /*!
      * All available m_anchors in the document.
@@ -192,4 +192,9 @@ bool YAMLParser::mayBreakParagraph(Line &,
     return false;
 }
 
+QString YAMLParser::startSymbols() const
+{
+    return QStringLiteral("-");
+}
+
 } /* namespace MD */
@@ -239,6 +239,11 @@ public:
                            QSharedPointer<Document> doc,
                            Context &ctx) const override;
 
+    /*!
+     * Returns string with all symbols that can be the first non-space symbol of this kind of block.
+     */
+    QString startSymbols() const override;
+
 private:
     QSharedPointer<YAMLHeader> m_yaml;
 }; // class YAMLParser
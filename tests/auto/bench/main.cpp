@@ -4,11 +4,55 @@
 */
 
 // Qt include.
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
 #include <QObject>
 #include <QTest>
+#include <QVector>
 
 // md4qt include.
 #include "parser.h"
+#include "text_stream.h"
+
+using LineAndState = QPair<QStringView, MD::TextStream::State>;
+
+// Splits text into lines with states of the stream after each of them and passes them to store. Then looks up
+// every line from the last one with lookup, as it's done on discarding of blocks. Returns sum of positions.
+template<class Store, class Lookup>
+inline qsizetype splitAndRewind(QStringView text,
+                                Store store,
+                                Lookup lookup)
+{
+    MD::TextStream::State state;
+    qsizetype start = 0;
+
+    for (qsizetype i = 0, size = text.size(); i <= size; ++i) {
+        if (i == size || text[i] == QLatin1Char('\n') || text[i] == QLatin1Char('\r')) {
+            const auto end = i;
+
+            if (i + 1 < size && text[i] == QLatin1Char('\r') && text[i + 1] == QLatin1Char('\n')) {
+                ++i;
+            }
+
+            state.m_pos = qMin(i + 1, size);
+            ++state.m_lineNumber;
+
+            store(qMakePair(text.sliced(start, end - start), state));
+
+            start = i + 1;
+        }
+    }
+
+    qsizetype sum = 0;
+
+    for (auto ln = state.m_lineNumber - 1; ln >= 0; --ln) {
+        sum += lookup(ln).second.m_pos;
+    }
+
+    return sum;
+}
 
 class Bench final : public QObject
 {
@@ -123,6 +167,15 @@ private Q_SLOTS:
         }
     }
 
+    void block_table_discard()
+    {
+        QBENCHMARK {
+            MD::Parser parser;
+
+            parser.parse(QStringLiteral("tests/bench/data/block-table-discard.md"), false);
+        }
+    }
+
     void inline_autolink()
     {
         QBENCHMARK {
@@ -269,6 +322,110 @@ private Q_SLOTS:
             parser.parse(stream, {}, {});
         }
     }
+
+    void text_stream_split_data()
+    {
+        QTest::addColumn<QString>("fileName");
+
+        QTest::newRow("lorem1") << QStringLiteral("tests/bench/data/lorem1.md");
+        QTest::newRow("rawtabs") << QStringLiteral("tests/bench/data/rawtabs.md");
+    }
+
+    // Splitting of data into lines, result is in characters per second.
+    void text_stream_split()
+    {
+        QFETCH(QString, fileName);
+
+        QFile file(fileName);
+
+        if (!file.open(QIODeviceBase::ReadOnly)) {
+            QFAIL("Unable to open file.");
+        }
+
+        QTextStream data(file.readAll());
+        file.close();
+
+        const MD::TextStream stream(data);
+        qint64 chars = 0;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        do {
+            // Copy has no index of lines, so data is split once again.
+            auto copy = stream;
+
+            while (!copy.atEnd()) {
+                chars += copy.readLine().length() + 1;
+            }
+        } while (timer.elapsed() < 1000);
+
+        const auto charsPerSecond = static_cast<qreal>(chars) * 1000000000 / timer.nsecsElapsed();
+
+        QTest::setBenchmarkResult(charsPerSecond * sizeof(QChar), QTest::BytesPerSecond);
+    }
+
+    void text_stream_lines_data()
+    {
+        QTest::addColumn<QString>("fileName");
+        QTest::addColumn<bool>("indexed");
+
+        const QDir dir(QStringLiteral("tests/bench/data"));
+        const auto files = dir.entryList({QStringLiteral("*.md")}, QDir::Files, QDir::Name);
+
+        for (const auto &f : files) {
+            QTest::newRow(qPrintable(f + QStringLiteral(" hashed"))) << dir.filePath(f) << false;
+            QTest::newRow(qPrintable(f + QStringLiteral(" indexed"))) << dir.filePath(f) << true;
+        }
+    }
+
+    // Reads all lines and then moves back to each of them, as it's done on discarding of blocks.
+    // "hashed" keeps lines in QHash as it was before dense index of lines in MD::TextStreamBase,
+    // "indexed" keeps them in a vector, lines are split the same way in both.
+    void text_stream_lines()
+    {
+        QFETCH(QString, fileName);
+        QFETCH(bool, indexed);
+
+        QFile file(fileName);
+
+        if (!file.open(QIODeviceBase::ReadOnly)) {
+            QFAIL("Unable to open file.");
+        }
+
+        const auto text = QString::fromUtf8(file.readAll());
+        file.close();
+
+        QBENCHMARK {
+            if (indexed) {
+                QVector<LineAndState> lines;
+
+                m_sum = splitAndRewind(
+                    text,
+                    [&lines](const LineAndState &line) {
+                        lines.append(line);
+                    },
+                    [&lines](qsizetype ln) {
+                        return lines.at(ln);
+                    });
+            } else {
+                QHash<qsizetype, LineAndState> lines;
+
+                m_sum = splitAndRewind(
+                    text,
+                    [&lines](const LineAndState &line) {
+                        lines.insert(line.second.m_lineNumber - 1, line);
+                    },
+                    [&lines](qsizetype ln) {
+                        return lines.value(ln);
+                    });
+            }
+        }
+    }
+
+private:
+    // Result of benchmarked code, so it's not optimized out.
+    volatile qsizetype m_sum = 0;
 };
 
 QTEST_GUILESS_MAIN(Bench)
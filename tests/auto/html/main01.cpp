@@ -12,6 +12,7 @@
 #include "parser.h"
 
 // Qt include.
+#include <QBuffer>
 #include <QDir>
 
 QString fullPath(int num)
@@ -615,3 +616,139 @@ TEST_CASE("026")
     const QString required = QStringLiteral("<p dir=\"auto\">ref 1</p>");
     REQUIRE(html == required);
 }
+
+/*
+text[^1] text[^1]
+
+[^1]: a[^2]
+
+[^2]: b[^1]
+
+*/
+TEST_CASE("027")
+{
+    const auto path = fullPath(27);
+    MD::Parser p;
+    auto html = MD::toHtml(p.parse(QStringLiteral("tests/html/data/027.md")), false, QStringLiteral("^"), false);
+    REQUIRE(html.count(QStringLiteral("<li id=")) == 2);
+    REQUIRE(html.contains(QStringLiteral("<li id=\"#^1/") + path + QStringLiteral("\"><p dir=\"auto\">a<sup>")));
+    REQUIRE(html.contains(QStringLiteral("<a href=\"#ref-#^1/")
+                          + path
+                          + QStringLiteral("-1\">^</a><a href=\"#ref-#^1/")
+                          + path
+                          + QStringLiteral("-2\">^</a></p></li><li id=\"#^2/")
+                          + path
+                          + QStringLiteral("\"><p dir=\"auto\">b<sup>")));
+    REQUIRE(html.endsWith(QStringLiteral("<a href=\"#ref-#^2/")
+                          + path
+                          + QStringLiteral("-1\">^</a></p></li></ol></section>\n")));
+}
+
+TEST_CASE("escaping_attributes")
+{
+    auto doc = QSharedPointer<MD::Document>::create();
+    auto p = QSharedPointer<MD::Paragraph>::create();
+    auto l = QSharedPointer<MD::Link>::create();
+    l->setText(QStringLiteral("link"));
+    l->setUrl(QStringLiteral("/a?b=1&c=\"2\""));
+    auto i = QSharedPointer<MD::Image>::create();
+    i->setUrl(QStringLiteral("/i.png?a=1&b=\"2\""));
+    i->setText(QStringLiteral("a \"b\" & <c>"));
+    p->appendItem(l);
+    p->appendItem(i);
+    doc->appendItem(p);
+    auto html = MD::toHtml(doc, false, {}, false);
+    const QString required = QStringLiteral(
+        "<p dir=\"auto\"><a href=\"/a?b=1&amp;c=&quot;2&quot;\">link</a>"
+        "<img src=\"/i.png?a=1&amp;b=&quot;2&quot;\" alt=\"a &quot;b&quot; &amp; &lt;c&gt;\" "
+        "style=\"max-width:100%;\" /></p>");
+    REQUIRE(html == required);
+}
+
+TEST_CASE("escaping_text")
+{
+    auto check = [](const QString &text, const QString &required) {
+        auto doc = QSharedPointer<MD::Document>::create();
+        auto p = QSharedPointer<MD::Paragraph>::create();
+        auto t = QSharedPointer<MD::Text>::create();
+        t->setText(text);
+        p->appendItem(t);
+        doc->appendItem(p);
+        REQUIRE(MD::toHtml(doc, false, {}, false)
+                == QStringLiteral("<p dir=\"auto\">") + required + QStringLiteral("</p>"));
+    };
+
+    // Special characters at the end and at the start of 8 characters chunks, and in the tail.
+    check(QStringLiteral("abcdefg&<ijklmn>q"), QStringLiteral("abcdefg&amp;&lt;ijklmn&gt;q"));
+    check(QStringLiteral("abcdefg&<ijklmn>"), QStringLiteral("abcdefg&amp;&lt;ijklmn&gt;"));
+    check(QStringLiteral("abcdefgh&>"), QStringLiteral("abcdefgh&amp;&gt;"));
+    check(QStringLiteral("abcdefghijklmnop\"q"), QStringLiteral("abcdefghijklmnop\"q"));
+    check(QStringLiteral("&"), QStringLiteral("&amp;"));
+}
+
+class SmallChunksHtmlVisitor : public MD::details::HtmlVisitor
+{
+public:
+    SmallChunksHtmlVisitor()
+    {
+        m_chunkSize = 1;
+    }
+}; // class SmallChunksHtmlVisitor
+
+TEST_CASE("streaming")
+{
+    MD::Parser p;
+    const auto doc = p.parse(QStringLiteral("tests/html/data/022.md"));
+    const auto backLink = QStringLiteral("<img src=\"qrc://ref.png\" />");
+    const auto required = MD::toHtml(doc, true, backLink).toUtf8();
+
+    QByteArray html;
+    qsizetype chunks = 0;
+
+    MD::toHtml<SmallChunksHtmlVisitor>(
+        doc,
+        [&html, &chunks](QByteArrayView data) {
+            html.append(data);
+            ++chunks;
+        },
+        true,
+        backLink);
+
+    REQUIRE(html == required);
+    // Wrapping tags, top-level items, footnotes.
+    REQUIRE(chunks > 5);
+
+    QBuffer buffer;
+    REQUIRE(buffer.open(QIODevice::WriteOnly));
+
+    MD::toHtml(doc, buffer, true, backLink);
+
+    REQUIRE(buffer.data() == required);
+}
+
+TEST_CASE("parallel")
+{
+    MD::Parser p;
+    const auto doc = p.parse(QStringLiteral("tests/html/data/028.md"));
+    const auto backLink = QStringLiteral("<img src=\"qrc://ref.png\" />");
+    const auto required = MD::toHtml(doc, true, backLink);
+
+    for (qsizetype threads : {2, 3, 16, 0}) {
+        REQUIRE(MD::toHtml(doc, true, backLink, true, nullptr, threads) == required);
+    }
+
+    QByteArray html;
+
+    MD::toHtml<SmallChunksHtmlVisitor>(
+        doc,
+        [&html](QByteArrayView data) {
+            html.append(data);
+        },
+        true,
+        backLink,
+        true,
+        nullptr,
+        4);
+
+    REQUIRE(html == required.toUtf8());
+}
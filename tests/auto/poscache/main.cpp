@@ -688,3 +688,149 @@ TEST_CASE("user_defined")
         REQUIRE(items.at(1)->type() == i->type());
     }
 }
+
+TEST_CASE("reinitialize")
+{
+    MD::Parser p;
+    auto doc = p.parse(QStringLiteral("tests/parser/data/003.md"));
+
+    MD::PosCache cache;
+    cache.initialize(doc);
+    REQUIRE(cache.findFirstInCache({0, 3, 0, 3}).size() == 2);
+
+    cache.initialize(p.parse(QStringLiteral("tests/parser/data/002.md")));
+    REQUIRE(cache.findFirstInCache({0, 3, 0, 3}).empty());
+    REQUIRE(cache.findFirstInCache({0, 0, 0, 0}).size() == 2);
+
+    cache.initialize(doc);
+    REQUIRE(cache.findFirstInCache({0, 0, 0, 0}).empty());
+
+    for (int i = 0; i < 2; ++i) {
+        const auto items = cache.findFirstInCache({0, 1 + i * 2, 0, 1 + i * 2});
+        REQUIRE(items.size() == 2);
+        REQUIRE(items.at(1)->type() == MD::ItemType::Text);
+        REQUIRE(static_cast<MD::Text *>(items.at(1))->text()
+                == QStringLiteral("Paragraph ") + to_string(i + 1) + QStringLiteral("."));
+    }
+
+    cache.initialize({});
+    REQUIRE(cache.findFirstInCache({0, 1, 0, 1}).empty());
+}
+
+TEST_CASE("update")
+{
+    QString text = QStringLiteral("Para 1\n\nPara 2\n\nPara 3\n\nPara 4\n\n* list\n\nPara *5*\n");
+
+    MD::Parser p;
+    auto doc = p.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+    MD::PosCache cache;
+    cache.initialize(doc);
+
+    const auto check = [&doc, &cache]() {
+        MD::PosCache expected;
+        expected.initialize(doc);
+
+        for (long long line = 0; line < 16; ++line) {
+            for (long long column = 0; column < 10; ++column) {
+                REQUIRE(cache.findFirstInCache({column, line, column, line})
+                        == expected.findFirstInCache({column, line, column, line}));
+            }
+        }
+    };
+
+    const auto edit = [&](qsizetype position, qsizetype removed, const QString &inserted) {
+        MD::TextEdit e;
+        e.m_position = position;
+        e.m_removed = removed;
+        e.m_inserted = inserted;
+
+        const auto range = p.reparse(doc, text, e, QStringLiteral("/path"), QStringLiteral("file.md"));
+        text.replace(position, removed, inserted);
+        cache.update(doc, range);
+
+        return range;
+    };
+
+    REQUIRE(edit(text.indexOf(QStringLiteral("3")), 1, QStringLiteral("3\ncontinued")).m_incremental);
+    check();
+
+    {
+        const auto items = cache.findFirstInCache({2, 11, 2, 11});
+        REQUIRE(items.size() == 2);
+        REQUIRE(items.at(0)->type() == MD::ItemType::Paragraph);
+        REQUIRE(static_cast<MD::Text *>(items.at(1))->text() == QStringLiteral("Para "));
+    }
+
+    REQUIRE(edit(text.indexOf(QStringLiteral("Para 2")), 6, QStringLiteral("> quote\n\ntext")).m_incremental);
+    check();
+
+    REQUIRE(edit(0, 0, QStringLiteral("[a]: url\n\n")).m_incremental == false);
+    check();
+}
+
+TEST_CASE("queries")
+{
+    const QString text = QStringLiteral("Para 1\n\n* item 1\n* item *2*\n\nPara 3\n");
+
+    MD::Parser p;
+    auto doc = p.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+    MD::PosCache cache;
+    cache.initialize(doc);
+
+    {
+        const auto items = cache.findAllInRange(0, 0);
+        REQUIRE(items.size() == 2);
+        REQUIRE(items.at(0)->type() == MD::ItemType::Paragraph);
+        REQUIRE(items.at(1)->type() == MD::ItemType::Text);
+    }
+
+    {
+        const auto items = cache.findAllInRange(2, 3);
+        REQUIRE(items.size() > 5);
+        REQUIRE(items.at(0)->type() == MD::ItemType::List);
+        REQUIRE(items.at(1)->type() == MD::ItemType::ListItem);
+        REQUIRE(items.at(2)->type() == MD::ItemType::Paragraph);
+        REQUIRE(static_cast<MD::Text *>(items.at(3))->text() == QStringLiteral("item 1"));
+        REQUIRE(items.at(4)->type() == MD::ItemType::ListItem);
+    }
+
+    REQUIRE(cache.findAllInRange(3, 3, {MD::ItemType::ListItem}).size() == 1);
+    REQUIRE(cache.findAllInRange(0, 5, {MD::ItemType::Paragraph}).size() == 4);
+    REQUIRE(cache.findAllInRange(4, 4, {MD::ItemType::Paragraph}).empty());
+    REQUIRE(cache.findAllInRange(6, 10).empty());
+
+    {
+        const auto items = cache.findNearestInCache({3, 5, 3, 5}, 2);
+        REQUIRE(items.size() == 2);
+        REQUIRE(items.at(0)->type() == MD::ItemType::Paragraph);
+        REQUIRE(items.at(1)->type() == MD::ItemType::Text);
+    }
+
+    {
+        const auto items = cache.findNearestInCache({0, 4, 0, 4}, 2, {MD::ItemType::Paragraph});
+        REQUIRE(items.size() == 2);
+        REQUIRE(items.contains(doc->items().back().get()));
+        REQUIRE(items.at(0)->startLine() != 0);
+        REQUIRE(items.at(1)->startLine() != 0);
+    }
+
+    REQUIRE(cache.findNearestInCache({0, 0, 0, 0}, 100).size() == cache.findAllInRange(0, 5).size());
+    REQUIRE(cache.findNearestInCache({0, 0, 0, 0}, 0).empty());
+
+    {
+        const auto item = cache.findNextInCache({0, 0, 6, 0}, {MD::ItemType::ListItem});
+        REQUIRE(item);
+        REQUIRE(item->startLine() == 2);
+    }
+
+    {
+        const auto item = cache.findNextInCache({0, 2, 0, 2}, {MD::ItemType::ListItem});
+        REQUIRE(item);
+        REQUIRE(item->startLine() == 3);
+    }
+
+    REQUIRE(cache.findNextInCache({0, 3, 0, 3}, {MD::ItemType::ListItem}) == nullptr);
+    REQUIRE(cache.findNextInCache({0, 5, 0, 5}) == nullptr);
+}
@@ -8,12 +8,23 @@
 #include <doctest/doctest.h>
 
 // md4qt include.
+#include "emphasis_parser.h"
+#include "entities_map.h"
+#include "html.h"
 #include "parser.h"
+#include "shared_parser.h"
 #include "utils.h"
 
 // Qt include.
+#include <QAtomicInt>
 #include <QTextStream>
 
+// C++ include.
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 //
 // isCommonMarkAutolinkUri unit tests
 //
@@ -181,3 +192,972 @@ TEST_CASE("gfm_autolink_http_qurl_mode")
     auto l = static_cast<MD::Link *>(p->items().at(0).get());
     REQUIRE(l->url() == QStringLiteral("http://example.com"));
 }
+
+//
+// Single pass parsing tests
+//
+
+inline QString singlePassHtml(const QString &md,
+                              bool singlePass)
+{
+    QString data = md;
+    QTextStream stream(&data);
+    MD::Parser parser;
+    parser.setSinglePass(singlePass);
+    auto doc = parser.parse(stream, QString(), QString());
+
+    return MD::toHtml(doc, false, {}, false);
+}
+
+TEST_CASE("single_pass_default")
+{
+    MD::Parser parser;
+    REQUIRE(!parser.isSinglePass());
+    parser.setSinglePass();
+    REQUIRE(parser.isSinglePass());
+    parser.setSinglePass(false);
+    REQUIRE(!parser.isSinglePass());
+}
+
+TEST_CASE("single_pass_equals_two_pass")
+{
+    QString md;
+
+    for (int i = 0; i < 20; ++i) {
+        md.append(QStringLiteral("# Heading %1\n\n"
+                                 "Paragraph *with* `code` and **strong** text\n"
+                                 "continued on the next line.\n\n"
+                                 "* item 1\n"
+                                 "* item 2\n\n"
+                                 "  lazy item paragraph\n\n"
+                                 "> quote\n"
+                                 "lazy continuation\n\n"
+                                 "```\n"
+                                 "code %1\n"
+                                 "```\n\n"
+                                 "| a | b |\n"
+                                 "|---|---|\n"
+                                 "| 1 | 2 |\n\n"
+                                 "Setext\n"
+                                 "------\n\n").arg(i));
+    }
+
+    REQUIRE(singlePassHtml(md, true) == singlePassHtml(md, false));
+}
+
+TEST_CASE("single_pass_forward_references")
+{
+    const auto md = QStringLiteral("[link] and [^1]\n\n"
+                                   "Paragraph\n\n"
+                                   "> quote\n\n"
+                                   "[link]: http://www.where.com\n\n"
+                                   "[^1]: Footnote.\n\n"
+                                   "Last paragraph\n");
+
+    const auto html = singlePassHtml(md, true);
+
+    REQUIRE(html == singlePassHtml(md, false));
+    REQUIRE(html.contains(QStringLiteral("http://www.where.com")));
+
+    QString data = md;
+    QTextStream stream(&data);
+    MD::Parser parser;
+    parser.setSinglePass();
+    auto doc = parser.parse(stream, QString(), QString());
+
+    REQUIRE(doc->items().size() == 5);
+    REQUIRE(doc->items().at(1)->type() == MD::ItemType::Paragraph);
+    auto p = static_cast<MD::Paragraph *>(doc->items().at(1).get());
+    REQUIRE(p->items().size() == 3);
+    REQUIRE(p->items().at(0)->type() == MD::ItemType::Link);
+    REQUIRE(p->items().at(2)->type() == MD::ItemType::FootnoteRef);
+    REQUIRE(doc->footnotesMap().size() == 1);
+}
+
+//
+// Parsing of raw data
+//
+
+TEST_CASE("parse_raw_utf8_data")
+{
+    const auto md = QStringLiteral("# Заголовок\n\n"
+                                   "Text with [link] and `code`.\n\n"
+                                   "[link]: http://www.where.com\n");
+
+    QString data = md;
+    QTextStream stream(&data);
+    MD::Parser parser;
+    const auto fromStream = MD::toHtml(parser.parse(stream, QString(), QString()), false, {}, false);
+
+    const auto utf8 = md.toUtf8();
+    const auto fromRaw = MD::toHtml(parser.parse(QByteArrayView(utf8), QString(), QString()), false, {}, false);
+
+    REQUIRE(fromRaw == fromStream);
+    REQUIRE(fromRaw.contains(QStringLiteral("Заголовок")));
+
+    QByteArray withBom("\xEF\xBB\xBF");
+    withBom.append(utf8);
+    const auto fromRawWithBom =
+        MD::toHtml(parser.parse(QByteArrayView(withBom), QString(), QString()), false, {}, false);
+
+    REQUIRE(fromRawWithBom == fromStream);
+}
+
+//
+// Concurrent recursive parsing
+//
+
+TEST_CASE("concurrent_recursive_parsing")
+{
+    const QStringList files = {QStringLiteral("tests/parser/data/031.md"),
+                               QStringLiteral("tests/parser/data/042.md"),
+                               QStringLiteral("tests/parser/data/051.md")};
+
+    for (const auto &fileName : files) {
+        MD::Parser sequential;
+        const auto expected = sequential.parse(fileName);
+
+        MD::Parser concurrent;
+        REQUIRE(concurrent.maxThreadCount() == 1);
+        concurrent.setMaxThreadCount(4);
+        const auto doc = concurrent.parse(fileName);
+
+        REQUIRE(doc->items().size() == expected->items().size());
+
+        for (qsizetype i = 0; i < doc->items().size(); ++i) {
+            REQUIRE(doc->items().at(i)->type() == expected->items().at(i)->type());
+
+            if (doc->items().at(i)->type() == MD::ItemType::Anchor) {
+                REQUIRE(static_cast<MD::Anchor *>(doc->items().at(i).get())->label()
+                        == static_cast<MD::Anchor *>(expected->items().at(i).get())->label());
+            }
+        }
+
+        REQUIRE(doc->labeledLinks().keys() == expected->labeledLinks().keys());
+        REQUIRE(doc->labeledHeadings().keys() == expected->labeledHeadings().keys());
+        REQUIRE(doc->footnotesMap().keys() == expected->footnotesMap().keys());
+        REQUIRE(MD::toHtml(doc, false, {}, false) == MD::toHtml(expected, false, {}, false));
+    }
+}
+
+TEST_CASE("concurrent_recursive_parsing_factory")
+{
+    QAtomicInt count = 0;
+
+    MD::Parser parser;
+    parser.setMaxThreadCount(0);
+    parser.setParserFactory([&count]() {
+        count.ref();
+
+        auto p = QSharedPointer<MD::Parser>::create();
+        p->setBlockParsers(MD::Parser::makeCommonMarkBlockParsersPipeline(p.get()));
+        p->setInlineParsers(MD::Parser::makeCommonMarkInlineParsersPipeline());
+
+        return p;
+    });
+
+    const auto doc = parser.parse(QStringLiteral("tests/parser/data/051.md"));
+
+    REQUIRE(count.loadRelaxed() == 3);
+    REQUIRE(doc->items().size() == 8);
+    REQUIRE(doc->items().at(2)->type() == MD::ItemType::PageBreak);
+    REQUIRE(doc->items().at(5)->type() == MD::ItemType::PageBreak);
+}
+
+//
+// Shared parser
+//
+
+TEST_CASE("shared_parser_concurrent_calls")
+{
+    const QStringList files = {QStringLiteral("tests/parser/data/031.md"),
+                               QStringLiteral("tests/parser/data/042.md"),
+                               QStringLiteral("tests/parser/data/051.md")};
+
+    QStringList expected;
+
+    for (const auto &fileName : files) {
+        MD::Parser parser;
+        expected.append(MD::toHtml(parser.parse(fileName), false, {}, false));
+    }
+
+    const MD::SharedParser parser;
+    std::vector<QStringList> results(4);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&parser, &files, &results, t]() {
+            for (int i = 0; i < 10; ++i) {
+                for (const auto &fileName : files) {
+                    results[t].append(MD::toHtml(parser.parse(fileName), false, {}, false));
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(parser.sessionsCount() >= 1);
+    REQUIRE(parser.sessionsCount() <= static_cast<qsizetype>(results.size()));
+
+    for (const auto &result : std::as_const(results)) {
+        REQUIRE(result.size() == files.size() * 10);
+
+        for (qsizetype i = 0; i < result.size(); ++i) {
+            REQUIRE(result.at(i) == expected.at(i % files.size()));
+        }
+    }
+}
+
+TEST_CASE("shared_parser_factory")
+{
+    QAtomicInt count = 0;
+
+    const MD::SharedParser parser([&count]() {
+        count.ref();
+
+        auto p = QSharedPointer<MD::Parser>::create();
+        p->setBlockParsers(MD::Parser::makeCommonMarkBlockParsersPipeline(p.get()));
+        p->setInlineParsers(MD::Parser::makeCommonMarkInlineParsersPipeline());
+
+        return p;
+    });
+
+    const QByteArray data = "Text [^1]\n\n[^1]: footnote\n";
+
+    for (int i = 0; i < 3; ++i) {
+        const auto doc = parser.parse(QByteArrayView(data), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        // Footnotes are not supported by CommonMark pipeline.
+        REQUIRE(doc->footnotesMap().isEmpty());
+    }
+
+    REQUIRE(count.loadRelaxed() == 1);
+    REQUIRE(parser.sessionsCount() == 1);
+}
+
+// Emphasis with '%' that throws on resolution.
+class ThrowingEmphasisParser : public MD::EmphasisParser
+{
+public:
+    ThrowingEmphasisParser()
+        : m_symbol(QLatin1Char('%'))
+    {
+    }
+
+    ~ThrowingEmphasisParser() override = default;
+
+    const QChar &symbol() const override
+    {
+        return m_symbol;
+    }
+
+    bool isEmphasis(int) const override
+    {
+        return true;
+    }
+
+    bool isLengthCorrespond() const override
+    {
+        return false;
+    }
+
+    MD::ItemWithOpts::Styles openStyles(qsizetype,
+                                        qsizetype,
+                                        qsizetype) const override
+    {
+        throw std::runtime_error("emphasis");
+    }
+
+    MD::ItemWithOpts::Styles closeStyles(qsizetype,
+                                         qsizetype,
+                                         qsizetype) const override
+    {
+        throw std::runtime_error("emphasis");
+    }
+
+private:
+    const QChar m_symbol;
+}; // class ThrowingEmphasisParser
+
+TEST_CASE("shared_parser_exception")
+{
+    int calls = 0;
+
+    const MD::SharedParser parser([&calls]() {
+        if (++calls == 1) {
+            throw std::runtime_error("factory");
+        }
+
+        auto p = QSharedPointer<MD::Parser>::create();
+        auto inlineParsers = MD::Parser::makeDefaultInlineParsersPipeline();
+        MD::Parser::appendInlineParser<ThrowingEmphasisParser>(inlineParsers);
+        p->setInlineParsers(inlineParsers);
+
+        return p;
+    });
+
+    REQUIRE_THROWS_AS(parser.parse(QByteArrayView("text\n"), QStringLiteral("/path"), QStringLiteral("file.md")),
+                      std::runtime_error);
+    REQUIRE(parser.sessionsCount() == 0);
+
+    REQUIRE_THROWS_AS(parser.parse(QByteArrayView("%a%\n"), QStringLiteral("/path"), QStringLiteral("file.md")),
+                      std::runtime_error);
+    REQUIRE(parser.sessionsCount() == 0);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto doc = parser.parse(QByteArrayView("text\n"), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        REQUIRE(doc->items().size() == 2);
+    }
+
+    REQUIRE(calls == 3);
+    REQUIRE(parser.sessionsCount() == 1);
+}
+
+//
+// Incremental reparsing
+//
+
+inline QSharedPointer<MD::Document> parseText(const QString &text)
+{
+    MD::Parser parser;
+
+    return parser.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+}
+
+inline void checkPosition(const MD::Item *item,
+                          const MD::Item *expected);
+
+inline void checkPositions(const MD::Block::Items &items,
+                           const MD::Block::Items &expected)
+{
+    REQUIRE(items.size() == expected.size());
+
+    for (qsizetype i = 0; i < items.size(); ++i) {
+        checkPosition(items.at(i).get(), expected.at(i).get());
+    }
+}
+
+// Checks positions of the item and of all nested items.
+inline void checkPosition(const MD::Item *item,
+                          const MD::Item *expected)
+{
+    REQUIRE(item->type() == expected->type());
+    REQUIRE(item->startColumn() == expected->startColumn());
+    REQUIRE(item->startLine() == expected->startLine());
+    REQUIRE(item->endColumn() == expected->endColumn());
+    REQUIRE(item->endLine() == expected->endLine());
+
+    switch (item->type()) {
+    case MD::ItemType::Heading: {
+        const auto text = static_cast<const MD::Heading *>(item)->text();
+        const auto expectedText = static_cast<const MD::Heading *>(expected)->text();
+
+        REQUIRE(!text == !expectedText);
+
+        if (text) {
+            checkPosition(text.get(), expectedText.get());
+        }
+    } break;
+
+    case MD::ItemType::Link:
+    case MD::ItemType::Image: {
+        const auto p = static_cast<const MD::LinkBase *>(item)->p();
+        const auto expectedP = static_cast<const MD::LinkBase *>(expected)->p();
+
+        REQUIRE(!p == !expectedP);
+
+        if (p) {
+            checkPosition(p.get(), expectedP.get());
+        }
+    } break;
+
+    case MD::ItemType::Table: {
+        const auto &rows = static_cast<const MD::Table *>(item)->rows();
+        const auto &expectedRows = static_cast<const MD::Table *>(expected)->rows();
+
+        REQUIRE(rows.size() == expectedRows.size());
+
+        for (qsizetype r = 0; r < rows.size(); ++r) {
+            checkPosition(rows.at(r).get(), expectedRows.at(r).get());
+
+            const auto &cells = rows.at(r)->cells();
+            const auto &expectedCells = expectedRows.at(r)->cells();
+
+            REQUIRE(cells.size() == expectedCells.size());
+
+            for (qsizetype c = 0; c < cells.size(); ++c) {
+                checkPosition(cells.at(c).get(), expectedCells.at(c).get());
+            }
+        }
+    } break;
+
+    default: {
+        const auto block = dynamic_cast<const MD::Block *>(item);
+
+        if (block) {
+            checkPositions(block->items(), static_cast<const MD::Block *>(expected)->items());
+        }
+    } break;
+    }
+}
+
+// Checks positions of all items, footnotes and labeled links of the document.
+inline void checkDocument(const QSharedPointer<MD::Document> &doc,
+                          const QSharedPointer<MD::Document> &expected)
+{
+    checkPositions(doc->items(), expected->items());
+
+    REQUIRE(doc->footnotesMap().keys() == expected->footnotesMap().keys());
+
+    for (auto it = doc->footnotesMap().cbegin(), last = doc->footnotesMap().cend(); it != last; ++it) {
+        checkPosition(it.value().get(), expected->footnotesMap().value(it.key()).get());
+    }
+
+    REQUIRE(doc->labeledLinks().keys() == expected->labeledLinks().keys());
+
+    for (auto it = doc->labeledLinks().cbegin(), last = doc->labeledLinks().cend(); it != last; ++it) {
+        checkPosition(it.value().get(), expected->labeledLinks().value(it.key()).get());
+    }
+
+    REQUIRE(MD::toHtml(doc, false, {}, false) == MD::toHtml(expected, false, {}, false));
+}
+
+TEST_CASE("reparse_paragraph_with_new_line")
+{
+    const QString text = QStringLiteral("Para 1\n\nPara 2\n\nPara 3\n\nPara 4\n\n* list\n\nPara *5*\n");
+
+    MD::Parser parser;
+    auto doc = parser.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+    const auto tail = doc->items().back();
+
+    MD::TextEdit edit;
+    edit.m_position = text.indexOf(QStringLiteral("3"));
+    edit.m_removed = 1;
+    edit.m_inserted = QStringLiteral("3\ncontinued");
+
+    const auto range = parser.reparse(doc, text, edit, QStringLiteral("/path"), QStringLiteral("file.md"));
+
+    QString newText = text;
+    newText.replace(edit.m_position, edit.m_removed, edit.m_inserted);
+    const auto expected = parseText(newText);
+
+    REQUIRE(range.m_incremental);
+    REQUIRE(range.m_lineDelta == 1);
+    REQUIRE(range.m_firstItem > 1);
+    REQUIRE(range.m_firstLine > 0);
+    REQUIRE(range.m_lastLine >= 4);
+    REQUIRE(range.m_lastLine < 8);
+    REQUIRE(range.m_removed.size() == range.m_inserted.size());
+    REQUIRE(doc->items().back() == tail);
+    REQUIRE(tail->startLine() == 11);
+    checkPositions(doc->items(), expected->items());
+    REQUIRE(MD::toHtml(doc, false, {}, false) == MD::toHtml(expected, false, {}, false));
+}
+
+TEST_CASE("reparse_at_end")
+{
+    const QString text = QStringLiteral("Para 1\n\n```\ncode\n```\n\nPara 2");
+
+    MD::Parser parser;
+    auto doc = parser.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+    MD::TextEdit edit;
+    edit.m_position = text.size();
+    edit.m_inserted = QStringLiteral("\n\n> quote");
+
+    const auto range = parser.reparse(doc, text, edit, QStringLiteral("/path"), QStringLiteral("file.md"));
+    const auto expected = parseText(text + edit.m_inserted);
+
+    REQUIRE(range.m_incremental);
+    REQUIRE(range.m_lastLine == -1);
+    REQUIRE(range.m_lineDelta == 2);
+    checkPositions(doc->items(), expected->items());
+    REQUIRE(MD::toHtml(doc, false, {}, false) == MD::toHtml(expected, false, {}, false));
+}
+
+TEST_CASE("reparse_fallbacks")
+{
+    const QString text = QStringLiteral("# Heading\n\nText [a] and [^1].\n\nPara\n\n[^1]: footnote\n");
+
+    const auto check = [&text](qsizetype position, const QString &inserted) {
+        MD::Parser parser;
+        auto doc = parser.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        MD::TextEdit edit;
+        edit.m_position = position;
+        edit.m_inserted = inserted;
+
+        const auto range = parser.reparse(doc, text, edit, QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        QString newText = text;
+        newText.replace(edit.m_position, edit.m_removed, edit.m_inserted);
+        const auto expected = parseText(newText);
+
+        REQUIRE(!range.m_incremental);
+        REQUIRE(range.m_inserted == doc->items());
+        REQUIRE(doc->labeledLinks().size() == expected->labeledLinks().size());
+        REQUIRE(doc->labeledHeadings().size() == expected->labeledHeadings().size());
+        checkPositions(doc->items(), expected->items());
+        REQUIRE(MD::toHtml(doc, false, {}, false) == MD::toHtml(expected, false, {}, false));
+    };
+
+    // Heading.
+    check(2, QStringLiteral("New "));
+    // Link reference definition.
+    check(text.indexOf(QStringLiteral("Para")), QStringLiteral("[a]: https://www.google.com\n\n"));
+    // Footnote.
+    check(text.size() - 1, QStringLiteral(" text"));
+}
+
+TEST_CASE("reparse_shifts_footnotes_and_links")
+{
+    const QString text = QStringLiteral(
+        "Para 1\n\n* list\n  > quote *a*\n\nPara 2 [a] and [^1].\n\nPara 3\n\n"
+        "[a]: https://www.google.com\n\n[^1]: footnote\n    > nested *b*\n\n| a | b |\n|---|---|\n| [c] | d |\n");
+
+    const auto check = [&text](const MD::TextEdit &edit,
+                               qsizetype lineDelta) {
+        MD::Parser parser;
+        auto doc = parser.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        const auto range = parser.reparse(doc, text, edit, QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        QString newText = text;
+        newText.replace(edit.m_position, edit.m_removed, edit.m_inserted);
+
+        REQUIRE(range.m_incremental);
+        REQUIRE(range.m_lastLine != -1);
+        REQUIRE(range.m_lineDelta == lineDelta);
+        REQUIRE(doc->footnotesMap().size() == 1);
+        REQUIRE(doc->labeledLinks().size() == 1);
+        checkDocument(doc, parseText(newText));
+    };
+
+    MD::TextEdit edit;
+    edit.m_position = text.indexOf(QStringLiteral("1"));
+    edit.m_inserted = QStringLiteral("\ncontinued\nand more");
+    check(edit, 2);
+
+    edit.m_position = text.indexOf(QStringLiteral("\n"));
+    edit.m_removed = 2;
+    edit.m_inserted = QString();
+    check(edit, -2);
+}
+
+TEST_CASE("reparse_random_edits")
+{
+    const QStringList texts = {
+        QStringLiteral("# Heading\n\nPara *1*\n\n* list\n  > quote\n\n```\ncode\n```\n\nPara [a] and [^1].\n\n"
+                       "[a]: https://www.google.com\n\n[^1]: footnote\n\n| a | b |\n|---|---|\n| c | d |\n"),
+        QStringLiteral("Text\n\n> quote\n> > nested\n\n1. one\n2. two\n\n    indented\n\n<div>\nhtml\n</div>\n\n"
+                       "Para **2**\n===\n\n- [ ] task\n\nLast ![img](a.png)\n"),
+    };
+    const QStringList inserted = {QString(),
+                                  QStringLiteral("a"),
+                                  QStringLiteral("\n"),
+                                  QStringLiteral("\n\n"),
+                                  QStringLiteral("> "),
+                                  QStringLiteral("- "),
+                                  QStringLiteral("```"),
+                                  QStringLiteral("    "),
+                                  QStringLiteral("*"),
+                                  QStringLiteral("[b]"),
+                                  QStringLiteral("| x |"),
+                                  QStringLiteral("text\n")};
+
+    // Fixed seed, results are reproducible.
+    std::mt19937 rng(1);
+    qsizetype incremental = 0;
+
+    for (auto text : texts) {
+        MD::Parser parser;
+        auto doc = parser.parse(QByteArrayView(text.toUtf8()), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        for (int i = 0; i < 200; ++i) {
+            MD::TextEdit edit;
+            edit.m_position = rng() % (text.size() + 1);
+            edit.m_removed = qMin<qsizetype>(rng() % 4 == 0 ? rng() % 8 : 0, text.size() - edit.m_position);
+            edit.m_inserted = inserted.at(rng() % inserted.size());
+
+            const auto range = parser.reparse(doc, text, edit, QStringLiteral("/path"), QStringLiteral("file.md"));
+
+            text.replace(edit.m_position, edit.m_removed, edit.m_inserted);
+
+            if (range.m_incremental) {
+                ++incremental;
+            }
+
+            checkDocument(doc, parseText(text));
+        }
+    }
+
+    REQUIRE(incremental > 0);
+}
+
+//
+// Emphasis resolution
+//
+
+inline QString paragraphHtml(const QString &text)
+{
+    return MD::toHtml(parseText(text), false, {}, false);
+}
+
+TEST_CASE("emphasis_nested_runs")
+{
+    REQUIRE(paragraphHtml(QStringLiteral("***a** b*"))
+            == QStringLiteral("<p dir=\"auto\"><em><strong>a</strong> b</em></p>"));
+    REQUIRE(paragraphHtml(QStringLiteral("**a *b***"))
+            == QStringLiteral("<p dir=\"auto\"><strong>a <em>b</em></strong></p>"));
+}
+
+TEST_CASE("emphasis_many_unmatched_delimiters")
+{
+    QString text;
+
+    for (int i = 0; i < 1000; ++i) {
+        text.append(QStringLiteral("_a "));
+    }
+
+    text.append(QStringLiteral("*b* "));
+
+    for (int i = 0; i < 1000; ++i) {
+        text.append(QStringLiteral("c* "));
+    }
+
+    text.append(QStringLiteral("~~d~~"));
+
+    const auto doc = parseText(text);
+
+    REQUIRE(doc->items().size() == 2);
+    REQUIRE(doc->items().at(1)->type() == MD::ItemType::Paragraph);
+
+    const auto p = static_cast<MD::Paragraph *>(doc->items().at(1).get());
+
+    qsizetype italic = 0;
+    qsizetype strikethrough = 0;
+
+    for (const auto &item : p->items()) {
+        REQUIRE(item->type() == MD::ItemType::Text);
+
+        const auto t = static_cast<MD::Text *>(item.get());
+
+        if (t->opts() == MD::ItalicText) {
+            REQUIRE(t->text() == QStringLiteral("b"));
+            ++italic;
+        } else if (t->opts() == MD::StrikethroughText) {
+            REQUIRE(t->text() == QStringLiteral("d"));
+            ++strikethrough;
+        } else {
+            REQUIRE(t->opts() == MD::TextWithoutFormat);
+        }
+    }
+
+    REQUIRE(italic == 1);
+    REQUIRE(strikethrough == 1);
+}
+
+// Emphasis with even runs of '-', where lengths of opening and closing delimiters should be equal.
+class EqualLengthEmphasisParser : public MD::EmphasisParser
+{
+public:
+    EqualLengthEmphasisParser()
+        : m_symbol(QLatin1Char('-'))
+    {
+    }
+
+    ~EqualLengthEmphasisParser() override = default;
+
+    const QChar &symbol() const override
+    {
+        return m_symbol;
+    }
+
+    bool isEmphasis(int length) const override
+    {
+        return (length % 2 == 0);
+    }
+
+    bool isLengthCorrespond() const override
+    {
+        return true;
+    }
+
+    MD::ItemWithOpts::Styles openStyles(qsizetype startPos,
+                                        qsizetype lineNumber,
+                                        qsizetype length) const override
+    {
+        return {MD::StyleDelim(8, startPos, lineNumber, startPos + length - 1, lineNumber)};
+    }
+
+    MD::ItemWithOpts::Styles closeStyles(qsizetype startPos,
+                                         qsizetype lineNumber,
+                                         qsizetype length) const override
+    {
+        return {MD::StyleDelim(8, startPos, lineNumber, startPos + length - 1, lineNumber)};
+    }
+
+private:
+    const QChar m_symbol;
+}; // class EqualLengthEmphasisParser
+
+TEST_CASE("emphasis_length_correspond_plugin")
+{
+    MD::Parser parser;
+
+    MD::Parser::InlineParsers inlineParsers;
+    MD::Parser::appendInlineParser<EqualLengthEmphasisParser>(inlineParsers);
+    parser.setInlineParsers(inlineParsers);
+
+    auto styled = [&parser](const char *text) {
+        const auto doc = parser.parse(QByteArrayView(text), QStringLiteral("/path"), QStringLiteral("file.md"));
+
+        REQUIRE(doc->items().size() == 2);
+        REQUIRE(doc->items().at(1)->type() == MD::ItemType::Paragraph);
+
+        QStringList texts;
+
+        for (const auto &item : static_cast<MD::Paragraph *>(doc->items().at(1).get())->items()) {
+            REQUIRE(item->type() == MD::ItemType::Text);
+
+            const auto t = static_cast<MD::Text *>(item.get());
+
+            if (t->opts() == 8) {
+                texts.append(t->text());
+            }
+        }
+
+        return texts;
+    };
+
+    // Closing run of 8 has no opener of its length, its rest of 2 closes the run of 2.
+    REQUIRE(styled("a --x a--------b\n") == QStringList{QStringLiteral("x a------")});
+    REQUIRE(styled("--------x --y a--------b\n") == QStringList{QStringLiteral("x --y a")});
+    REQUIRE(styled("--x --------y a--------b\n") == QStringList{QStringLiteral("y a")});
+}
+
+//
+// Inline code
+//
+
+TEST_CASE("inline_code_unmatched_backticks")
+{
+    QString text = QStringLiteral("x");
+
+    for (int i = 3; i <= 200; ++i) {
+        text.append(QStringLiteral(" x "));
+        text.append(QString(i, QLatin1Char('`')));
+    }
+
+    text.append(QStringLiteral("\n`a` ``b``"));
+
+    const auto doc = parseText(text);
+
+    REQUIRE(doc->items().size() == 2);
+    REQUIRE(doc->items().at(1)->type() == MD::ItemType::Paragraph);
+
+    const auto p = static_cast<MD::Paragraph *>(doc->items().at(1).get());
+    QStringList code;
+
+    for (const auto &item : p->items()) {
+        if (item->type() == MD::ItemType::Code) {
+            code.append(static_cast<MD::Code *>(item.get())->text());
+        }
+    }
+
+    REQUIRE(code == QStringList{QStringLiteral("a"), QStringLiteral("b")});
+}
+
+//
+// Inline parsers dispatch
+//
+
+TEST_CASE("inline_parsers_dispatch")
+{
+    MD::Parser parser;
+
+    REQUIRE(parser.inlineParsersFor(QLatin1Char('*')).size() == 1);
+    REQUIRE(parser.inlineParsersFor(QLatin1Char('a')).size() == 1);
+    REQUIRE(parser.inlineParsersFor(QLatin1Char(',')).isEmpty());
+    REQUIRE(parser.inlineParsersFor(QChar(0x00A7)).isEmpty());
+    REQUIRE(parser.mayStartInline(QLatin1Char('`')));
+    REQUIRE(parser.mayStartInline(QLatin1Char('a')));
+    REQUIRE(!parser.mayStartInline(QLatin1Char(',')));
+    REQUIRE(!parser.mayStartInline(QChar(0x00A7)));
+
+    parser.setInlineParsers(MD::Parser::makeCommonMarkInlineParsersPipeline());
+
+    REQUIRE(parser.inlineParsersFor(QLatin1Char('a')).isEmpty());
+    REQUIRE(!parser.mayStartInline(QLatin1Char('a')));
+    REQUIRE(!parser.mayStartInline(QLatin1Char('$')));
+    REQUIRE(parser.mayStartInline(QLatin1Char('[')));
+
+    const auto doc = parser.parse(QByteArrayView("Text, *text*, \\*text*, [link](url)."),
+                                  QStringLiteral("/path"),
+                                  QStringLiteral("file.md"));
+
+    REQUIRE(MD::toHtml(doc, false, {}, false)
+            == QStringLiteral("<p dir=\"auto\">Text, <em>text</em>, *text*, <a href=\"url\">link</a>.</p>"));
+}
+
+//
+// Block parsers dispatch
+//
+
+TEST_CASE("block_parsers_dispatch")
+{
+    MD::Parser parser;
+
+    const auto doc = parser.parse(QByteArrayView("> quote\n"
+                                                 "\n"
+                                                 "# heading\n"
+                                                 "\n"
+                                                 "  - item\n"
+                                                 "\n"
+                                                 "1. item\n"
+                                                 "\n"
+                                                 "***\n"
+                                                 "\n"
+                                                 "~~~\n"
+                                                 "code\n"
+                                                 "~~~\n"
+                                                 "\n"
+                                                 "<div>\n"
+                                                 "\n"
+                                                 "    code\n"
+                                                 "\n"
+                                                 "\xC2\xA7 heading\n"
+                                                 "===\n"
+                                                 "\n"
+                                                 "| a |\n"
+                                                 "|---|\n"),
+                                  QStringLiteral("/path"),
+                                  QStringLiteral("file.md"));
+
+    const QVector<MD::ItemType> expected = {MD::ItemType::Anchor,
+                                            MD::ItemType::Blockquote,
+                                            MD::ItemType::Heading,
+                                            MD::ItemType::List,
+                                            MD::ItemType::List,
+                                            MD::ItemType::HorizontalLine,
+                                            MD::ItemType::Code,
+                                            MD::ItemType::RawHtml,
+                                            MD::ItemType::Code,
+                                            MD::ItemType::Heading,
+                                            MD::ItemType::Table};
+
+    REQUIRE(doc->items().size() == expected.size());
+
+    for (qsizetype i = 0; i < expected.size(); ++i) {
+        REQUIRE(doc->items().at(i)->type() == expected.at(i));
+    }
+}
+
+TEST_CASE("block_checks_cache")
+{
+    MD::Parser parser;
+
+    // Lazy line is checked on each level of nesting.
+    auto doc = parser.parse(QByteArrayView("> > - item\n"
+                                           "lazy\n"),
+                            QStringLiteral("/path"),
+                            QStringLiteral("file.md"));
+
+    REQUIRE(doc->items().size() == 2);
+    REQUIRE(doc->items().at(1)->type() == MD::ItemType::Blockquote);
+    REQUIRE(MD::toHtml(doc, false, {}, false).contains(QStringLiteral("item\nlazy</li>")));
+
+    // Results of checks of the previous document are not used.
+    doc = parser.parse(QByteArrayView("> > - item\n"
+                                      "# lazy\n"),
+                       QStringLiteral("/path"),
+                       QStringLiteral("file.md"));
+
+    REQUIRE(doc->items().size() == 3);
+    REQUIRE(doc->items().at(1)->type() == MD::ItemType::Blockquote);
+    REQUIRE(doc->items().at(2)->type() == MD::ItemType::Heading);
+    REQUIRE(!MD::toHtml(doc, false, {}, false).contains(QStringLiteral("item\n")));
+}
+
+TEST_CASE("block_table_discard")
+{
+    MD::Parser parser;
+
+    // Lines with pipes that are not followed by an alignment are paragraphs, the table is not even started.
+    auto doc = parser.parse(QByteArrayView("a | b\n"
+                                           "c | d\n"
+                                           "\n"
+                                           "> > | a | b |\n"
+                                           "1. x\n"
+                                           "\n"
+                                           "| a | b |\n"
+                                           "|---|---|\n"
+                                           "| c | d |\n"),
+                            QStringLiteral("/path"),
+                            QStringLiteral("file.md"));
+
+    REQUIRE(doc->items().size() == 5);
+    REQUIRE(doc->items().at(1)->type() == MD::ItemType::Paragraph);
+    REQUIRE(doc->items().at(2)->type() == MD::ItemType::Blockquote);
+    REQUIRE(doc->items().at(3)->type() == MD::ItemType::List);
+    REQUIRE(doc->items().at(4)->type() == MD::ItemType::Table);
+
+    const auto html = MD::toHtml(doc, false, {}, false);
+
+    REQUIRE(html.contains(QStringLiteral("<p dir=\"auto\">a | b\nc | d</p>")));
+    REQUIRE(html.contains(QStringLiteral("<p dir=\"auto\">| a | b |</p>")));
+}
+
+//
+// Inline engine
+//
+
+TEST_CASE("inline_engine_nested_scans")
+{
+    MD::Parser parser;
+
+    // Text of links is scanned within the scan of the paragraph, GFM autolinks are not allowed there.
+    const auto doc = parser.parse(QByteArrayView("[*a* www.a.com](url) www.b.com\n"
+                                                 "\n"
+                                                 "| [`b`](url) | *c* |\n"
+                                                 "|---|---|\n"
+                                                 "\n"
+                                                 "# *d* {#label}\n"
+                                                 "\n"
+                                                 "**e**\n"),
+                                  QStringLiteral("/path"),
+                                  QStringLiteral("file.md"));
+
+    const auto html = MD::toHtml(doc, false, {}, false);
+
+    REQUIRE(html.startsWith(QStringLiteral("<p dir=\"auto\"><a href=\"url\"><em>a</em> www.a.com</a> "
+                                           "<a href=\"http://www.b.com\">http://www.b.com</a></p>")));
+    REQUIRE(html.contains(QStringLiteral("<a href=\"url\"><code>b</code></a>")));
+    REQUIRE(html.contains(QStringLiteral("<em>c</em>")));
+    REQUIRE(html.contains(QStringLiteral("<em>d</em>")));
+    REQUIRE(!html.contains(QStringLiteral("{#label}")));
+    REQUIRE(html.endsWith(QStringLiteral("<p dir=\"auto\"><strong>e</strong></p>")));
+}
+
+//
+// Entities
+//
+
+TEST_CASE("entities_decoding")
+{
+    REQUIRE(MD::findEntity(u"amp") == QStringLiteral("&"));
+    REQUIRE(MD::findEntity(u"CounterClockwiseContourIntegral") == QString(QChar(0x2233)));
+    REQUIRE(MD::findEntity(u"Afr") == QString::fromUtf16(u"\xD835\xDD04"));
+    REQUIRE(MD::findEntity(u"nosuch").isEmpty());
+    REQUIRE(MD::findEntity(u"AMP;").isEmpty());
+    REQUIRE(MD::findEntity({}).isEmpty());
+
+    QString str = QStringLiteral("&bsol;&amp; &lt;&#0; &nosuch; \\&amp; &amp");
+    MD::replaceEntity(str);
+
+    REQUIRE(str == QStringLiteral("\\&amp; <\xFFFD &nosuch; \\&amp; &amp"));
+}
@@ -9,8 +9,10 @@
 #include <src/html.h>
 #include <src/parser.h>
 #include <src/poscache.h>
+#include <src/shared_parser.h>
 
 // QT include.
+#include <QElapsedTimer>
 #include <QFile>
 #include <QObject>
 #include <QTest>
@@ -51,6 +53,84 @@ private Q_SLOTS:
         }
     }
 
+    void md4qt_with_qt6_single_pass()
+    {
+        QBENCHMARK {
+            MD::Parser parser;
+            parser.setSinglePass();
+
+            QTextStream stream(m_qtData);
+
+            parser.parse(stream, m_qtWd, m_qtFileName);
+        }
+    }
+
+    void md4qt_with_qt6_raw_utf8()
+    {
+        QBENCHMARK {
+            MD::Parser parser;
+
+            parser.parse(QByteArrayView(m_qtData), m_qtWd, m_qtFileName);
+        }
+    }
+
+    void md4qt_with_qt6_shared_parser()
+    {
+        // Pipelines are created once and reused by each parse.
+        const MD::SharedParser parser;
+
+        QBENCHMARK {
+            QTextStream stream(m_qtData);
+
+            parser.parse(stream, m_qtWd, m_qtFileName);
+        }
+    }
+
+    // Destruction of the document only, result is in nanoseconds per document.
+    void md4qt_document_teardown()
+    {
+        MD::Parser parser;
+        const qint64 count = 1000;
+        qint64 elapsed = 0;
+
+        QElapsedTimer timer;
+
+        for (qint64 i = 0; i < count; ++i) {
+            auto doc = parser.parse(QByteArrayView(m_qtData), m_qtWd, m_qtFileName);
+
+            timer.start();
+            doc.reset();
+            elapsed += timer.nsecsElapsed();
+        }
+
+        QTest::setBenchmarkResult(static_cast<qreal>(elapsed) / count, QTest::WalltimeNanoseconds);
+    }
+
+    // Typing and erasing of a character in the middle of the document.
+    void md4qt_reparse()
+    {
+        MD::Parser parser;
+
+        const auto text = QString::fromUtf8(m_qtData);
+        auto doc = parser.parse(QByteArrayView(m_qtData), m_qtWd, m_qtFileName);
+
+        MD::TextEdit typing;
+        typing.m_position = text.indexOf(QLatin1Char('\n'), text.size() / 2);
+        typing.m_inserted = QStringLiteral("a");
+
+        auto typed = text;
+        typed.insert(typing.m_position, typing.m_inserted);
+
+        MD::TextEdit erasing;
+        erasing.m_position = typing.m_position;
+        erasing.m_removed = 1;
+
+        QBENCHMARK {
+            parser.reparse(doc, text, typing, m_qtWd, m_qtFileName);
+            parser.reparse(doc, typed, erasing, m_qtWd, m_qtFileName);
+        }
+    }
+
     void md4qt_to_html()
     {
         MD::Parser parser;
@@ -3,6 +3,8 @@
     SPDX-License-Identifier: MIT
 */
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -36,6 +38,122 @@ std::string codeToString(const std::string &code)
     return res;
 }
 
+struct Entity {
+    std::string m_name;
+    std::string m_code;
+};
+
+// Hash of the name of entity, should be the same as in entities_map.cpp.
+uint32_t entityHash(const std::string &name)
+{
+    uint32_t h = 2166136261u;
+
+    for (const auto c : name) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+// Position of the entity in the table with the given displacement, should be the same as in entities_map.cpp.
+uint32_t entitySlot(uint32_t hash,
+                    uint32_t displacement,
+                    uint32_t slotsCount)
+{
+    uint32_t h = hash + displacement * 0x9E3779B9u;
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+
+    return h & (slotsCount - 1);
+}
+
+// Builds perfect hash with "hash and displace" algorithm. Returns false if there is no
+// displacement for some bucket.
+bool buildPerfectHash(const std::vector<Entity> &entities,
+                      uint32_t bucketsCount,
+                      uint32_t slotsCount,
+                      std::vector<uint32_t> &displacements,
+                      std::vector<uint32_t> &slots)
+{
+    std::vector<std::vector<size_t>> buckets(bucketsCount);
+
+    for (size_t i = 0; i < entities.size(); ++i) {
+        buckets[entityHash(entities[i].m_name) % bucketsCount].push_back(i);
+    }
+
+    std::vector<size_t> order(bucketsCount);
+
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&buckets](size_t b1, size_t b2) {
+        return buckets[b1].size() > buckets[b2].size();
+    });
+
+    displacements.assign(bucketsCount, 0);
+    slots.assign(slotsCount, 0);
+
+    for (const auto b : order) {
+        if (buckets[b].empty()) {
+            break;
+        }
+
+        bool placed = false;
+
+        for (uint32_t d = 0; d < 0xFFFF && !placed; ++d) {
+            std::vector<uint32_t> taken;
+
+            for (const auto i : buckets[b]) {
+                const auto s = entitySlot(entityHash(entities[i].m_name), d, slotsCount);
+
+                if (slots[s] || std::find(taken.cbegin(), taken.cend(), s) != taken.cend()) {
+                    break;
+                }
+
+                taken.push_back(s);
+            }
+
+            if (taken.size() == buckets[b].size()) {
+                for (size_t i = 0; i < taken.size(); ++i) {
+                    slots[taken[i]] = static_cast<uint32_t>(buckets[b][i] + 1);
+                }
+
+                displacements[b] = d;
+                placed = true;
+            }
+        }
+
+        if (!placed) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<class T>
+void writeArray(std::ofstream &out,
+                const std::vector<T> &data)
+{
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (i % 16 == 0) {
+            out << (i ? ",\n    " : "    ");
+        } else {
+            out << ", ";
+        }
+
+        out << data[i];
+    }
+
+    out << "};\n\n";
+}
+
 int main()
 {
     try {
@@ -53,30 +171,22 @@ int main()
             out << "\n// This file is autogenerated.\n\n";
             out << "#ifndef MD4QT_ENTITIES_MAP_H_INCLUDED\n";
             out << "#define MD4QT_ENTITIES_MAP_H_INCLUDED\n\n";
-            out << "#include <QHash>\n";
-            out << "#include <QString>\n\n";
+            out << "#include <QStringView>\n\n";
             out << "namespace MD\n";
             out << "{\n\n";
-            out << "extern const QHash<QString, QString> s_entityMap;\n\n";
+            out << "/*!\n";
+            out << " * \\inheaderfile md4qt/entities_map.h\n";
+            out << " *\n";
+            out << " * Returns characters of the named entity, or empty view if there is no such entity.\n";
+            out << " *\n";
+            out << " * \\a name Name of the entity without \"&\" and \";\".\n";
+            out << " */\n";
+            out << "QStringView findEntity(QStringView name);\n\n";
             out << "} /* namespace MD */\n\n#endif // MD4QT_ENTITIES_MAP_H_INCLUDED\n";
 
             out.close();
 
-            out.open("entities_map.cpp");
-
-            out << "/*\n";
-            out << "    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>\n";
-            out << "    SPDX-License-Identifier: MIT\n";
-            out << "*/\n";
-            out << "\n// This file is autogenerated.\n\n";
-            out << "#include \"entities_map.h\"\n\n";
-            out << "namespace MD\n";
-            out << "{\n\n";
-            out << "const QHash<QString, QString> s_entityMap = {";
-
-            // REUSE-IgnoreEnd
-
-            bool first = true;
+            std::vector<Entity> entities;
 
             for (std::string line; std::getline(in, line);) {
                 const auto firstQuote = line.find("\"");
@@ -92,23 +202,120 @@ int main()
 
                     const auto code = line.substr(prevLastQuote + 1, lastQuote - prevLastQuote - 1);
 
-                    if (out.good()) {
-                        if (!first) {
-                            out << ",\n    ";
-                        }
+                    // Entities are recognized with semicolon only.
+                    if (name.size() > 2 && name.back() == ';') {
+                        entities.push_back({name.substr(1, name.size() - 2), code});
+                    }
+                }
+            }
 
-                        out << "{QStringLiteral(\"" << name << "\"), QString::fromUtf16(" << codeToString(code) << ")}";
-                    } else {
-                        std::cout << "Unable to create file \"entities.hpp\"\n" << std::endl;
+            uint32_t slotsCount = 1;
 
-                        return -1;
-                    }
+            while (slotsCount < entities.size()) {
+                slotsCount *= 2;
+            }
 
-                    first = false;
-                }
+            const auto bucketsCount = static_cast<uint32_t>(entities.size() / 4 + 1);
+
+            std::vector<uint32_t> displacements;
+            std::vector<uint32_t> slots;
+
+            if (!buildPerfectHash(entities, bucketsCount, slotsCount, displacements, slots)) {
+                std::cout << "Unable to build perfect hash" << std::endl;
+
+                return -1;
+            }
+
+            size_t maxLength = 0;
+
+            for (const auto &e : entities) {
+                maxLength = std::max(maxLength, e.m_name.size());
             }
 
-            out << "};\n\n} /* namespace MD */\n";
+            out.open("entities_map.cpp");
+
+            if (!out.good()) {
+                std::cout << "Unable to create file \"entities_map.cpp\"" << std::endl;
+
+                return -1;
+            }
+
+            // REUSE-IgnoreStart
+
+            out << "/*\n";
+            out << "    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>\n";
+            out << "    SPDX-License-Identifier: MIT\n";
+            out << "*/\n";
+            out << "\n// This file is autogenerated.\n\n";
+            out << "#include \"entities_map.h\"\n\n";
+            out << "namespace MD\n";
+            out << "{\n\n";
+
+            // REUSE-IgnoreEnd
+
+            out << "struct Entity {\n";
+            out << "    const char16_t *m_name;\n";
+            out << "    qsizetype m_nameLength;\n";
+            out << "    const char16_t *m_value;\n";
+            out << "    qsizetype m_valueLength;\n";
+            out << "}; // struct Entity\n\n";
+            out << "static constexpr qsizetype s_maxEntityLength = " << maxLength << ";\n\n";
+            out << "static constexpr quint32 s_entityBucketsCount = " << bucketsCount << ";\n\n";
+            out << "static constexpr quint32 s_entitySlotsCount = " << slotsCount << ";\n\n";
+            out << "static constexpr Entity s_entities[] = {\n";
+
+            for (size_t i = 0; i < entities.size(); ++i) {
+                out << (i ? ",\n" : "") << "    {u\"" << entities[i].m_name << "\", " << entities[i].m_name.size() << ", "
+                    << codeToString(entities[i].m_code) << ", " << entities[i].m_code.size() / 6 << "}";
+            }
+
+            out << "};\n\n";
+            out << "// Displacements of buckets.\n";
+            out << "static constexpr quint16 s_entityDisplacements[] = {\n";
+
+            writeArray(out, displacements);
+
+            out << "// Indexes of entities plus one, zero is an empty slot.\n";
+            out << "static constexpr quint16 s_entitySlots[] = {\n";
+
+            writeArray(out, slots);
+
+            out << "inline quint32 entityHash(QStringView name)\n";
+            out << "{\n";
+            out << "    quint32 h = 2166136261u;\n\n";
+            out << "    for (const auto &c : name) {\n";
+            out << "        h ^= c.unicode();\n";
+            out << "        h *= 16777619u;\n";
+            out << "    }\n\n";
+            out << "    return h;\n";
+            out << "}\n\n";
+            out << "inline quint32 entitySlot(quint32 hash,\n";
+            out << "                          quint32 displacement)\n";
+            out << "{\n";
+            out << "    quint32 h = hash + displacement * 0x9E3779B9u;\n\n";
+            out << "    h ^= h >> 16;\n";
+            out << "    h *= 0x85EBCA6Bu;\n";
+            out << "    h ^= h >> 13;\n";
+            out << "    h *= 0xC2B2AE35u;\n";
+            out << "    h ^= h >> 16;\n\n";
+            out << "    return h & (s_entitySlotsCount - 1);\n";
+            out << "}\n\n";
+            out << "QStringView findEntity(QStringView name)\n";
+            out << "{\n";
+            out << "    if (name.isEmpty() || name.size() > s_maxEntityLength) {\n";
+            out << "        return {};\n";
+            out << "    }\n\n";
+            out << "    const auto hash = entityHash(name);\n";
+            out << "    const auto i = s_entitySlots[entitySlot(hash, s_entityDisplacements[hash % s_entityBucketsCount])];\n\n";
+            out << "    if (i) {\n";
+            out << "        const auto &e = s_entities[i - 1];\n\n";
+            out << "        if (name == QStringView(e.m_name, e.m_nameLength)) {\n";
+            out << "            return QStringView(e.m_value, e.m_valueLength);\n";
+            out << "        }\n";
+            out << "    }\n\n";
+            out << "    return {};\n";
+            out << "}\n\n";
+            out << "} /* namespace MD */\n";
         } else {
             std::cout << "Unable to open file \"entities.json\"" << std::endl;
 
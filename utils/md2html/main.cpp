@@ -54,9 +54,7 @@ int main(int argc,
             QFile html(htmlFileName);
 
             if (html.open(QIODevice::WriteOnly)) {
-                const auto content = MD::toHtml(doc);
-
-                html.write(content.toUtf8());
+                MD::toHtml(doc, html);
 
                 html.close();
             } else {